@@ -0,0 +1,74 @@
+project "PaperBench"
+	kind "ConsoleApp"
+	language "C++"
+	staticruntime "off"
+
+	targetdir ("%{wks.location}/bin/" .. outputdir .. "/%{prj.name}")
+	objdir ("%{wks.location}/bin-int/" .. outputdir .. "/%{prj.name}")
+
+	--the script benchmarks load mono and scriptcore.dll relative to the editor folder
+	debugdir "%{wks.location}/PaperEditor"
+
+	pchheader "Bench.h"
+	pchsource "%{wks.location}/PaperBench/src/Bench.cpp"
+
+	files
+	{
+		"src/**.h",
+		"src/**.cpp"
+	}
+
+	includedirs
+	{
+		"src",
+		"%{wks.location}/engine/src",
+		"%{wks.location}/engine/src/core",
+		"%{wks.location}/engine/lib",
+		"%{IncludeDir.DIRENT}",
+		"%{IncludeDir.GLAD}",
+		"%{IncludeDir.GLFW}",
+		"%{IncludeDir.GLM}",
+		"%{IncludeDir.IMGUI}",
+		"%{IncludeDir.SPDLOG}",
+		"%{IncludeDir.YAMLCPP}",
+		"%{IncludeDir.ENTT}",
+		"%{IncludeDir.MONO}",
+		"%{IncludeDir.MSDFGEN}",
+		"%{IncludeDir.MSDF_ATLAS_GEN}"
+	}
+
+	defines 
+	{
+		"_CRT_SECURE_NO_WARNINGS"
+	}
+
+	links
+	{
+		"engine"
+	}
+
+	disablewarnings
+	{
+		"4251",
+		"4267",
+		"4305",
+		"4244"
+	}
+	
+	filter "system:windows"
+		cppdialect "C++20"
+		systemversion "latest"
+
+		defines
+		{
+			"CORE_PLATFORM_WINDOWS"
+		}
+
+	filter "configurations:Debug"
+		defines {"BUILD_DEBUG", "CORE_ENABLE_ASSERTS"}
+		symbols "On"
+
+	--numbers are only meaningful from this configuration
+	filter "configurations:Release"
+		defines "BUILD_RELEASE"
+		optimize "On"
@@ -0,0 +1 @@
+#include "Bench.h"
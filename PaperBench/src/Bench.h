@@ -0,0 +1,6 @@
+#pragma once
+
+//the engine's precompiled header, every benchmark includes what it measures on top of it
+#include "Engine.h"
+
+using namespace Paper;
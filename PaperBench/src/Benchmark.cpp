@@ -0,0 +1,36 @@
+#include "Bench.h"
+#include "Benchmark.h"
+
+namespace PaperBench
+{
+	static volatile uint64_t sink = 0;
+	static volatile const void* escaped = nullptr;
+
+	void Consume(uint64_t value)
+	{
+		sink = sink + value;
+	}
+
+	void Escape(const void* object)
+	{
+		escaped = object;
+	}
+
+	void PrintSection(std::string_view title)
+	{
+		fmt::print("\n{}\n", title);
+	}
+
+	void Report(std::string_view name, uint64_t nanoseconds, size_t operations)
+	{
+		const double nsPerOperation = (double)nanoseconds / (double)std::max<size_t>(operations, 1);
+
+		//physics steps take milliseconds where a map lookup takes nanoseconds
+		double time = nsPerOperation;
+		const char* unit = "ns";
+		if (nsPerOperation >= 1e6) { time = nsPerOperation / 1e6; unit = "ms"; }
+		else if (nsPerOperation >= 1e3) { time = nsPerOperation / 1e3; unit = "us"; }
+
+		fmt::print("  {:<44} {:>10.2f} {}/op {:>14.0f} op/s\n", name, time, unit, 1e9 / nsPerOperation);
+	}
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include "Bench.h"
+
+namespace PaperBench
+{
+	struct Benchmark
+	{
+		const char* name;
+		void(*run)();
+	};
+
+	void RunFlatHashMapBenchmark();
+	void RunPhysicsBenchmark();
+	void RunScriptCallbackBenchmark();
+	void RunInternalCallBenchmark();
+	void RunRenderSubmissionBenchmark();
+
+	//the script benchmarks start the script engine on first use, main stops it after the last benchmark
+	void StopScriptEngine();
+
+	//runs fn once to warm up and then repetitions times, returns the fastest run in nanoseconds
+	template <typename Fn>
+	uint64_t MeasureBest(Fn&& fn, uint32_t repetitions = 5)
+	{
+		fn();
+
+		uint64_t best = std::numeric_limits<uint64_t>::max();
+		for (uint32_t i = 0; i < repetitions; i++)
+		{
+			const uint64_t start = Profiler::Now();
+			fn();
+			best = std::min(best, Profiler::Now() - start);
+		}
+		return best;
+	}
+
+	//keeps the optimizer from dropping work whose result is never read
+	void Consume(uint64_t value);
+	//same for objects that are built and handed off but never read, like a packet passed to the renderer
+	void Escape(const void* object);
+
+	void PrintSection(std::string_view title);
+	//prints the time per operation and the operations per second of one measurement
+	void Report(std::string_view name, uint64_t nanoseconds, size_t operations);
+}
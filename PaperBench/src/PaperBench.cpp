@@ -0,0 +1,49 @@
+#include "Bench.h"
+#include "Benchmark.h"
+
+using namespace PaperBench;
+
+static const Benchmark benchmarks[] =
+{
+	{ "flathashmap", RunFlatHashMapBenchmark },
+	{ "physics", RunPhysicsBenchmark },
+	{ "scriptcallbacks", RunScriptCallbackBenchmark },
+	{ "internalcalls", RunInternalCallBenchmark },
+	{ "rendersubmission", RunRenderSubmissionBenchmark }
+};
+
+static bool IsSelected(const Benchmark& benchmark, int argc, char** argv)
+{
+	return argc < 2 || std::any_of(argv + 1, argv + argc, [&](const char* arg) { return std::string_view(arg) == benchmark.name; });
+}
+
+//PaperBench [name...], runs the named benchmarks or all of them without arguments
+int main(int argc, char** argv)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		const bool known = std::any_of(std::begin(benchmarks), std::end(benchmarks), [&](const Benchmark& benchmark) { return std::string_view(argv[i]) == benchmark.name; });
+		if (known) continue;
+
+		fmt::print("Unknown benchmark '{}', available:\n", argv[i]);
+		for (const Benchmark& benchmark : benchmarks)
+			fmt::print("  {}\n", benchmark.name);
+		return 1;
+	}
+
+	Log::Init();
+
+#ifdef BUILD_DEBUG
+	fmt::print("Debug build, run the Release configuration for representative numbers\n");
+#endif
+
+	for (const Benchmark& benchmark : benchmarks)
+	{
+		if (IsSelected(benchmark, argc, argv))
+			benchmark.run();
+	}
+
+	StopScriptEngine();
+	Log::Shutdown();
+	return 0;
+}
@@ -0,0 +1,87 @@
+#include "Bench.h"
+#include "Benchmark.h"
+
+#include "utils/FlatHashMap.h"
+#include "utils/PaperID.h"
+
+namespace PaperBench
+{
+	//the operations Scene::entity_map and the script tables see: random 64 bit PaperIDs as keys,
+	//lookups in no particular order and entities created and destroyed during play
+	template <typename Map>
+	static void RunMapOperations(std::string_view mapName, const std::vector<PaperID>& ids, const std::vector<PaperID>& lookups, const std::vector<PaperID>& misses)
+	{
+		const size_t count = ids.size();
+
+		//includes freeing the map, which is part of what node allocation costs
+		Report(fmt::format("{} insert", mapName), MeasureBest([&]()
+		{
+			Map map;
+			for (size_t i = 0; i < count; i++)
+				map[ids[i]] = (entt::entity)i;
+			Consume(map.size());
+		}), count);
+
+		Map map;
+		for (size_t i = 0; i < count; i++)
+			map[ids[i]] = (entt::entity)i;
+
+		Report(fmt::format("{} find hit", mapName), MeasureBest([&]()
+		{
+			uint64_t sum = 0;
+			for (const PaperID& id : lookups)
+				sum += (uint64_t)map.find(id)->second;
+			Consume(sum);
+		}), lookups.size());
+
+		Report(fmt::format("{} find miss", mapName), MeasureBest([&]()
+		{
+			uint64_t found = 0;
+			for (const PaperID& id : misses)
+				found += map.find(id) != map.end();
+			Consume(found);
+		}), misses.size());
+
+		Report(fmt::format("{} iterate", mapName), MeasureBest([&]()
+		{
+			uint64_t sum = 0;
+			for (const auto& [id, entity] : map)
+				sum += (uint64_t)entity;
+			Consume(sum);
+		}), count);
+
+		//destroys and recreates every other entity, leaves the map as it found it
+		Report(fmt::format("{} erase + insert", mapName), MeasureBest([&]()
+		{
+			for (size_t i = 0; i < count; i += 2)
+				map.erase(ids[i]);
+			for (size_t i = 0; i < count; i += 2)
+				map[ids[i]] = (entt::entity)i;
+			Consume(map.size());
+		}), count);
+	}
+
+	void RunFlatHashMapBenchmark()
+	{
+		std::mt19937_64 random(42);
+
+		for (const size_t count : { 1000, 10000, 100000 })
+		{
+			std::vector<PaperID> ids(count);
+			for (PaperID& id : ids)
+				id = PaperID(random());
+
+			std::vector<PaperID> lookups(count * 4);
+			for (PaperID& id : lookups)
+				id = ids[random() % count];
+
+			std::vector<PaperID> misses(count);
+			for (PaperID& id : misses)
+				id = PaperID(random());
+
+			PrintSection(fmt::format("PaperID -> entt::entity, {} entries", count));
+			RunMapOperations<std::unordered_map<PaperID, entt::entity>>("std::unordered_map", ids, lookups, misses);
+			RunMapOperations<FlatHashMap<PaperID, entt::entity>>("FlatHashMap", ids, lookups, misses);
+		}
+	}
+}
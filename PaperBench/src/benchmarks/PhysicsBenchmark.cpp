@@ -0,0 +1,96 @@
+#include "Bench.h"
+#include "Benchmark.h"
+
+#include "physics/PhysicsWorld2D.h"
+
+#include "component/TransformComponent.h"
+#include "component/Rigidbody2DComponent.h"
+#include "component/BoxCollider2DComponent.h"
+#include "component/CircleCollider2DComponent.h"
+
+namespace PaperBench
+{
+	static constexpr float STEP_DT = 1.0f / 60.0f;
+	static constexpr uint32_t WARMUP_STEPS = 10;
+	static constexpr uint32_t MEASURED_STEPS = 60;
+
+	//boxes and circles of unit size on a jittered grid, half of each kind
+	static void SpawnBodies(entt::registry& registry, uint32_t count, float spacing, std::mt19937& random, float speed)
+	{
+		std::uniform_real_distribution<float> jitter(-0.1f, 0.1f);
+		std::uniform_real_distribution<float> direction(-1.0f, 1.0f);
+
+		const uint32_t columns = (uint32_t)std::ceil(std::sqrt((float)count));
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const glm::vec2 cell((float)(i % columns), (float)(i / columns));
+			const glm::vec2 position = cell * spacing + glm::vec2(jitter(random), jitter(random));
+
+			const entt::entity entity = registry.create();
+			registry.emplace<TransformComponent>(entity, glm::vec3(position, 0.0f));
+
+			auto& rigidbody = registry.emplace<Rigidbody2DComponent>(entity);
+			rigidbody.velocity = glm::vec2(direction(random), direction(random)) * speed;
+
+			if (i % 2 == 0)
+				registry.emplace<BoxCollider2DComponent>(entity);
+			else
+				registry.emplace<CircleCollider2DComponent>(entity);
+		}
+	}
+
+	static void MeasureSteps(std::string_view name, entt::registry& registry, PhysicsWorld2D& world)
+	{
+		for (uint32_t i = 0; i < WARMUP_STEPS; i++)
+			world.Step(registry, STEP_DT);
+
+		const uint64_t start = Profiler::Now();
+		for (uint32_t i = 0; i < MEASURED_STEPS; i++)
+			world.Step(registry, STEP_DT);
+		Report(name, Profiler::Now() - start, MEASURED_STEPS);
+
+		const PhysicsStats2D& stats = world.GetStats();
+		fmt::print("  {:<44} {} bodies, {} awake, {} pairs, {} contacts\n", "  after the last step", stats.bodies, stats.awakeBodies, stats.pairs, stats.contacts);
+	}
+
+	//a tall grid of bodies falling onto a static floor, neighbours start almost touching
+	static void RunPile(uint32_t count)
+	{
+		entt::registry registry;
+		PhysicsWorld2D world;
+		std::mt19937 random(42);
+
+		const float spacing = 1.1f;
+		SpawnBodies(registry, count, spacing, random, 0.0f);
+
+		const float width = std::ceil(std::sqrt((float)count)) * spacing;
+		const entt::entity floor = registry.create();
+		registry.emplace<TransformComponent>(floor, glm::vec3(width * 0.5f, -1.0f, 0.0f), glm::vec3(width + 2.0f, 1.0f, 1.0f));
+		registry.emplace<BoxCollider2DComponent>(floor);
+
+		MeasureSteps(fmt::format("{} bodies pile, step", count), registry, world);
+	}
+
+	//no gravity and random velocities keep every body awake and the sweep order changing
+	static void RunDrift(uint32_t count)
+	{
+		entt::registry registry;
+		PhysicsWorld2D world;
+		std::mt19937 random(42);
+
+		world.GetSettings().gravity = glm::vec2(0.0f);
+		SpawnBodies(registry, count, 1.05f, random, 2.0f);
+
+		MeasureSteps(fmt::format("{} bodies drift, step", count), registry, world);
+	}
+
+	void RunPhysicsBenchmark()
+	{
+		PrintSection(fmt::format("PhysicsWorld2D::Step, {} substeps, sweep and prune broadphase", PhysicsSettings2D().substeps));
+		for (const uint32_t count : { 10000, 25000, 50000 })
+		{
+			RunPile(count);
+			RunDrift(count);
+		}
+	}
+}
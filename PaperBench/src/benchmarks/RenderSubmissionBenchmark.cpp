@@ -0,0 +1,169 @@
+#include "Bench.h"
+#include "Benchmark.h"
+
+#include "renderer/Renderer2D.h"
+
+#include "component/TransformComponent.h"
+#include "component/SpriteComponent.h"
+#include "component/TextComponent.h"
+
+namespace PaperBench
+{
+	static constexpr uint32_t PACKET_COUNT = 100000;
+	static constexpr uint32_t LEGACY_TEXTURE_COUNT = 8;
+
+	//the packet layout before the renderer took asset handles and string views:
+	//every packet retained its texture or font and copied the text it draws
+	struct LegacyEdgeRenderData
+	{
+		glm::mat4 transform = glm::mat4(1.0f);
+		glm::vec4 color = glm::vec4(1.0f);
+		Shr<Texture> texture = nullptr;
+		std::array<glm::vec2, 4> texCoords = { { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } } };
+		float tilingFactor = 1.0f;
+		entity_id enity_id = -1;
+		uint32_t uiID = 0;
+		bool coreIDToAlphaPixels = false;
+	};
+
+	struct LegacyTextRenderData
+	{
+		glm::mat4 transform = glm::mat4(1.0f);
+		glm::vec4 color = glm::vec4(1.0f);
+		std::string text;
+		Shr<Font> font = nullptr;
+		entity_id enity_id = -1;
+		uint32_t uiID = 0;
+		bool coreIDToAlphaPixels = false;
+	};
+
+	//what the components held before, so the legacy loops read the same fields Scene::Render read
+	struct LegacySpriteComponent
+	{
+		glm::vec4 color = glm::vec4(1.0f);
+		float tiling_factor = 1.0f;
+		std::array<glm::vec2, 4> tex_coords = { { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } } };
+		Shr<Texture> texture;
+		bool register_alpha_pixels_to_event = false;
+	};
+
+	struct LegacyTextComponent
+	{
+		glm::vec4 color = glm::vec4(1.0f);
+		std::string text;
+		Shr<Font> font;
+		bool register_alpha_pixels_to_event = false;
+	};
+
+	//gives the shared pointers a control block without a gpu resource behind them, only the refcount is measured
+	template <typename T>
+	static Shr<T> MakeRefCounted()
+	{
+		return Shr<T>((T*)nullptr, [](T*) {});
+	}
+
+	void RunRenderSubmissionBenchmark()
+	{
+		std::mt19937 random(42);
+		std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+
+		std::vector<Shr<Texture>> legacyTextures(LEGACY_TEXTURE_COUNT);
+		for (Shr<Texture>& texture : legacyTextures)
+			texture = MakeRefCounted<Texture>();
+		const Shr<Font> legacyFont = MakeRefCounted<Font>();
+
+		//past the small string buffer, like most labels in a scene
+		std::vector<std::string> labels(PACKET_COUNT);
+		for (uint32_t i = 0; i < PACKET_COUNT; i++)
+			labels[i] = fmt::format("entity label number {:06}", i);
+
+		entt::registry registry;
+		for (uint32_t i = 0; i < PACKET_COUNT; i++)
+		{
+			const entt::entity entity = registry.create();
+			registry.emplace<TransformComponent>(entity, glm::vec3(position(random), position(random), 0.0f));
+			registry.emplace<SpriteComponent>(entity, glm::vec4(1.0f), AssetHandle<Texture>{}, Geometry::RECTANGLE);
+			registry.emplace<TextComponent>(entity, glm::vec4(1.0f), labels[i], AssetHandle<Font>{});
+			registry.emplace<LegacySpriteComponent>(entity).texture = legacyTextures[i % LEGACY_TEXTURE_COUNT];
+
+			auto& legacyText = registry.emplace<LegacyTextComponent>(entity);
+			legacyText.text = labels[i];
+			legacyText.font = legacyFont;
+		}
+
+		//GetTransform costs many times what a packet does and would hide the layout difference, the matrices are built up front.
+		//the registry is fresh, so entity ids run from 0 to PACKET_COUNT - 1
+		std::vector<glm::mat4> transforms(PACKET_COUNT);
+		for (auto [entity, transform] : registry.view<TransformComponent>().each())
+			transforms[(entity_id)entity] = transform.GetTransform();
+
+		PrintSection(fmt::format("Render packet submission, {} sprites", PACKET_COUNT));
+
+		//the packets Scene::Render builds, Escape stands in for Renderer2D::Draw* which needs a gl context
+		Report("EdgeRenderData (asset handle)", MeasureBest([&]()
+		{
+			auto view = registry.view<SpriteComponent>();
+			for (auto [entity, sprite] : view.each()) {
+				EdgeRenderData data;
+				data.transform = transforms[(entity_id)entity];
+				data.color = sprite.color;
+				data.texture = sprite.texture;
+				data.tilingFactor = sprite.tiling_factor;
+				data.texCoords = sprite.tex_coords;
+				data.coreIDToAlphaPixels = sprite.register_alpha_pixels_to_event;
+				data.enity_id = (entity_id)entity;
+
+				Escape(&data);
+			}
+		}), PACKET_COUNT);
+
+		Report("EdgeRenderData before (Shr<Texture>)", MeasureBest([&]()
+		{
+			auto view = registry.view<LegacySpriteComponent>();
+			for (auto [entity, sprite] : view.each()) {
+				LegacyEdgeRenderData data;
+				data.transform = transforms[(entity_id)entity];
+				data.color = sprite.color;
+				data.texture = sprite.texture;
+				data.tilingFactor = sprite.tiling_factor;
+				data.texCoords = sprite.tex_coords;
+				data.coreIDToAlphaPixels = sprite.register_alpha_pixels_to_event;
+				data.enity_id = (entity_id)entity;
+
+				Escape(&data);
+			}
+		}), PACKET_COUNT);
+
+		Report("TextRenderData (string view)", MeasureBest([&]()
+		{
+			auto view = registry.view<TextComponent>();
+			for (auto [entity, text] : view.each()) {
+				TextRenderData data;
+				data.transform = transforms[(entity_id)entity];
+				data.color = text.color;
+				data.text = text.text;
+				data.font = text.font;
+				data.coreIDToAlphaPixels = text.register_alpha_pixels_to_event;
+				data.enity_id = (entity_id)entity;
+
+				Escape(&data);
+			}
+		}), PACKET_COUNT);
+
+		Report("TextRenderData before (string, Shr<Font>)", MeasureBest([&]()
+		{
+			auto view = registry.view<LegacyTextComponent>();
+			for (auto [entity, text] : view.each()) {
+				LegacyTextRenderData data;
+				data.transform = transforms[(entity_id)entity];
+				data.color = text.color;
+				data.text = text.text;
+				data.font = text.font;
+				data.coreIDToAlphaPixels = text.register_alpha_pixels_to_event;
+				data.enity_id = (entity_id)entity;
+
+				Escape(&data);
+			}
+		}), PACKET_COUNT);
+	}
+}
@@ -0,0 +1,174 @@
+#include "Bench.h"
+#include "Benchmark.h"
+
+#include "scripting/ScriptEngine.h"
+#include "scene/Entity.h"
+#include "scene/Scene.h"
+
+#include <mono/jit/jit.h>
+#include <mono/metadata/object.h>
+#include <mono/metadata/debug-helpers.h>
+
+namespace PaperBench
+{
+	static constexpr uint64_t ENTITY_COUNT = 10000;
+
+	//unset until the first script benchmark asks for the engine
+	static std::optional<bool> scriptEngineAvailable;
+
+	//scriptcore.dll and the mono runtime are found relative to the PaperEditor folder
+	static bool StartScriptEngine()
+	{
+		if (scriptEngineAvailable) return *scriptEngineAvailable;
+
+		scriptEngineAvailable = std::filesystem::exists("resources/scripts/scriptcore.dll") && std::filesystem::exists("mono/lib");
+		if (!*scriptEngineAvailable)
+		{
+			fmt::print("\nSkipping the script benchmarks, run PaperBench from the PaperEditor folder\n");
+			return false;
+		}
+
+		//the debug mode's soft breakpoints would slow down every managed call
+		ScriptEngine::SetRuntimeMode(ScriptRuntimeMode::Release);
+		ScriptEngine::Init();
+		return true;
+	}
+
+	void StopScriptEngine()
+	{
+		if (scriptEngineAvailable.value_or(false))
+			ScriptEngine::Shutdown(true);
+	}
+
+	//Paper.Entity objects straight from scriptcore, pinned so the raw pointers stay valid
+	struct PinnedEntities
+	{
+		std::vector<MonoObject*> instances;
+		std::vector<uint32_t> gcHandles;
+
+		PinnedEntities(const ScriptClass& entityClass, uint64_t count)
+		{
+			for (uint64_t id = 1; id <= count; id++)
+			{
+				MonoObject* instance = entityClass.InstantiateParams(id);
+				instances.push_back(instance);
+				gcHandles.push_back(mono_gchandle_new(instance, true));
+			}
+		}
+
+		~PinnedEntities()
+		{
+			for (const uint32_t gcHandle : gcHandles)
+				mono_gchandle_free(gcHandle);
+		}
+	};
+
+	//Entity.OnUpdate is empty, so this is the cost of the call alone
+	void RunScriptCallbackBenchmark()
+	{
+		if (!StartScriptEngine()) return;
+
+		using OnUpdateFn = void(MONO_THUNK_CALL*)(MonoObject* instance, float dt, MonoException** exception);
+
+		const ScriptClass entityClass(ScriptEngine::GetEntityClass());
+		const ManagedMethod* onUpdate = entityClass.GetMethod("OnUpdate", 1);
+		const auto onUpdateThunk = (OnUpdateFn)mono_method_get_unmanaged_thunk(onUpdate->monoMethod);
+
+		const PinnedEntities entities(entityClass, ENTITY_COUNT);
+		float dt = 1.0f / 60.0f;
+
+		PrintSection(fmt::format("Entity.OnUpdate(float) on {} entities", ENTITY_COUNT));
+
+		//how ScriptClass::InvokeMethod calls into managed code: boxed params and an exception object
+		Report("mono_runtime_invoke", MeasureBest([&]()
+		{
+			for (MonoObject* instance : entities.instances)
+			{
+				void* params[] = { &dt };
+				MonoObject* exception = nullptr;
+				mono_runtime_invoke(onUpdate->monoMethod, instance, params, &exception);
+				if (exception)
+					mono_print_unhandled_exception(exception);
+			}
+		}), entities.instances.size());
+
+		//how EntityCallbacks call OnCreate and OnDestroy
+		Report("unmanaged thunk", MeasureBest([&]()
+		{
+			for (MonoObject* instance : entities.instances)
+			{
+				MonoException* exception = nullptr;
+				onUpdateThunk(instance, dt, &exception);
+				if (exception)
+					mono_print_unhandled_exception((MonoObject*)exception);
+			}
+		}), entities.instances.size());
+	}
+
+	//mirrors Paper.Tag, a struct with one uint
+	struct ManagedTag
+	{
+		uint32_t id;
+	};
+
+	//Entity.HasTag(Tag) is a thin wrapper around the Entity_HasTagID internal call, which looks the entity
+	//up by PaperID like most internal calls do. The native line is the same lookup without mono in between.
+	void RunInternalCallBenchmark()
+	{
+		if (!StartScriptEngine()) return;
+
+		using HasTagFn = MonoBoolean(MONO_THUNK_CALL*)(MonoObject* instance, ManagedTag tag, MonoException** exception);
+
+		const ScriptClass entityClass(ScriptEngine::GetEntityClass());
+
+		//HasTag(string) has the same parameter count, so the overload is picked by signature
+		MonoMethodDesc* hasTagDesc = mono_method_desc_new("Paper.Entity:HasTag(Paper.Tag)", true);
+		MonoMethod* hasTag = mono_method_desc_search_in_class(hasTagDesc, entityClass.GetMonoClass());
+		mono_method_desc_free(hasTagDesc);
+		if (!hasTag)
+		{
+			fmt::print("\nSkipping the internal call benchmark, Paper.Entity has no HasTag(Tag)\n");
+			return;
+		}
+		const auto hasTagThunk = (HasTagFn)mono_method_get_unmanaged_thunk(hasTag);
+
+		//every other entity is tagged
+		Scene scene;
+		for (uint64_t id = 1; id <= ENTITY_COUNT; id++)
+		{
+			Entity entity = scene.CreateEntity(PaperID(id), "Entity");
+			if (id % 2 == 0)
+				entity.AddTag("Bench");
+		}
+		const ManagedTag tag = { Scene::GetTagID("Bench") };
+
+		const PinnedEntities entities(entityClass, ENTITY_COUNT);
+		ScriptEngine::OnRuntimeStart(&scene);
+
+		PrintSection(fmt::format("Entity.HasTag(Tag) on {} entities", ENTITY_COUNT));
+
+		Report("native Scene::GetEntity + EntityHasTag", MeasureBest([&]()
+		{
+			uint64_t tagged = 0;
+			for (uint64_t id = 1; id <= ENTITY_COUNT; id++)
+				tagged += scene.EntityHasTag(scene.GetEntity(PaperID(id)), tag.id);
+			Consume(tagged);
+		}), ENTITY_COUNT);
+
+		//compare with the unmanaged thunk line of scriptcallbacks for the cost of the internal call itself
+		Report("thunk -> HasTag -> internal call", MeasureBest([&]()
+		{
+			uint64_t tagged = 0;
+			for (MonoObject* instance : entities.instances)
+			{
+				MonoException* exception = nullptr;
+				tagged += hasTagThunk(instance, tag, &exception);
+				if (exception)
+					mono_print_unhandled_exception((MonoObject*)exception);
+			}
+			Consume(tagged);
+		}), entities.instances.size());
+
+		ScriptEngine::OnRuntimeStop();
+	}
+}
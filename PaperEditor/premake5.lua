@@ -41,7 +41,7 @@ project "PaperEditor"
 
 	defines 
 	{
-		"_CRT_SECURE_NO_WARNINGS"
+		"_CRT_SECURE_NO_WARNINGS",
 		--"GLM_FORCE_XYZW_ONLY"
 	}
 
@@ -68,7 +68,8 @@ project "PaperEditor"
 		}
 
 	filter "configurations:Debug"
-		defines {"BUILD_DEBUG", "CORE_ENABLE_ASSERTS"}
+		defines {"BUILD_DEBUG", "CORE_ENABLE_ASSERTS", "PAPER_ENABLE_PROFILING"}
+		--PAPER_ENABLE_PROFILING compiles the PAPER_PROFILE_* macros in, add it to Release to profile optimized builds
 		symbols "On"
 		
 		--links
@@ -6,11 +6,15 @@
 
 #include "ViewPort.h"
 
+#include "assets/AssetManager.h"
 #include "ImGuizmo/ImGuizmo.h"
 #include "panels/ContentBrowserPanel.h"
 #include "panels/DebuggingPanel.h"
+#include "panels/MemoryPanel.h"
 #include "panels/OutlinerPanel.h"
 #include "panels/PropertiesPanel.h"
+#include "panels/ProfilerPanel.h"
+#include "panels/ScriptProfilerPanel.h"
 #include "project/ProjectSerializer.h"
 
 #include "renderer/Renderer2D.h"
@@ -54,6 +58,9 @@ void PaperLayer::OnAttach()
 	panelManager.AddPanel<SceneDebuggingPanel>("Scene Debugger", false);
 	panelManager.AddPanel<CameraSettingsPanel>("Camera Debugger", false);
 	panelManager.AddPanel<ViewportDebuggingPanel>("Viewport Debugger", false);
+	panelManager.AddPanel<ProfilerPanel>("Profiler", false);
+	panelManager.AddPanel<MemoryPanel>("Memory", false);
+	panelManager.AddPanel<ScriptProfilerPanel>("Script Profiler", false);
 	panelManager.AddPanel<ApplicationPanel>(true, DockLoc::Right);
 	panelManager.AddPanel<ContentBrowserPanel>("Content Browser", true, DockLoc::Bottom);
 	panelManager.AddPanel<OutlinerPanel>("Outliner", true, DockLoc::Right);
@@ -557,7 +564,7 @@ void HoverImageButton(std::string text)
 	}
 }
 
-bool ToolTipButton(const Shr<Texture>& tex, float size, std::string tooltip = std::string())
+bool ToolTipButton(const Texture* tex, float size, std::string tooltip = std::string())
 {
 	bool state = ImGui::ImageButton((void*)tex->GetID(), ImVec2(size, size), ImVec2{ 0, 1 }, ImVec2{ 1, 0 }, 0);
 	std::string texName = tooltip.empty() ? tex->GetFilePath().stem().string() : tooltip;
@@ -574,11 +581,17 @@ void PaperLayer::UI_Toolbar()
 	if (first)
 		DockManager::DockPanel(name, DockLoc::Top);
 
-	Shr<Texture> playButton = DataPool::GetTexture("resources/editor/viewport/Play.png", true);
-	Shr<Texture> simulateButton = DataPool::GetTexture("resources/editor/viewport/Simulate.png", true);
-	Shr<Texture> pauseButton = DataPool::GetTexture("resources/editor/viewport/Pause.png", true);
-	Shr<Texture> stopButton = DataPool::GetTexture("resources/editor/viewport/Stop.png", true);
-	Shr<Texture> stepButton = DataPool::GetTexture("resources/editor/viewport/Step.png", true);
+	static const AssetHandle<Texture> playHandle = AssetManager::LoadTexture("resources/editor/viewport/Play.png");
+	static const AssetHandle<Texture> simulateHandle = AssetManager::LoadTexture("resources/editor/viewport/Simulate.png");
+	static const AssetHandle<Texture> pauseHandle = AssetManager::LoadTexture("resources/editor/viewport/Pause.png");
+	static const AssetHandle<Texture> stopHandle = AssetManager::LoadTexture("resources/editor/viewport/Stop.png");
+	static const AssetHandle<Texture> stepHandle = AssetManager::LoadTexture("resources/editor/viewport/Step.png");
+
+	const Texture* playButton = AssetManager::Get(playHandle);
+	const Texture* simulateButton = AssetManager::Get(simulateHandle);
+	const Texture* pauseButton = AssetManager::Get(pauseHandle);
+	const Texture* stopButton = AssetManager::Get(stopHandle);
+	const Texture* stepButton = AssetManager::Get(stepHandle);
 
 	ImGui::PushStyleVar(ImGuiStyleVar_WindowPadding, ImVec2(0, 2));
 	ImGui::PushStyleVar(ImGuiStyleVar_ItemInnerSpacing, ImVec2(0, 0));
@@ -821,7 +834,7 @@ void PaperLayer::UI_MenuBar()
 		{
 			if (ImGui::MenuItem("Reload C# Assembly"))
 			{
-				ScriptEngine::ReloadAssemblies();
+				ScriptEngine::ScheduleAssembliesReload();
 			}
 
 			ImGui::EndMenu();
@@ -62,6 +62,7 @@ void ViewPort::Panel(PaperLayer* peLayer)
 	RenderCommand::Clear();
 
 	framebuffer->Bind();
+	RenderCommand::BeginGPUPass("Viewport " + name);
 	
 	RenderCommand::ClearColor(glm::vec4(0.1f, 0.1f, 0.1f, 1.0f));
 	RenderCommand::Clear();
@@ -182,5 +183,6 @@ void ViewPort::Panel(PaperLayer* peLayer)
 
 
 
+	RenderCommand::EndGPUPass();
 	framebuffer->Unbind();
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "DockManager.h"
 #include "PaperLayer.h"
 
+#include "assets/AssetManager.h"
+
 constexpr bool dynamicCameraCount = true;
 
 void PaperLayer::CameraMode()
@@ -28,7 +30,7 @@ void PaperLayer::CameraMode()
 					ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.0f, 1.0f, 0.0f, 1.0f));
 					pop = true;
 				}
-				if (ImGui::ImageButton("single", (void*)DataPool::GetTexture("main_view.png")->GetID(), ImVec2(75.0f, 50.0f), ImVec2{ 0, 1 }, ImVec2{ 1, 0 }))
+				if (ImGui::ImageButton("single", (void*)AssetManager::Get(AssetManager::LoadTexture("resources/textures/main_view.png"))->GetID(), ImVec2(75.0f, 50.0f), ImVec2{ 0, 1 }, ImVec2{ 1, 0 }))
 				{
 					active = !active;
 					camera_mode = mode;
@@ -45,7 +47,7 @@ void PaperLayer::CameraMode()
 					ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.0f, 1.0f, 0.0f, 1.0f));
 					pop = true;
 				}
-				if (ImGui::ImageButton("split", (void*)DataPool::GetTexture("split_view.png")->GetID(), ImVec2(75.0f, 50.0f), ImVec2{ 0, 1 }, ImVec2{ 1, 0 }))
+				if (ImGui::ImageButton("split", (void*)AssetManager::Get(AssetManager::LoadTexture("resources/textures/split_view.png"))->GetID(), ImVec2(75.0f, 50.0f), ImVec2{ 0, 1 }, ImVec2{ 1, 0 }))
 				{
 					active = !active;
 					camera_mode = mode;
@@ -62,7 +64,7 @@ void PaperLayer::CameraMode()
 					ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.0f, 1.0f, 0.0f, 1.0f));
 					pop = true;
 				}
-				if (ImGui::ImageButton("triple", (void*)DataPool::GetTexture("triple_view.png")->GetID(), ImVec2(75.0f, 50.0f), ImVec2{ 0, 1 }, ImVec2{ 1, 0 }))
+				if (ImGui::ImageButton("triple", (void*)AssetManager::Get(AssetManager::LoadTexture("resources/textures/triple_view.png"))->GetID(), ImVec2(75.0f, 50.0f), ImVec2{ 0, 1 }, ImVec2{ 1, 0 }))
 				{
 					active = !active;
 					camera_mode = mode;
@@ -79,7 +81,7 @@ void PaperLayer::CameraMode()
 					ImGui::PushStyleColor(ImGuiCol_Button, ImVec4(0.0f, 1.0f, 0.0f, 1.0f));
 					pop = true;
 				}
-				if (ImGui::ImageButton("quadro", (void*)DataPool::GetTexture("quadro_view.png")->GetID(), ImVec2(75.0f, 50.0f), ImVec2{ 0, 1 }, ImVec2{ 1, 0 }))
+				if (ImGui::ImageButton("quadro", (void*)AssetManager::Get(AssetManager::LoadTexture("resources/textures/quadro_view.png"))->GetID(), ImVec2(75.0f, 50.0f), ImVec2{ 0, 1 }, ImVec2{ 1, 0 }))
 				{
 					active = !active;
 					camera_mode = mode;
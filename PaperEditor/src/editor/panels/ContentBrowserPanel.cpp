@@ -1,6 +1,7 @@
 ﻿#include "Editor.h"
 #include "ContentBrowserPanel.h"
 
+#include "assets/AssetManager.h"
 #include "project/Project.h"
 #include "renderer/Font.h"
 
@@ -28,17 +29,17 @@ namespace PaperED
 		if (item.is_directory())
 		{
 			UI::ScopedColour button_col(ImGuiCol_Button, ImVec4(0, 0, 0, 0));
-			if (ImGui::ImageButton((void*)DataPool::GetTexture("folder_icon.png")->GetID(), ImVec2(size, size), ImVec2{ 0, 1 }, ImVec2{ 1, 0 }, 0))
+			if (ImGui::ImageButton((void*)AssetManager::Get(AssetManager::LoadTexture("resources/textures/folder_icon.png"))->GetID(), ImVec2(size, size), ImVec2{ 0, 1 }, ImVec2{ 1, 0 }, 0))
 				return true;
 		}
 		else
 		{
 			UI::ScopedColour button_col(ImGuiCol_Button, ImVec4(0, 0, 0, 0));
 
-			void* textureID = (void*)DataPool::GetTexture("file_icon.png")->GetID();
+			void* textureID = (void*)AssetManager::Get(AssetManager::LoadTexture("resources/textures/file_icon.png"))->GetID();
 
 			if (isItemType(item) == FileType::Texture)
-				textureID = (void*)DataPool::GetAssetTexture(item.path().string(), true)->GetID();
+				textureID = (void*)AssetManager::Get(AssetManager::LoadProjectTexture(item.path()))->GetID();
 
 			if (ImGui::ImageButton(textureID, ImVec2(size, size), ImVec2{ 0, 1 }, ImVec2{ 1, 0 }, 0))
 				return true;
@@ -153,12 +154,12 @@ namespace PaperED
 					{
 						case FileType::Texture:
 							ImGui::SetDragDropPayload("CONTENT_BROWSER_ITEM_TEXTURE", item_path, (wcslen(item_path) + 1) * sizeof(wchar_t));
-							ImGui::Image((void*)DataPool::GetAssetTexture(item.path().string(), true)->GetID(), ImVec2(50, 50), ImVec2(0, 1), ImVec2(1, 0));
+							ImGui::Image((void*)AssetManager::Get(AssetManager::LoadProjectTexture(item.path()))->GetID(), ImVec2(50, 50), ImVec2(0, 1), ImVec2(1, 0));
 							break;
 
 						case FileType::Font:
 							ImGui::SetDragDropPayload("CONTENT_BROWSER_ITEM_FONT", item_path, (wcslen(item_path) + 1) * sizeof(wchar_t));
-							ImGui::Text(DataPool::GetFont(item.path().string(), true)->GetFontName().c_str());
+							ImGui::Text(AssetManager::Get(AssetManager::LoadFont(item.path()))->GetFontName().c_str());
 							break;
 
 						case FileType::UNDEFINED:
@@ -4,6 +4,8 @@
 #include "editor/PaperLayer.h"
 #include "editor/SelectionManager.h"
 
+#include "utils/FileSystem.h"
+
 void ApplicationPanel::OnImGuiRender(bool& isOpen)
 {
 	const float dt = Application::GetDT();
@@ -60,6 +62,60 @@ void ApplicationPanel::OnImGuiRender(bool& isOpen)
 		ImGui::TreePop();
 	}
 
+	if (ImGui::TreeNode("Simulation"))
+	{
+		FixedTimestep& timestep = Application::GetFixedTimestep();
+
+		int tickRate = (int)timestep.GetTickRate();
+		if (ImGui::DragInt("Tick Rate", &tickRate, 1.0f, 1, 1000, "%d Hz"))
+			timestep.SetTickRate((uint32_t)tickRate);
+
+		int maxTicks = (int)timestep.GetMaxTicksPerFrame();
+		if (ImGui::DragInt("Max Ticks Per Frame", &maxTicks, 0.1f, 1, 64))
+			timestep.SetMaxTicksPerFrame((uint32_t)maxTicks);
+
+		bool interpolate = timestep.IsInterpolating();
+		if (ImGui::Checkbox("Interpolation", &interpolate))
+			timestep.SetInterpolation(interpolate);
+
+		stream << "Tick: " << timestep.GetTick();
+		ImGui::BulletText(stream.str().c_str()); stream.str("");
+
+		stream << "Ticks this frame: " << timestep.GetTicksThisFrame();
+		ImGui::BulletText(stream.str().c_str()); stream.str("");
+
+		stream << "Dropped ticks: " << timestep.GetDroppedTicks();
+		ImGui::BulletText(stream.str().c_str()); stream.str("");
+
+		stream << "Tick time: " << timestep.GetTickTime() << " s";
+		ImGui::BulletText(stream.str().c_str()); stream.str("");
+
+		stream << "Real time: " << Application::GetTime() << " s";
+		ImGui::BulletText(stream.str().c_str()); stream.str("");
+
+		stream << "Interpolation alpha: " << timestep.GetAlpha();
+		ImGui::BulletText(stream.str().c_str()); stream.str("");
+
+		ImGui::Text("");
+		ImGui::TreePop();
+	}
+
+	if (ImGui::TreeNode("Frame Memory"))
+	{
+		const FrameArenaStats& arenaStats = FrameArena::GetStats();
+
+		stream << "Allocations: " << arenaStats.allocations << " (peak " << arenaStats.peakAllocations << ")";
+		ImGui::BulletText(stream.str().c_str()); stream.str("");
+
+		stream << "Allocated: " << arenaStats.bytes / 1024.0f << " KB (peak " << arenaStats.peakBytes / 1024.0f << " KB)";
+		ImGui::BulletText(stream.str().c_str()); stream.str("");
+
+		stream << "Reserved: " << arenaStats.reservedBytes / 1024.0f << " KB over " << arenaStats.threads << " threads";
+		ImGui::BulletText(stream.str().c_str()); stream.str("");
+
+		ImGui::Text("");
+		ImGui::TreePop();
+	}
 
 	if (ImGui::TreeNode("Render Stats"))
 	{
@@ -78,6 +134,112 @@ void ApplicationPanel::OnImGuiRender(bool& isOpen)
 		stream << "Indices count: " << RenderCommand::GetStats().elementCount;
 		ImGui::BulletText(stream.str().c_str()); stream.str("");
 
+		stream << "Batches flushed full: " << RenderCommand::GetStats().capacityFlushes << ", out of texture slots: " << RenderCommand::GetStats().textureFlushes;
+		ImGui::BulletText(stream.str().c_str()); stream.str("");
+
+		if (ImGui::TreeNode("Frame History"))
+		{
+			const RenderStatsHistory& history = RenderCommand::GetStatsHistory();
+
+			static std::vector<float> drawCalls, dataSize;
+			drawCalls.resize(history.GetSize());
+			dataSize.resize(history.GetSize());
+			for (uint32_t i = 0; i < history.GetSize(); i++)
+			{
+				drawCalls[i] = (float)history.Get(i).stats.drawCalls;
+				dataSize[i] = (float)history.Get(i).stats.dataSize / 1024.0f;
+			}
+
+			if (ImPlot::BeginPlot("##render_stats_history", ImVec2(-1, 150), ImPlotFlags_NoMenus))
+			{
+				ImPlot::SetupAxes(nullptr, "draw calls", ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_AutoFit);
+				ImPlot::SetupAxis(ImAxis_Y2, "KiB", ImPlotAxisFlags_AuxDefault | ImPlotAxisFlags_AutoFit);
+				ImPlot::SetupAxisLimits(ImAxis_X1, 0, RenderStatsHistory::CAPACITY, ImGuiCond_Always);
+				ImPlot::SetupLegend(ImPlotLocation_NorthWest);
+
+				ImPlot::SetAxes(ImAxis_X1, ImAxis_Y1);
+				ImPlot::PlotLine("Draw calls", drawCalls.data(), (int)drawCalls.size());
+				ImPlot::SetAxes(ImAxis_X1, ImAxis_Y2);
+				ImPlot::PlotLine("Data size", dataSize.data(), (int)dataSize.size());
+				ImPlot::EndPlot();
+			}
+
+			if (ImGui::Button("Export CSV"))
+			{
+				const std::filesystem::path filePath = FileSystem::SaveFile({ {.name = "CSV", .spec = "csv"} }, "", "render_stats.csv");
+				if (!filePath.empty())
+					history.ExportCSV(filePath);
+			}
+			ImGui::SameLine();
+			if (ImGui::Button("Export JSON"))
+			{
+				const std::filesystem::path filePath = FileSystem::SaveFile({ {.name = "JSON", .spec = "json"} }, "", "render_stats.json");
+				if (!filePath.empty())
+					history.ExportJSON(filePath);
+			}
+
+			ImGui::TreePop();
+		}
+
+		if (RenderThread::IsThreaded())
+		{
+			const RenderThreadStats& threadStats = RenderThread::GetStats();
+
+			stream << "Render thread: " << threadStats.renderTime << " ms";
+			ImGui::BulletText(stream.str().c_str()); stream.str("");
+
+			stream << "Waited on render thread: " << threadStats.waitTime << " ms";
+			ImGui::BulletText(stream.str().c_str()); stream.str("");
+
+			stream << "Commands: " << threadStats.commandCount << " (" << threadStats.commandBytes << " Bytes)";
+			ImGui::BulletText(stream.str().c_str()); stream.str("");
+		}
+
+		if (ImGui::TreeNode("GPU Passes"))
+		{
+			if (!RenderCommand::IsGPUTimingSupported())
+				ImGui::TextDisabled("Timer queries are not supported by this driver");
+
+			const std::vector<GPUPassStats> gpuPasses = RenderCommand::GetGPUPassStats();
+			if (ImGui::BeginTable("##gpu_passes", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders))
+			{
+				ImGui::TableSetupColumn("Pass");
+				ImGui::TableSetupColumn("Count");
+				ImGui::TableSetupColumn("ms");
+				ImGui::TableSetupColumn("avg ms");
+				ImGui::TableHeadersRow();
+
+				for (const GPUPassStats& pass : gpuPasses)
+				{
+					ImGui::TableNextRow();
+					ImGui::TableNextColumn();
+					ImGui::TextUnformatted(pass.name.c_str());
+					ImGui::TableNextColumn();
+					ImGui::Text("%u", pass.count);
+					ImGui::TableNextColumn();
+					ImGui::Text("%.3f", pass.lastMs);
+					ImGui::TableNextColumn();
+					ImGui::Text("%.3f", pass.averageMs);
+				}
+				ImGui::EndTable();
+			}
+
+			if (ImPlot::BeginPlot("##gpu_pass_history", ImVec2(-1, 150), ImPlotFlags_NoMenus))
+			{
+				ImPlot::SetupAxes(nullptr, "ms", ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_AutoFit);
+				ImPlot::SetupAxisLimits(ImAxis_X1, 0, GPUPassStats::HISTORY_SIZE, ImGuiCond_Always);
+				ImPlot::SetupLegend(ImPlotLocation_NorthWest);
+				for (const GPUPassStats& pass : gpuPasses)
+					ImPlot::PlotLine(pass.name.c_str(), pass.history.data(), GPUPassStats::HISTORY_SIZE, 1.0, 0.0, 0, pass.historyOffset);
+				ImPlot::EndPlot();
+			}
+
+			stream << "Frames without results yet: " << RenderCommand::GetGPUSkippedFrames();
+			ImGui::BulletText(stream.str().c_str()); stream.str("");
+
+			ImGui::TreePop();
+		}
+
 		ImGui::Text("");
 
 		stream << "Polygon Model: ";
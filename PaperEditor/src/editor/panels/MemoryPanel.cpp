@@ -0,0 +1,168 @@
+﻿#include "Editor.h"
+#include "MemoryPanel.h"
+
+#include "assets/AssetManager.h"
+#include "scripting/ScriptEngine.h"
+#include "utils/FileSystem.h"
+
+namespace PaperED
+{
+	static float ToMB(int64_t bytes)
+	{
+		return (float)(bytes / (1024.0 * 1024.0));
+	}
+
+	void MemoryPanel::OnImGuiRender(bool& isOpen)
+	{
+		ImGui::Begin(panelName.c_str(), &isOpen);
+
+		if (ImGui::Button("Capture"))
+		{
+			const std::filesystem::path filePath = FileSystem::SaveFile({ {.name = "CSV", .spec = "csv"} }, "", "memory.csv");
+			if (!filePath.empty())
+				MemoryTracker::ExportCapture(filePath);
+		}
+		ImGui::SameLine();
+		ImGui::Text("Total: %.2f MB   Peak: %.2f MB", ToMB(MemoryTracker::GetTotal()), ToMB(MemoryTracker::GetPeakTotal()));
+
+		if (ImPlot::BeginPlot("##memory_total", ImVec2(-1, 80), ImPlotFlags_CanvasOnly))
+		{
+			const auto& history = MemoryTracker::GetTotalHistory();
+			ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_AutoFit);
+			ImPlot::SetupAxisLimits(ImAxis_X1, 0, MemoryTracker::HISTORY_SIZE, ImGuiCond_Always);
+			ImPlot::PlotShaded("##bytes", history.data(), (int)history.size(), 0.0, 1.0, 0.0, 0, (int)MemoryTracker::GetTotalHistoryOffset());
+			ImPlot::EndPlot();
+		}
+
+		RenderTagTable();
+
+		if (ImGui::CollapsingHeader("Assets"))
+			RenderAssetTable();
+
+		if (ImGui::CollapsingHeader("Script GC"))
+			RenderScriptGCStats();
+
+		ImGui::End();
+	}
+
+	void MemoryPanel::RenderTagTable()
+	{
+		const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp;
+		if (!ImGui::BeginTable("##memory_tags", 6, flags))
+			return;
+
+		ImGui::TableSetupColumn("Tag");
+		ImGui::TableSetupColumn("Current (MB)");
+		ImGui::TableSetupColumn("Peak (MB)");
+		ImGui::TableSetupColumn("Budget (MB)");
+		ImGui::TableSetupColumn("Allocs");
+		ImGui::TableSetupColumn("Frees");
+		ImGui::TableHeadersRow();
+
+		for (uint32_t i = 0; i < MemoryTracker::TAG_COUNT; i++)
+		{
+			const MemoryTag tag = (MemoryTag)i;
+			const MemoryTagStats stats = MemoryTracker::GetStats(tag);
+			const bool overBudget = stats.budget > 0 && stats.current > stats.budget;
+
+			ImGui::PushID((int)i);
+			ImGui::TableNextRow();
+
+			ImGui::TableNextColumn();
+			ImGui::Text("%s%s", MemoryTagToString(tag), stats.sampled ? " (sampled)" : "");
+
+			ImGui::TableNextColumn();
+			if (overBudget)
+				ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%.2f", ToMB(stats.current));
+			else
+				ImGui::Text("%.2f", ToMB(stats.current));
+
+			ImGui::TableNextColumn();
+			ImGui::Text("%.2f", ToMB(stats.peak));
+
+			//0 means no budget
+			ImGui::TableNextColumn();
+			float budget = ToMB(stats.budget);
+			ImGui::SetNextItemWidth(-1);
+			if (ImGui::DragFloat("##budget", &budget, 1.0f, 0.0f, 65536.0f, budget > 0.0f ? "%.1f" : "none"))
+				MemoryTracker::SetBudget(tag, (int64_t)(std::max(budget, 0.0f) * 1024.0 * 1024.0));
+
+			ImGui::TableNextColumn();
+			if (stats.sampled) ImGui::TextDisabled("-");
+			else ImGui::Text("%llu", (unsigned long long)stats.allocations);
+
+			ImGui::TableNextColumn();
+			if (stats.sampled) ImGui::TextDisabled("-");
+			else ImGui::Text("%llu", (unsigned long long)stats.frees);
+
+			ImGui::PopID();
+		}
+
+		ImGui::EndTable();
+	}
+
+	void MemoryPanel::RenderAssetTable()
+	{
+		const std::vector<uint32_t> assets = AssetManager::GetLoadedAssets();
+
+		if (ImGui::Button("Unload Unused"))
+			AssetManager::UnloadUnused();
+		ImGui::SameLine();
+		ImGui::Text("%zu assets, %.2f MB", assets.size(), ToMB((int64_t)AssetManager::GetMemoryUsage()));
+
+		const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp;
+		if (!ImGui::BeginTable("##memory_assets", 5, flags))
+			return;
+
+		ImGui::TableSetupColumn("Path");
+		ImGui::TableSetupColumn("Type");
+		ImGui::TableSetupColumn("Refs");
+		ImGui::TableSetupColumn("Size (MB)");
+		ImGui::TableSetupColumn("##unload");
+		ImGui::TableHeadersRow();
+
+		for (const uint32_t id : assets)
+		{
+			const AssetMetadata* metadata = AssetManager::GetMetadata(id);
+			if (!metadata)
+				continue;
+
+			ImGui::PushID((int)id);
+			ImGui::TableNextRow();
+
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(metadata->path.string().c_str());
+
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(AssetTypeToString(metadata->type));
+
+			ImGui::TableNextColumn();
+			ImGui::Text("%u", metadata->refCount);
+
+			ImGui::TableNextColumn();
+			ImGui::Text("%.2f", ToMB((int64_t)metadata->memory));
+
+			ImGui::TableNextColumn();
+			if (metadata->pinned) ImGui::TextDisabled("pinned");
+			else if (ImGui::SmallButton("Unload")) AssetManager::Unload(id);
+
+			ImGui::PopID();
+		}
+
+		ImGui::EndTable();
+	}
+
+	void MemoryPanel::RenderScriptGCStats()
+	{
+		const ScriptGCStats& stats = ScriptEngine::GetGCStats();
+
+		ImGui::Text("Heap: %.2f MB   Used: %.2f MB", ToMB(stats.heapSize), ToMB(stats.usedSize));
+		ImGui::Text("Collections: %u minor, %u major", stats.minorCollections, stats.majorCollections);
+
+		//garbage scripts produce in OnUpdate, a collection during the update hides part of it
+		if (stats.lastUpdateCollected)
+			ImGui::Text("Allocated last update: >= %.1f KB (collected)", stats.lastUpdateAllocated / 1024.0f);
+		else
+			ImGui::Text("Allocated last update: %.1f KB", stats.lastUpdateAllocated / 1024.0f);
+	}
+}
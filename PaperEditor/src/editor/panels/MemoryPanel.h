@@ -0,0 +1,18 @@
+﻿#pragma once
+#include "EditorPanel.h"
+
+namespace PaperED
+{
+	class MemoryPanel : public EditorPanel
+	{
+	public:
+		MemoryPanel() = default;
+
+		void OnImGuiRender(bool& isOpen) override;
+
+	private:
+		void RenderTagTable();
+		void RenderAssetTable();
+		void RenderScriptGCStats();
+	};
+}
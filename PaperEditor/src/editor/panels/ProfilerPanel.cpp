@@ -0,0 +1,229 @@
+﻿#include "Editor.h"
+#include "ProfilerPanel.h"
+
+#include "generic/Hash.h"
+#include "utils/FileSystem.h"
+
+namespace PaperED
+{
+	static ImU32 GetScopeColor(const char* name)
+	{
+		const int colorCount = ImPlot::GetColormapSize(ImPlotColormap_Deep);
+		const ImVec4 color = ImPlot::GetColormapColor((int)(Hash::GenerateFNVHash(name) % colorCount), ImPlotColormap_Deep);
+		return ImGui::ColorConvertFloat4ToU32(color);
+	}
+
+	ProfilerPanel::ProfilerPanel()
+		: frameTimes(600)
+	{
+	}
+
+	void ProfilerPanel::OnImGuiRender(bool& isOpen)
+	{
+		ImGui::Begin(panelName.c_str(), &isOpen);
+
+		const ProfileFrame& lastFrame = Profiler::GetLastFrame();
+		const float frameMs = (float)(lastFrame.end - lastFrame.start) / 1e6f;
+		time += Application::GetDT();
+
+		if (!paused)
+		{
+			frame.start = lastFrame.start;
+			frame.end = lastFrame.end;
+			frame.events.assign(lastFrame.events.begin(), lastFrame.events.end());
+			frameTimes.AddPoint(time, frameMs);
+		}
+
+#ifndef PAPER_ENABLE_PROFILING
+		ImGui::TextColored(ImVec4(1.0f, 0.6f, 0.2f, 1.0f), "Built without PAPER_ENABLE_PROFILING, no scopes are recorded");
+#endif
+
+		bool enabled = Profiler::IsEnabled();
+		if (ImGui::Checkbox("Record", &enabled))
+			Profiler::SetEnabled(enabled);
+		ImGui::SameLine();
+		ImGui::Checkbox("Pause", &paused);
+		ImGui::SameLine();
+
+		if (!Profiler::IsCapturing())
+		{
+			if (ImGui::Button("Start Capture"))
+				Profiler::BeginCapture();
+		}
+		else if (ImGui::Button("Stop Capture"))
+			Profiler::EndCapture();
+
+		ImGui::SameLine();
+		ImGui::BeginDisabled(Profiler::IsCapturing() || Profiler::GetCaptureEventCount() == 0);
+		if (ImGui::Button("Export Chrome Trace"))
+		{
+			const std::filesystem::path filePath = FileSystem::SaveFile({ {.name = "Chrome Trace", .spec = "json"} }, "", "capture.json");
+			if (!filePath.empty())
+				Profiler::ExportChromeTrace(filePath);
+		}
+		ImGui::EndDisabled();
+
+		ImGui::Text("Frame: %.3f ms   Scopes: %u   Captured: %u   Dropped: %llu", frameMs, (uint32_t)frame.events.size(), (uint32_t)Profiler::GetCaptureEventCount(), (unsigned long long)Profiler::GetDroppedEvents());
+
+		if (ImPlot::BeginPlot("##profiler_frame_times", ImVec2(-1, 80), ImPlotFlags_CanvasOnly))
+		{
+			ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_AutoFit);
+			ImPlot::SetupAxisLimits(ImAxis_X1, time - 10.0f, time, ImGuiCond_Always);
+			ImPlot::PlotShaded("##ms", &frameTimes.Data[0].x, &frameTimes.Data[0].y, frameTimes.Data.size(), 0.0, 0, frameTimes.Offset, 2 * sizeof(float));
+			ImPlot::EndPlot();
+		}
+
+		if (ImGui::BeginTabBar("##profiler_tabs"))
+		{
+			if (ImGui::BeginTabItem("Flame Graph"))
+			{
+				RenderFlameGraph();
+				ImGui::EndTabItem();
+			}
+			if (ImGui::BeginTabItem("Scopes"))
+			{
+				RenderScopeTable();
+				ImGui::EndTabItem();
+			}
+			ImGui::EndTabBar();
+		}
+
+		ImGui::End();
+	}
+
+	void ProfilerPanel::RenderFlameGraph()
+	{
+		//every thread gets a band of rows, one per nesting depth
+		const std::vector<std::string> threadNames = Profiler::GetThreadNames();
+		std::vector<uint32_t> threadDepth(threadNames.size(), 0);
+		for (const ProfileEvent& event : frame.events)
+			if (event.threadIndex < threadDepth.size())
+				threadDepth[event.threadIndex] = std::max(threadDepth[event.threadIndex], event.depth + 1);
+
+		std::vector<double> threadRow(threadNames.size(), 0.0);
+		double rows = 0.0;
+		for (size_t i = 0; i < threadNames.size(); i++)
+		{
+			if (!threadDepth[i]) continue;
+			threadRow[i] = rows;
+			rows += threadDepth[i] + 0.5;
+		}
+
+		//scopes of a thread that is behind can start before the frame did
+		uint64_t origin = frame.start;
+		for (const ProfileEvent& event : frame.events)
+			origin = std::min(origin, event.start);
+		const double frameMs = (double)(frame.end - origin) / 1e6;
+
+		if (!ImPlot::BeginPlot("##flame_graph", ImVec2(-1, -1), ImPlotFlags_NoLegend | ImPlotFlags_NoMenus | ImPlotFlags_NoMouseText))
+			return;
+
+		ImPlot::SetupAxes("ms", nullptr, ImPlotAxisFlags_None, ImPlotAxisFlags_Invert | ImPlotAxisFlags_NoDecorations | ImPlotAxisFlags_Lock);
+		ImPlot::SetupAxisLimits(ImAxis_X1, 0.0, std::max(frameMs, 0.001), ImPlotCond_Once);
+		ImPlot::SetupAxisLimits(ImAxis_Y1, 0.0, std::max(rows, 1.0), ImPlotCond_Always);
+
+		ImDrawList* drawList = ImPlot::GetPlotDrawList();
+		const ImPlotPoint mouse = ImPlot::GetPlotMousePos();
+		const ProfileEvent* hovered = nullptr;
+
+		ImPlot::PushPlotClipRect();
+		for (const ProfileEvent& event : frame.events)
+		{
+			if (event.threadIndex >= threadRow.size())
+				continue;
+
+			const double x0 = (double)(event.start - origin) / 1e6;
+			const double x1 = (double)(event.end - origin) / 1e6;
+			const double y0 = threadRow[event.threadIndex] + event.depth;
+			const double y1 = y0 + 1.0;
+
+			const ImVec2 min = ImPlot::PlotToPixels(x0, y0);
+			const ImVec2 max = ImPlot::PlotToPixels(x1, y1);
+			if (max.x - min.x < 1.0f)
+				continue;
+
+			drawList->AddRectFilled(min, max, GetScopeColor(event.name));
+			drawList->AddRect(min, max, IM_COL32(0, 0, 0, 120));
+
+			const ImVec2 textSize = ImGui::CalcTextSize(event.name);
+			if (textSize.x + 4.0f < max.x - min.x)
+				drawList->AddText(ImVec2(min.x + 2.0f, min.y + (max.y - min.y - textSize.y) * 0.5f), IM_COL32(255, 255, 255, 255), event.name);
+
+			if (ImPlot::IsPlotHovered() && mouse.x >= x0 && mouse.x <= x1 && mouse.y >= y0 && mouse.y <= y1)
+				hovered = &event;
+		}
+
+		for (size_t i = 0; i < threadNames.size(); i++)
+		{
+			if (!threadDepth[i]) continue;
+			drawList->AddText(ImPlot::PlotToPixels(ImPlot::GetPlotLimits().X.Min, threadRow[i] + threadDepth[i]), IM_COL32(200, 200, 200, 255), threadNames[i].c_str());
+		}
+		ImPlot::PopPlotClipRect();
+
+		if (hovered)
+		{
+			ImGui::BeginTooltip();
+			ImGui::TextUnformatted(hovered->name);
+			ImGui::Text("%.3f ms", (double)(hovered->end - hovered->start) / 1e6);
+			if (hovered->threadIndex < threadNames.size())
+				ImGui::TextDisabled("%s", threadNames[hovered->threadIndex].c_str());
+			ImGui::EndTooltip();
+		}
+
+		ImPlot::EndPlot();
+	}
+
+	void ProfilerPanel::RenderScopeTable()
+	{
+		struct ScopeTotal
+		{
+			const char* name = nullptr;
+			uint32_t calls = 0;
+			uint64_t total = 0;
+			uint64_t max = 0;
+		};
+
+		//scope names are literals, so the pointer identifies the scope
+		std::unordered_map<const char*, ScopeTotal> totals;
+		for (const ProfileEvent& event : frame.events)
+		{
+			ScopeTotal& scope = totals[event.name];
+			const uint64_t duration = event.end - event.start;
+			scope.name = event.name;
+			scope.calls++;
+			scope.total += duration;
+			scope.max = std::max(scope.max, duration);
+		}
+
+		std::vector<ScopeTotal> sorted;
+		sorted.reserve(totals.size());
+		for (const ScopeTotal& scope : totals | std::views::values)
+			sorted.push_back(scope);
+		std::sort(sorted.begin(), sorted.end(), [](const ScopeTotal& a, const ScopeTotal& b) { return a.total > b.total; });
+
+		if (!ImGui::BeginTable("##profiler_scopes", 4, ImGuiTableFlags_RowBg | ImGuiTableFlags_Borders | ImGuiTableFlags_ScrollY))
+			return;
+
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn("Scope");
+		ImGui::TableSetupColumn("Calls");
+		ImGui::TableSetupColumn("Total (ms)");
+		ImGui::TableSetupColumn("Max (ms)");
+		ImGui::TableHeadersRow();
+
+		for (const ScopeTotal& scope : sorted)
+		{
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn();
+			ImGui::TextUnformatted(scope.name);
+			ImGui::TableNextColumn();
+			ImGui::Text("%u", scope.calls);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", (double)scope.total / 1e6);
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", (double)scope.max / 1e6);
+		}
+
+		ImGui::EndTable();
+	}
+}
@@ -0,0 +1,23 @@
+﻿#pragma once
+#include "EditorPanel.h"
+
+namespace PaperED
+{
+	class ProfilerPanel : public EditorPanel
+	{
+	public:
+		ProfilerPanel();
+
+		void OnImGuiRender(bool& isOpen) override;
+
+	private:
+		void RenderFlameGraph();
+		void RenderScopeTable();
+
+		ProfileFrame frame;
+		bool paused = false;
+
+		ScrollingBuffer frameTimes;
+		float time = 0.0f;
+	};
+}
@@ -1,6 +1,7 @@
 ﻿#include "Editor.h"
 #include "PropertiesPanel.h"
 
+#include "assets/AssetManager.h"
 #include "editor/SelectionManager.h"
 
 #include "editor/PaperLayer.h"
@@ -194,8 +195,8 @@ namespace PaperED
 		ImGui::Text("Name:");
 		ImGui::SameLine();
 		std::string name = selectedEntity.GetName();
-		ImGui::InputText(("##" + selectedEntity.GetPaperID().toString()).c_str(), &name);
-		selectedEntity.SetName(name);
+		if (ImGui::InputText(("##" + selectedEntity.GetPaperID().toString()).c_str(), &name))
+			selectedEntity.SetName(name);
 
 		ImGui::Text(("UUID: " + selectedEntity.GetPaperID().toString()).c_str());
 
@@ -206,25 +207,34 @@ namespace PaperED
 			DrawComponentToAddPopup<LineComponent>("Line Component");
 			DrawComponentToAddPopup<TextComponent>("Text Component");
 			DrawComponentToAddPopup<ScriptComponent>("Script Component");
+			DrawComponentToAddPopup<Rigidbody2DComponent>("Rigidbody 2D Component");
+			DrawComponentToAddPopup<BoxCollider2DComponent>("Box Collider 2D Component");
+			DrawComponentToAddPopup<CircleCollider2DComponent>("Circle Collider 2D Component");
 			ImGui::EndPopup();
 		}
 
 		DrawComponent<DataComponent>("Tag Component", false, [](DataComponent& dc, Entity entity)
 			{
+				//edit a copy so the scene tag index is updated through the entity
+				std::vector<std::string> tags = dc.tags;
+				bool changed = false;
 				int i = 0;
-				for (auto& tag : dc.tags)
+				for (auto& tag : tags)
 				{
-					ImGui::InputText(("##" + std::to_string(i)).c_str(), &tag);
+					changed |= ImGui::InputText(("##" + std::to_string(i)).c_str(), &tag);
 					i++;
 				}
-				if (dc.tags.empty())
+				if (tags.empty())
 				{
 					ImGui::Text("No tags...");
 				}
 				if (ImGui::Button("Add Tag"))
 				{
-					dc.tags.emplace_back("");
+					tags.emplace_back("");
+					changed = true;
 				};
+				if (changed)
+					entity.SetTags(tags);
 			});
 
 
@@ -356,7 +366,7 @@ namespace PaperED
 							const wchar_t* path = (const wchar_t*)payload->Data;
 							std::string file = std::filesystem::path(path).string();
 
-							sc.texture = DataPool::GetAssetTexture(file, true);
+							sc.texture = AssetManager::LoadProjectTexture(file);
 						}
 						ImGui::EndDragDropTarget();
 					}
@@ -413,6 +423,54 @@ namespace PaperED
 				}
 			});
 
+		DrawComponent<Rigidbody2DComponent>("Rigidbody 2D Component", true, [](Rigidbody2DComponent& rb, Entity entity)
+			{
+				{
+					ContentTable type_section(ImGui::CalcTextSize("Body Type").x);
+					FillNameCol("Body Type");
+
+					ImGui::SetNextItemWidth(ImGui::GetContentRegionAvail().x);
+					if (ImGui::BeginCombo(CONST_UI_ID, BodyType2DToString(rb.type).c_str()))
+					{
+						for (int i = 0; i <= (int)BodyType2D::_LAST; i++)
+						{
+							if (ImGui::Selectable(BodyType2DToString((BodyType2D)i).c_str(), rb.type == (BodyType2D)i))
+							{
+								rb.type = (BodyType2D)i;
+							}
+						}
+						ImGui::EndCombo();
+					}
+				}
+
+				{
+					ContentTable body_section(ImGui::CalcTextSize("Linear Damping").x);
+					Draw2FloatControl("Velocity", rb.velocity);
+					DrawFloatControl("Mass", rb.mass, 0.001f, 0.0f, 0.1f, 1.0f, { "MA" });
+					DrawFloatControl("Gravity Scale", rb.gravityScale, 0.0f, 0.0f, 0.1f, 1.0f, { "GS" });
+					DrawFloatControl("Linear Damping", rb.linearDamping, 0.0f, 0.0f, 0.05f, 0.0f, { "LD" });
+					DrawCheckbox("Allow Sleep", rb.allowSleep);
+				}
+			});
+
+		DrawComponent<BoxCollider2DComponent>("Box Collider 2D Component", true, [](BoxCollider2DComponent& bc, Entity entity)
+			{
+				ContentTable collider_section(ImGui::CalcTextSize("Restitution").x);
+				Draw2FloatControl("Offset", bc.offset);
+				Draw2FloatControl("Size", bc.size, glm::vec2(0.0f), glm::vec2(0.0f), glm::vec2(0.1f), glm::vec2(1.0f));
+				DrawFloatControl("Friction", bc.friction, 0.0f, 0.0f, 0.05f, 0.4f, { "FR" });
+				DrawFloatControl("Restitution", bc.restitution, 0.0f, 1.0f, 0.05f, 0.0f, { "RE" });
+			});
+
+		DrawComponent<CircleCollider2DComponent>("Circle Collider 2D Component", true, [](CircleCollider2DComponent& cc, Entity entity)
+			{
+				ContentTable collider_section(ImGui::CalcTextSize("Restitution").x);
+				Draw2FloatControl("Offset", cc.offset);
+				DrawFloatControl("Radius", cc.radius, 0.0f, 0.0f, 0.05f, 0.5f, { "RA" });
+				DrawFloatControl("Friction", cc.friction, 0.0f, 0.0f, 0.05f, 0.4f, { "FR" });
+				DrawFloatControl("Restitution", cc.restitution, 0.0f, 1.0f, 0.05f, 0.0f, { "RE" });
+			});
+
 		DrawComponent<TextComponent>("Text Component", true, [](TextComponent& texc, Entity entity)
 			{
 				{
@@ -433,7 +491,7 @@ namespace PaperED
 					FillNameCol("Font");
 
 
-					ImGui::Button(texc.font->GetFontName().c_str());
+					ImGui::Button(texc.font ? texc.font->GetFontName().c_str() : "None");
 
 					if (ImGui::BeginDragDropTarget())
 					{
@@ -442,7 +500,7 @@ namespace PaperED
 							const wchar_t* path = (const wchar_t*)payload->Data;
 							std::string file = std::filesystem::path(path).string();
 
-							texc.font = DataPool::GetFont(file, true);
+							texc.font = AssetManager::LoadFont(file);
 						}
 						ImGui::EndDragDropTarget();
 					}
@@ -461,7 +519,7 @@ namespace PaperED
 
 		DrawComponent<ScriptComponent>("Script Component", true, [this](ScriptComponent& scrc, Entity entity)
 			{
-				ManagedClass* managedClass = ScriptEngine::GetEntityInheritClass(scrc.scriptClassName);
+				ManagedClass* managedClass = ScriptEngine::GetEntityInheritClass(scrc.scriptClassID);
 				{
 					ContentTable scriptClassSection(ImGui::CalcTextSize("C#-Class").x);
 					FillNameCol("C#-Class");
@@ -479,7 +537,7 @@ namespace PaperED
 						{
 							if (ImGui::Selectable(lmanagedClass->fullClassName.c_str(), managedClass == lmanagedClass) && managedClass != lmanagedClass)
 							{
-								scrc.scriptClassName = lmanagedClass->fullClassName;
+								scrc.SetScriptClass(lmanagedClass->fullClassName);
 								ScriptEngine::CreateScriptEntity(entity);
 							}
 						}
@@ -0,0 +1,214 @@
+﻿#include "Editor.h"
+#include "ScriptProfilerPanel.h"
+
+#include "scripting/ScriptEngine.h"
+#include "utils/FileSystem.h"
+
+namespace PaperED
+{
+	enum ClassColumn
+	{
+		ClassColumn_Name,
+		ClassColumn_Total,
+		ClassColumn_OnCreate,
+		ClassColumn_OnUpdate,
+		ClassColumn_OnDestroy,
+		ClassColumn_Average,
+		ClassColumn_Peak,
+		ClassColumn_Allocated,
+		ClassColumn_Exceptions,
+
+		ClassColumn_Count
+	};
+
+	static float GetSortValue(const ScriptClassProfile& profile, int column)
+	{
+		switch (column)
+		{
+			case ClassColumn_Total: return profile.GetTime();
+			case ClassColumn_OnCreate: return profile.callbacks[(uint32_t)ScriptCallback::OnCreate].time;
+			case ClassColumn_OnUpdate: return profile.callbacks[(uint32_t)ScriptCallback::OnUpdate].time;
+			case ClassColumn_OnDestroy: return profile.callbacks[(uint32_t)ScriptCallback::OnDestroy].time;
+			case ClassColumn_Average: return profile.GetAverageTime();
+			case ClassColumn_Peak: return profile.peakTime;
+			case ClassColumn_Allocated: return (float)profile.allocated;
+			case ClassColumn_Exceptions: return (float)profile.totalExceptions;
+			default: return 0.0f;
+		}
+	}
+
+	void ScriptProfilerPanel::OnImGuiRender(bool& isOpen)
+	{
+		ImGui::Begin(panelName.c_str(), &isOpen);
+
+		bool enabled = ScriptProfiler::IsEnabled();
+		if (ImGui::Checkbox("Record", &enabled))
+			ScriptProfiler::SetEnabled(enabled);
+		ImGui::SameLine();
+		if (ImGui::Button("Reset"))
+			ScriptProfiler::Reset();
+		ImGui::SameLine();
+		if (ImGui::Button("Export JSON"))
+		{
+			const std::filesystem::path filePath = FileSystem::SaveFile({ {.name = "JSON", .spec = "json"} }, "", "script_profile.json");
+			if (!filePath.empty())
+				ScriptProfiler::ExportJson(filePath);
+		}
+		ImGui::SameLine();
+		ImGui::Text("Frames: %u", ScriptProfiler::GetFrameCount());
+
+		//times are of the last finished frame, select a class for its history
+		RenderClassTable();
+		RenderClassHistory();
+
+		if (ImGui::CollapsingHeader("Entities"))
+			RenderEntityTable();
+
+		ImGui::End();
+	}
+
+	void ScriptProfilerPanel::RenderClassTable()
+	{
+		const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_Sortable | ImGuiTableFlags_ScrollY;
+		if (!ImGui::BeginTable("##script_classes", ClassColumn_Count, flags, ImVec2(0.0f, 200.0f)))
+			return;
+
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn("Class", ImGuiTableColumnFlags_NoSort);
+		ImGui::TableSetupColumn("Total (ms)", ImGuiTableColumnFlags_DefaultSort | ImGuiTableColumnFlags_PreferSortDescending);
+		ImGui::TableSetupColumn("OnCreate", ImGuiTableColumnFlags_PreferSortDescending);
+		ImGui::TableSetupColumn("OnUpdate", ImGuiTableColumnFlags_PreferSortDescending);
+		ImGui::TableSetupColumn("OnDestroy", ImGuiTableColumnFlags_PreferSortDescending);
+		ImGui::TableSetupColumn("Avg (ms)", ImGuiTableColumnFlags_PreferSortDescending);
+		ImGui::TableSetupColumn("Peak (ms)", ImGuiTableColumnFlags_PreferSortDescending);
+		ImGui::TableSetupColumn("Alloc (KB)", ImGuiTableColumnFlags_PreferSortDescending);
+		ImGui::TableSetupColumn("Exceptions", ImGuiTableColumnFlags_PreferSortDescending);
+		ImGui::TableHeadersRow();
+
+		std::vector<const ScriptClassProfile*> profiles;
+		for (const ScriptClassProfile& profile : ScriptProfiler::GetClassProfiles() | std::views::values)
+			profiles.push_back(&profile);
+
+		if (const ImGuiTableSortSpecs* sortSpecs = ImGui::TableGetSortSpecs(); sortSpecs && sortSpecs->SpecsCount > 0)
+		{
+			const int column = sortSpecs->Specs[0].ColumnIndex;
+			const bool ascending = sortSpecs->Specs[0].SortDirection == ImGuiSortDirection_Ascending;
+			std::sort(profiles.begin(), profiles.end(), [column, ascending](const ScriptClassProfile* a, const ScriptClassProfile* b)
+			{
+				const float valueA = GetSortValue(*a, column);
+				const float valueB = GetSortValue(*b, column);
+				return ascending ? valueA < valueB : valueA > valueB;
+			});
+		}
+
+		for (const ScriptClassProfile* profile : profiles)
+		{
+			ImGui::PushID((int)profile->classID);
+			ImGui::TableNextRow();
+
+			ImGui::TableNextColumn();
+			if (ImGui::Selectable(profile->className.c_str(), selectedClass == profile->classID, ImGuiSelectableFlags_SpanAllColumns))
+				selectedClass = profile->classID;
+
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", profile->GetTime());
+
+			for (const ScriptCallbackStats& stats : profile->callbacks)
+			{
+				ImGui::TableNextColumn();
+				if (stats.calls) ImGui::Text("%.3f (%u)", stats.time, stats.calls);
+				else ImGui::TextDisabled("-");
+			}
+
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", profile->GetAverageTime());
+
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", profile->peakTime);
+
+			ImGui::TableNextColumn();
+			ImGui::Text("%.1f", profile->allocated / 1024.0f);
+
+			ImGui::TableNextColumn();
+			if (profile->totalExceptions) ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "%u", profile->totalExceptions);
+			else ImGui::Text("0");
+
+			ImGui::PopID();
+		}
+
+		ImGui::EndTable();
+	}
+
+	void ScriptProfilerPanel::RenderClassHistory()
+	{
+		const auto& profiles = ScriptProfiler::GetClassProfiles();
+		const auto it = profiles.find(selectedClass);
+		if (it == profiles.end())
+			return;
+
+		const ScriptClassProfile& profile = it->second;
+		if (ImPlot::BeginPlot("##script_class_history", ImVec2(-1, 100), ImPlotFlags_CanvasOnly))
+		{
+			ImPlot::SetupAxes(nullptr, "ms", ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_AutoFit);
+			ImPlot::SetupAxisLimits(ImAxis_X1, 0, ScriptClassProfile::HISTORY_SIZE, ImGuiCond_Always);
+			ImPlot::PlotShaded(profile.className.c_str(), profile.history.data(), (int)profile.history.size(), 0.0, 1.0, 0.0, 0, (int)profile.historyOffset);
+			ImPlot::EndPlot();
+		}
+	}
+
+	void ScriptProfilerPanel::RenderEntityTable()
+	{
+		struct EntityRow
+		{
+			PaperID entityID;
+			const ScriptEntityProfile* profile = nullptr;
+			float time = 0.0f;
+		};
+
+		//only the selected class when there is one
+		std::vector<EntityRow> rows;
+		for (const auto& [entityID, profile] : ScriptProfiler::GetEntityProfiles())
+		{
+			if (selectedClass && profile.classID != selectedClass) continue;
+
+			float time = 0.0f;
+			for (const float callbackTime : profile.time)
+				time += callbackTime;
+			rows.push_back({ entityID, &profile, time });
+		}
+		std::sort(rows.begin(), rows.end(), [](const EntityRow& a, const EntityRow& b) { return a.time > b.time; });
+
+		const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingStretchProp | ImGuiTableFlags_ScrollY;
+		if (!ImGui::BeginTable("##script_entities", 5, flags, ImVec2(0.0f, 200.0f)))
+			return;
+
+		ImGui::TableSetupScrollFreeze(0, 1);
+		ImGui::TableSetupColumn("Entity");
+		ImGui::TableSetupColumn("Total (ms)");
+		ImGui::TableSetupColumn("OnCreate");
+		ImGui::TableSetupColumn("OnUpdate");
+		ImGui::TableSetupColumn("OnDestroy");
+		ImGui::TableHeadersRow();
+
+		Scene* scene = ScriptEngine::GetSceneContext();
+		for (const EntityRow& row : rows)
+		{
+			ImGui::TableNextRow();
+
+			ImGui::TableNextColumn();
+			Entity entity = scene ? scene->GetEntity(row.entityID) : Entity();
+			ImGui::TextUnformatted(entity ? entity.GetName().c_str() : row.entityID.toString().c_str());
+
+			ImGui::TableNextColumn();
+			ImGui::Text("%.3f", row.time);
+
+			for (const float callbackTime : row.profile->time)
+			{
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", callbackTime);
+			}
+		}
+
+		ImGui::EndTable();
+	}
+}
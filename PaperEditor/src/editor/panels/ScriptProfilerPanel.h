@@ -0,0 +1,22 @@
+﻿#pragma once
+#include "EditorPanel.h"
+
+#include "scripting/ScriptProfiler.h"
+
+namespace PaperED
+{
+	class ScriptProfilerPanel : public EditorPanel
+	{
+	public:
+		ScriptProfilerPanel() = default;
+
+		void OnImGuiRender(bool& isOpen) override;
+
+	private:
+		void RenderClassTable();
+		void RenderClassHistory();
+		void RenderEntityTable();
+
+		CacheID selectedClass = 0;
+	};
+}
@@ -42,7 +42,7 @@ project "engine"
 
 	defines 
 	{
-		"_CRT_SECURE_NO_WARNIN_INCLUDE_NONE"
+		"_CRT_SECURE_NO_WARNIN_INCLUDE_NONE",
 		--"GLM_FORCE_XYZW_ONLY"
 	}
 
@@ -90,7 +90,8 @@ project "engine"
 		}
 
 	filter "configurations:Debug"
-		defines { "BUILD_DEBUG", "CORE_ENABLE_ASSERTS" }
+		defines { "BUILD_DEBUG", "CORE_ENABLE_ASSERTS", "PAPER_ENABLE_PROFILING" }
+		--PAPER_ENABLE_PROFILING compiles the PAPER_PROFILE_* macros in, add it to Release to profile optimized builds
 		symbols "On"
 
 	filter "configurations:Release"
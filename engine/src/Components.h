@@ -8,6 +8,9 @@
 #include "core/component/SpriteComponent.h"
 #include "core/component/TextComponent.h"
 #include "core/component/TransformComponent.h"
+#include "core/component/Rigidbody2DComponent.h"
+#include "core/component/BoxCollider2DComponent.h"
+#include "core/component/CircleCollider2DComponent.h"
 #include "core/component/2D/SpriteSheet.h"
 
 namespace Paper {
@@ -20,6 +23,7 @@ namespace Paper {
     using AllComponents =
         ComponentGroup<TransformComponent,
         SpriteComponent, LineComponent, TextComponent,
-        CameraComponent, ScriptComponent>;
+        CameraComponent, ScriptComponent,
+        Rigidbody2DComponent, BoxCollider2DComponent, CircleCollider2DComponent>;
 
 }
\ No newline at end of file
@@ -24,6 +24,7 @@
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include <ranges>
 
@@ -63,6 +64,9 @@
 
 //Core
 #include "core/utils/Log.h"
+#include "core/utils/Profiler.h"
+#include "core/utils/MemoryTracker.h"
+#include "core/utils/FrameArena.h"
 
 
 #ifdef CORE_PLATFORM_WINDOWS
@@ -0,0 +1,258 @@
+#include "Engine.h"
+#include "AssetManager.h"
+
+#include "project/Project.h"
+#include "renderer/Font.h"
+#include "renderer/Shader.h"
+#include "renderer/Texture.h"
+
+namespace Paper
+{
+	static constexpr uint32_t INDEX_BITS = 24;
+	static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+
+	struct AssetSlot
+	{
+		Shr<void> asset;
+		AssetMetadata metadata;
+		uint8_t generation = 0;
+	};
+
+	struct AssetManagerData
+	{
+		std::vector<AssetSlot> slots;
+		std::vector<uint32_t> freeSlots;
+		std::unordered_map<std::string, uint32_t> pathIndex; //generic path -> id
+
+		AssetHandle<Font> defaultFont;
+	};
+
+	static AssetManagerData* asset_data = nullptr;
+
+	const char* AssetTypeToString(AssetType type)
+	{
+		switch (type)
+		{
+			case AssetType::Texture: return "Texture";
+			case AssetType::Font: return "Font";
+			case AssetType::Shader: return "Shader";
+			default: break;
+		}
+		return "None";
+	}
+
+	//nullptr for stale or invalid ids
+	static AssetSlot* GetSlot(uint32_t id)
+	{
+		if (!asset_data || !id)
+			return nullptr;
+
+		const uint32_t index = (id & INDEX_MASK) - 1;
+		if (index >= asset_data->slots.size())
+			return nullptr;
+
+		AssetSlot& slot = asset_data->slots[index];
+		if (slot.generation != (uint8_t)(id >> INDEX_BITS) || !slot.asset)
+			return nullptr;
+		return &slot;
+	}
+
+	void AssetManager::Init()
+	{
+		asset_data = new AssetManagerData();
+	}
+
+	void AssetManager::Shutdown()
+	{
+		delete asset_data;
+		asset_data = nullptr;
+	}
+
+	uint32_t AssetManager::Register(AssetType type, const std::filesystem::path& path, const std::function<Shr<void>(size_t& outMemory)>& load)
+	{
+		CORE_ASSERT(asset_data, "AssetManager is not initialized");
+
+		const std::string key = path.generic_string();
+		if (const auto it = asset_data->pathIndex.find(key); it != asset_data->pathIndex.end())
+		{
+			const AssetSlot* slot = GetSlot(it->second);
+			if (slot && slot->metadata.type == type)
+				return it->second;
+			if (slot)
+			{
+				LOG_CORE_ERROR("'{}' is already loaded as a {}", key, AssetTypeToString(slot->metadata.type));
+				return 0;
+			}
+		}
+
+		size_t memory = 0;
+		Shr<void> asset = load(memory);
+		if (!asset)
+			return 0;
+
+		uint32_t index;
+		if (!asset_data->freeSlots.empty())
+		{
+			index = asset_data->freeSlots.back();
+			asset_data->freeSlots.pop_back();
+		}
+		else
+		{
+			CORE_ASSERT(asset_data->slots.size() < INDEX_MASK, "too many assets");
+			index = (uint32_t)asset_data->slots.size();
+			asset_data->slots.emplace_back();
+		}
+
+		AssetSlot& slot = asset_data->slots[index];
+		slot.asset = std::move(asset);
+		slot.metadata = AssetMetadata();
+		slot.metadata.type = type;
+		slot.metadata.path = path;
+		slot.metadata.memory = memory;
+
+		const uint32_t id = ((uint32_t)slot.generation << INDEX_BITS) | (index + 1);
+		asset_data->pathIndex[key] = id;
+		return id;
+	}
+
+	static size_t TextureMemory(const Shr<Texture>& texture)
+	{
+		return texture ? (size_t)texture->GetWidth() * texture->GetHeight() * 4 : 0;
+	}
+
+	AssetHandle<Texture> AssetManager::LoadTexture(const std::filesystem::path& path)
+	{
+		return { Register(AssetType::Texture, path, [&](size_t& outMemory) -> Shr<void>
+		{
+			PAPER_PROFILE_SCOPE("AssetManager::LoadTexture");
+			Shr<Texture> texture = Texture::CreateTexture(path, path.filename().string());
+			outMemory = TextureMemory(texture);
+			return texture;
+		}) };
+	}
+
+	AssetHandle<Texture> AssetManager::LoadProjectTexture(const std::filesystem::path& path)
+	{
+		return LoadTexture(Project::GetProjectPath() / path);
+	}
+
+	AssetHandle<Font> AssetManager::LoadFont(const std::filesystem::path& path)
+	{
+		return { Register(AssetType::Font, path, [&](size_t& outMemory) -> Shr<void>
+		{
+			PAPER_PROFILE_SCOPE("AssetManager::LoadFont");
+			Shr<Font> font = MakeShr<Font>(path);
+			outMemory = TextureMemory(font->GetAtlasTexture());
+			return font;
+		}) };
+	}
+
+	AssetHandle<Shader> AssetManager::LoadShader(const std::string& name)
+	{
+		const std::filesystem::path path = "resources/shaders/" + name + ".glsl";
+		return { Register(AssetType::Shader, path, [&](size_t&) -> Shr<void>
+		{
+			PAPER_PROFILE_SCOPE("AssetManager::LoadShader");
+			return Shader::CreateShader(path.string());
+		}) };
+	}
+
+	AssetHandle<Font> AssetManager::GetDefaultFont()
+	{
+		if (!asset_data->defaultFont)
+		{
+			asset_data->defaultFont = LoadFont("resources/fonts/mononoki.ttf");
+			if (AssetSlot* slot = GetSlot(asset_data->defaultFont.id))
+				slot->metadata.pinned = true;
+		}
+		return asset_data->defaultFont;
+	}
+
+	void* AssetManager::GetAsset(uint32_t id, AssetType type)
+	{
+		const AssetSlot* slot = GetSlot(id);
+		return slot && slot->metadata.type == type ? slot->asset.get() : nullptr;
+	}
+
+	Shr<void> AssetManager::GetAssetShared(uint32_t id, AssetType type)
+	{
+		const AssetSlot* slot = GetSlot(id);
+		return slot && slot->metadata.type == type ? slot->asset : nullptr;
+	}
+
+	const AssetMetadata* AssetManager::GetMetadata(uint32_t id)
+	{
+		const AssetSlot* slot = GetSlot(id);
+		return slot ? &slot->metadata : nullptr;
+	}
+
+	void AssetManager::Retain(uint32_t id)
+	{
+		if (AssetSlot* slot = GetSlot(id))
+			slot->metadata.refCount++;
+	}
+
+	void AssetManager::Release(uint32_t id)
+	{
+		if (AssetSlot* slot = GetSlot(id); slot && slot->metadata.refCount)
+			slot->metadata.refCount--;
+	}
+
+	bool AssetManager::Unload(uint32_t id)
+	{
+		AssetSlot* slot = GetSlot(id);
+		if (!slot || slot->metadata.pinned)
+			return false;
+
+		if (slot->metadata.refCount)
+			LOG_CORE_WARN("Unloading '{}' while it still has {} references", slot->metadata.path.string(), slot->metadata.refCount);
+
+		asset_data->pathIndex.erase(slot->metadata.path.generic_string());
+
+		//gpu objects are released behind the commands still using them
+		slot->asset.reset();
+		slot->metadata = AssetMetadata();
+		slot->generation++;
+		asset_data->freeSlots.push_back((id & INDEX_MASK) - 1);
+		return true;
+	}
+
+	uint32_t AssetManager::UnloadUnused()
+	{
+		uint32_t count = 0;
+		for (const uint32_t id : GetLoadedAssets())
+		{
+			const AssetMetadata* metadata = GetMetadata(id);
+			if (!metadata->refCount && Unload(id))
+				count++;
+		}
+		return count;
+	}
+
+	std::vector<uint32_t> AssetManager::GetLoadedAssets()
+	{
+		std::vector<uint32_t> ids;
+		if (!asset_data)
+			return ids;
+
+		for (uint32_t i = 0; i < asset_data->slots.size(); i++)
+		{
+			const AssetSlot& slot = asset_data->slots[i];
+			if (slot.asset)
+				ids.push_back(((uint32_t)slot.generation << INDEX_BITS) | (i + 1));
+		}
+		return ids;
+	}
+
+	size_t AssetManager::GetMemoryUsage()
+	{
+		size_t memory = 0;
+		if (!asset_data)
+			return memory;
+
+		for (const AssetSlot& slot : asset_data->slots)
+			if (slot.asset)
+				memory += slot.metadata.memory;
+		return memory;
+	}
+}
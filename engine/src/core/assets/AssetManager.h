@@ -0,0 +1,161 @@
+#pragma once
+#include "Engine.h"
+#include "utility.h"
+
+namespace Paper
+{
+	class Texture;
+	class Font;
+	class Shader;
+
+	enum class AssetType : uint8_t
+	{
+		None,
+		Texture,
+		Font,
+		Shader
+	};
+
+	const char* AssetTypeToString(AssetType type);
+
+	template<typename T> struct AssetTraits;
+	template<> struct AssetTraits<Texture> { static constexpr AssetType type = AssetType::Texture; };
+	template<> struct AssetTraits<Font> { static constexpr AssetType type = AssetType::Font; };
+	template<> struct AssetTraits<Shader> { static constexpr AssetType type = AssetType::Shader; };
+
+	// Non owning, trivially copyable reference to a loaded asset. Resolving a handle is an index and a
+	// generation check, a handle to an unloaded asset resolves to nullptr.
+	template<typename T>
+	struct AssetHandle
+	{
+		uint32_t id = 0; //slot + 1 in the low 24 bits, slot generation in the high 8, 0 is invalid
+
+		explicit operator bool() const { return id != 0; }
+		bool operator==(const AssetHandle& other) const = default;
+	};
+
+	struct AssetMetadata
+	{
+		AssetType type = AssetType::None;
+		std::filesystem::path path;
+		uint32_t refCount = 0; //AssetRefs alive, main thread only
+		size_t memory = 0; //bytes, estimated for gpu resources
+		bool pinned = false; //engine defaults, never unloaded
+	};
+
+	// Owner of every texture, font and shader, keyed by path. Loading an asset twice returns the same handle.
+	// Assets stay cached while unreferenced until Unload or UnloadUnused.
+	class AssetManager
+	{
+	public:
+		static void Init();
+		static void Shutdown();
+
+		//engine relative (or absolute) paths
+		static AssetHandle<Texture> LoadTexture(const std::filesystem::path& path);
+		//relative to the project directory
+		static AssetHandle<Texture> LoadProjectTexture(const std::filesystem::path& path);
+		static AssetHandle<Font> LoadFont(const std::filesystem::path& path);
+		//by name from resources/shaders
+		static AssetHandle<Shader> LoadShader(const std::string& name);
+
+		//loaded on first use and never unloaded
+		static AssetHandle<Font> GetDefaultFont();
+
+		template<typename T>
+		static T* Get(AssetHandle<T> handle)
+		{
+			return (T*)GetAsset(handle.id, AssetTraits<T>::type);
+		}
+
+		template<typename T>
+		static Shr<T> GetShared(AssetHandle<T> handle)
+		{
+			return std::static_pointer_cast<T>(GetAssetShared(handle.id, AssetTraits<T>::type));
+		}
+
+		static const AssetMetadata* GetMetadata(uint32_t id);
+		template<typename T>
+		static const AssetMetadata* GetMetadata(AssetHandle<T> handle) { return GetMetadata(handle.id); }
+
+		static void Retain(uint32_t id);
+		static void Release(uint32_t id);
+
+		//frees the asset now, handles still pointing at it resolve to nullptr afterwards
+		static bool Unload(uint32_t id);
+		//frees every asset without references
+		static uint32_t UnloadUnused();
+
+		static std::vector<uint32_t> GetLoadedAssets();
+		static size_t GetMemoryUsage();
+
+	private:
+		static uint32_t Register(AssetType type, const std::filesystem::path& path, const std::function<Shr<void>(size_t& outMemory)>& load);
+		static void* GetAsset(uint32_t id, AssetType type);
+		static Shr<void> GetAssetShared(uint32_t id, AssetType type);
+	};
+
+	// Counted reference for long lived owners like components. Copies are not atomic, main thread only.
+	template<typename T>
+	class AssetRef
+	{
+	public:
+		AssetRef() = default;
+		AssetRef(AssetHandle<T> handle)
+			: handle(handle)
+		{
+			AssetManager::Retain(handle.id);
+		}
+
+		AssetRef(const AssetRef& other)
+			: AssetRef(other.handle)
+		{
+		}
+
+		AssetRef(AssetRef&& other) noexcept
+			: handle(std::exchange(other.handle, {}))
+		{
+		}
+
+		AssetRef& operator=(const AssetRef& other)
+		{
+			if (this != &other)
+				Reset(other.handle);
+			return *this;
+		}
+
+		AssetRef& operator=(AssetRef&& other) noexcept
+		{
+			if (this != &other)
+			{
+				AssetManager::Release(handle.id);
+				handle = std::exchange(other.handle, {});
+			}
+			return *this;
+		}
+
+		~AssetRef()
+		{
+			AssetManager::Release(handle.id);
+		}
+
+		void Reset(AssetHandle<T> newHandle = {})
+		{
+			AssetManager::Retain(newHandle.id);
+			AssetManager::Release(handle.id);
+			handle = newHandle;
+		}
+
+		AssetHandle<T> GetHandle() const { return handle; }
+		operator AssetHandle<T>() const { return handle; }
+
+		T* Get() const { return AssetManager::Get(handle); }
+		T* operator->() const { return Get(); }
+
+		//false for empty refs and for unloaded assets
+		explicit operator bool() const { return Get() != nullptr; }
+
+	private:
+		AssetHandle<T> handle;
+	};
+}
@@ -0,0 +1,44 @@
+#include "Engine.h"
+#include "BoxCollider2DComponent.h"
+
+namespace Paper
+{
+	bool BoxCollider2DComponent::Serialize(YAML::Emitter& out)
+	{
+		try
+		{
+			out << YAML::Key << "BoxCollider2DComponent";
+			out << YAML::BeginMap; // BoxCollider2DComponent
+
+			out << YAML::Key << "Offset" << YAML::Value << offset;
+			out << YAML::Key << "Size" << YAML::Value << size;
+			out << YAML::Key << "Friction" << YAML::Value << friction;
+			out << YAML::Key << "Restitution" << YAML::Value << restitution;
+
+			out << YAML::EndMap; // BoxCollider2DComponent
+			return true;
+		}
+		catch (YAML::EmitterException& e)
+		{
+			LOG_CORE_CRITICAL("[BoxCollider2DComponent]: Could not serialize component\n\t" + e.msg);
+			return false;
+		}
+	}
+
+	bool BoxCollider2DComponent::Deserialize(YAML::Node& data)
+	{
+		try
+		{
+			offset = data["Offset"].as<glm::vec2>();
+			size = data["Size"].as<glm::vec2>();
+			friction = data["Friction"].as<float>();
+			restitution = data["Restitution"].as<float>();
+		}
+		catch (YAML::EmitterException& e)
+		{
+			LOG_CORE_CRITICAL("[BoxCollider2DComponent]: Could not deserialize component\n\t" + e.msg);
+			return false;
+		}
+		return true;
+	}
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include "Engine.h"
+
+#include "Serializable.h"
+
+namespace Paper
+{
+	//size is in local units and scaled by the transform, collides axis aligned
+	struct BoxCollider2DComponent : Serializable
+	{
+		glm::vec2 offset = glm::vec2(0.0f);
+		glm::vec2 size = glm::vec2(1.0f);
+		float friction = 0.4f;
+		float restitution = 0.0f;
+
+		BoxCollider2DComponent() = default;
+		~BoxCollider2DComponent() override = default;
+
+		bool Serialize(YAML::Emitter& out) override;
+		bool Deserialize(YAML::Node& data) override;
+	};
+}
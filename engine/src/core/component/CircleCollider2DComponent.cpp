@@ -0,0 +1,44 @@
+#include "Engine.h"
+#include "CircleCollider2DComponent.h"
+
+namespace Paper
+{
+	bool CircleCollider2DComponent::Serialize(YAML::Emitter& out)
+	{
+		try
+		{
+			out << YAML::Key << "CircleCollider2DComponent";
+			out << YAML::BeginMap; // CircleCollider2DComponent
+
+			out << YAML::Key << "Offset" << YAML::Value << offset;
+			out << YAML::Key << "Radius" << YAML::Value << radius;
+			out << YAML::Key << "Friction" << YAML::Value << friction;
+			out << YAML::Key << "Restitution" << YAML::Value << restitution;
+
+			out << YAML::EndMap; // CircleCollider2DComponent
+			return true;
+		}
+		catch (YAML::EmitterException& e)
+		{
+			LOG_CORE_CRITICAL("[CircleCollider2DComponent]: Could not serialize component\n\t" + e.msg);
+			return false;
+		}
+	}
+
+	bool CircleCollider2DComponent::Deserialize(YAML::Node& data)
+	{
+		try
+		{
+			offset = data["Offset"].as<glm::vec2>();
+			radius = data["Radius"].as<float>();
+			friction = data["Friction"].as<float>();
+			restitution = data["Restitution"].as<float>();
+		}
+		catch (YAML::EmitterException& e)
+		{
+			LOG_CORE_CRITICAL("[CircleCollider2DComponent]: Could not deserialize component\n\t" + e.msg);
+			return false;
+		}
+		return true;
+	}
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include "Engine.h"
+
+#include "Serializable.h"
+
+namespace Paper
+{
+	//radius is scaled by the larger of the transform x and y scale
+	struct CircleCollider2DComponent : Serializable
+	{
+		glm::vec2 offset = glm::vec2(0.0f);
+		float radius = 0.5f;
+		float friction = 0.4f;
+		float restitution = 0.0f;
+
+		CircleCollider2DComponent() = default;
+		~CircleCollider2DComponent() override = default;
+
+		bool Serialize(YAML::Emitter& out) override;
+		bool Deserialize(YAML::Node& data) override;
+	};
+}
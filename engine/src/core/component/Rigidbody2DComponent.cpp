@@ -0,0 +1,48 @@
+#include "Engine.h"
+#include "Rigidbody2DComponent.h"
+
+namespace Paper
+{
+	bool Rigidbody2DComponent::Serialize(YAML::Emitter& out)
+	{
+		try
+		{
+			out << YAML::Key << "Rigidbody2DComponent";
+			out << YAML::BeginMap; // Rigidbody2DComponent
+
+			out << YAML::Key << "Type" << YAML::Value << BodyType2DToString(type);
+			out << YAML::Key << "Velocity" << YAML::Value << velocity;
+			out << YAML::Key << "Mass" << YAML::Value << mass;
+			out << YAML::Key << "GravityScale" << YAML::Value << gravityScale;
+			out << YAML::Key << "LinearDamping" << YAML::Value << linearDamping;
+			out << YAML::Key << "AllowSleep" << YAML::Value << allowSleep;
+
+			out << YAML::EndMap; // Rigidbody2DComponent
+			return true;
+		}
+		catch (YAML::EmitterException& e)
+		{
+			LOG_CORE_CRITICAL("[Rigidbody2DComponent]: Could not serialize component\n\t" + e.msg);
+			return false;
+		}
+	}
+
+	bool Rigidbody2DComponent::Deserialize(YAML::Node& data)
+	{
+		try
+		{
+			type = StringToBodyType2D(data["Type"].as<std::string>());
+			velocity = data["Velocity"].as<glm::vec2>();
+			mass = data["Mass"].as<float>();
+			gravityScale = data["GravityScale"].as<float>();
+			linearDamping = data["LinearDamping"].as<float>();
+			allowSleep = data["AllowSleep"].as<bool>();
+		}
+		catch (YAML::EmitterException& e)
+		{
+			LOG_CORE_CRITICAL("[Rigidbody2DComponent]: Could not deserialize component\n\t" + e.msg);
+			return false;
+		}
+		return true;
+	}
+}
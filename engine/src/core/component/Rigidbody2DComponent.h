@@ -0,0 +1,76 @@
+#pragma once
+#include "Engine.h"
+
+#include "Serializable.h"
+
+namespace Paper
+{
+	enum class BodyType2D
+	{
+		Static,
+		Dynamic,
+		Kinematic,
+
+		_LAST = Kinematic
+	};
+
+	inline std::string BodyType2DToString(const BodyType2D type)
+	{
+		switch (type) {
+			case BodyType2D::Static: return "Static";
+			case BodyType2D::Dynamic: return "Dynamic";
+			case BodyType2D::Kinematic: return "Kinematic";
+		}
+		ASSERT(false, "")
+		return "";
+	}
+
+	inline BodyType2D StringToBodyType2D(const std::string& type)
+	{
+		if (type == "Static") return BodyType2D::Static;
+		if (type == "Kinematic") return BodyType2D::Kinematic;
+		return BodyType2D::Dynamic;
+	}
+
+	//bodies do not rotate, the transform rotation is left to the user
+	struct Rigidbody2DComponent : Serializable
+	{
+		BodyType2D type = BodyType2D::Dynamic;
+		glm::vec2 velocity = glm::vec2(0.0f);
+		float mass = 1.0f;
+		float gravityScale = 1.0f;
+		float linearDamping = 0.0f;
+		bool allowSleep = true;
+
+		//runtime
+		glm::vec2 force = glm::vec2(0.0f);
+		bool awake = true;
+		float sleepTime = 0.0f;
+
+		Rigidbody2DComponent() = default;
+		~Rigidbody2DComponent() override = default;
+
+		float GetInverseMass() const { return type == BodyType2D::Dynamic && mass > 0.0f ? 1.0f / mass : 0.0f; }
+
+		void WakeUp()
+		{
+			awake = true;
+			sleepTime = 0.0f;
+		}
+
+		void ApplyForce(glm::vec2 f)
+		{
+			force += f;
+			WakeUp();
+		}
+
+		void ApplyImpulse(glm::vec2 impulse)
+		{
+			velocity += impulse * GetInverseMass();
+			WakeUp();
+		}
+
+		bool Serialize(YAML::Emitter& out) override;
+		bool Deserialize(YAML::Node& data) override;
+	};
+}
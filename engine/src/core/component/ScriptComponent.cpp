@@ -2,10 +2,17 @@
 #include "ScriptComponent.h"
 
 #include "scripting/ScriptEngine.h"
+#include "generic/Hash.h"
 
 
 namespace Paper
 {
+	void ScriptComponent::SetScriptClass(const std::string& fullClassName)
+	{
+		scriptClassName = fullClassName;
+		scriptClassID = fullClassName.empty() ? -1 : Hash::GenerateFNVHash(fullClassName);
+	}
+
 	bool ScriptComponent::Serialize(YAML::Emitter& out)
 	{
 		try
@@ -13,7 +20,7 @@ namespace Paper
 			out << YAML::Key << "ScriptComponent";
 			out << YAML::BeginMap; // SpriteComponent
 
-			out << YAML::Key << "Name" << YAML::Value << ScriptEngine::GetEntityInheritClass(scriptClassName)->fullClassName;
+			out << YAML::Key << "Name" << YAML::Value << scriptClassName;
 
 
 			return true;
@@ -29,7 +36,7 @@ namespace Paper
 	{
 		try
 		{
-			scriptClassName = data["Name"].as<std::string>();
+			SetScriptClass(data["Name"].as<std::string>());
 		}
 		catch (YAML::EmitterException& e)
 		{
@@ -11,6 +11,10 @@ namespace Paper
 		ScriptComponent(const ScriptComponent&) = default;
 
 		std::string scriptClassName;
+		//resolved from the name, class ids are name hashes so it stays valid across reloads
+		uint32_t scriptClassID = -1;
+
+		void SetScriptClass(const std::string& fullClassName);
 
 		bool Serialize(YAML::Emitter& out) override;
 		bool Deserialize(YAML::Node& data) override;
@@ -37,7 +37,7 @@ namespace Paper
 		{
 			color = data["Color"].as<glm::vec4>();
 			if (data["TexturePath"])
-				texture = DataPool::GetAssetTexture(data["TexturePath"].as<std::string>(), true);
+				texture = AssetManager::LoadProjectTexture(data["TexturePath"].as<std::string>());
 			tiling_factor = data["TilingFactor"].as<float>();
 			tex_coords = data["TexCoords"].as<std::array<glm::vec2, 4>>();
 			register_alpha_pixels_to_event = data["RegisterAlphaPixels"].as<bool>();
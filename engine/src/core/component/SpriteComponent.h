@@ -5,7 +5,7 @@
 #include "renderer/Texture.h"
 
 #include "Serializable.h"
-#include "utils/DataPool.h"
+#include "assets/AssetManager.h"
 
 namespace Paper {
 
@@ -32,17 +32,19 @@ namespace Paper {
 	}
 
 	struct SpriteComponent : Serializable {
+		//color through fade are read and written in place by scripts (SpriteData in scriptcore), keep them together
 		glm::vec4 color = glm::vec4(1.0f);
-		Shr<Texture> texture = nullptr;
 		float tiling_factor = 1.0f;
 		std::array<glm::vec2, 4> tex_coords = { { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } } };
 		Geometry geometry = Geometry::RECTANGLE;
-		bool register_alpha_pixels_to_event = false;
 
 		//only for circles
 		float thickness = 1.0f;
 		float fade = 0.005f;
 
+		AssetRef<Texture> texture;
+		bool register_alpha_pixels_to_event = false;
+
 		SpriteComponent() = default;
 		~SpriteComponent() override = default;
 
@@ -52,17 +54,17 @@ namespace Paper {
 		SpriteComponent(const glm::vec4 color, const Geometry geometry, float thickness, float fade = 0.005f, const bool register_alpha_pixels_to_event = false)
 			: color(color), geometry(geometry), thickness(thickness), fade(fade), register_alpha_pixels_to_event(register_alpha_pixels_to_event) { }
 
-		SpriteComponent(const glm::vec4 color, Shr<Texture> texture, const Geometry geometry, const bool register_alpha_pixels_to_event = false)
-			: color(color), texture(std::move(texture)), geometry(geometry), register_alpha_pixels_to_event(register_alpha_pixels_to_event) { }
+		SpriteComponent(const glm::vec4 color, AssetHandle<Texture> texture, const Geometry geometry, const bool register_alpha_pixels_to_event = false)
+			: color(color), geometry(geometry), texture(texture), register_alpha_pixels_to_event(register_alpha_pixels_to_event) { }
 
-		SpriteComponent(const glm::vec4 color, Shr<Texture> texture, const Geometry geometry, float thickness, float fade = 0.005f, const bool register_alpha_pixels_to_event = false)
-			: color(color), texture(std::move(texture)), geometry(geometry), thickness(thickness), fade(fade), register_alpha_pixels_to_event(register_alpha_pixels_to_event) { }
+		SpriteComponent(const glm::vec4 color, AssetHandle<Texture> texture, const Geometry geometry, float thickness, float fade = 0.005f, const bool register_alpha_pixels_to_event = false)
+			: color(color), geometry(geometry), thickness(thickness), fade(fade), texture(texture), register_alpha_pixels_to_event(register_alpha_pixels_to_event) { }
 
-		SpriteComponent(const glm::vec4 color, Shr<Texture> texture, const float tiling_factor, const Geometry geometry, const bool register_alpha_pixels_to_event = false)
-			: color(color), texture(std::move(texture)), tiling_factor(tiling_factor), geometry(geometry), register_alpha_pixels_to_event(register_alpha_pixels_to_event) { }
+		SpriteComponent(const glm::vec4 color, AssetHandle<Texture> texture, const float tiling_factor, const Geometry geometry, const bool register_alpha_pixels_to_event = false)
+			: color(color), tiling_factor(tiling_factor), geometry(geometry), texture(texture), register_alpha_pixels_to_event(register_alpha_pixels_to_event) { }
 
-		SpriteComponent(const glm::vec4 color, Shr<Texture> texture, const float tiling_factor, const Geometry geometry, float thickness, float fade = 0.005f, const bool register_alpha_pixels_to_event = false)
-			: color(color), texture(std::move(texture)), tiling_factor(tiling_factor), geometry(geometry), thickness(thickness), fade(fade), register_alpha_pixels_to_event(register_alpha_pixels_to_event) { }
+		SpriteComponent(const glm::vec4 color, AssetHandle<Texture> texture, const float tiling_factor, const Geometry geometry, float thickness, float fade = 0.005f, const bool register_alpha_pixels_to_event = false)
+			: color(color), tiling_factor(tiling_factor), geometry(geometry), thickness(thickness), fade(fade), texture(texture), register_alpha_pixels_to_event(register_alpha_pixels_to_event) { }
 
 		bool Serialize(YAML::Emitter& out) override;
 		bool Deserialize(YAML::Node& data) override;
@@ -33,7 +33,7 @@ namespace Paper
 		{
 			color = data["Color"].as<glm::vec4>();
 			text = data["Text"].as<std::string>();
-			font = DataPool::GetFont(data["FontPath"].as<std::string>());
+			font = AssetManager::LoadFont(data["FontPath"].as<std::string>());
 			register_alpha_pixels_to_event = data["RegisterAlphaPixels"].as<bool>();
 		}
 		catch (YAML::EmitterException& e)
@@ -1,5 +1,5 @@
 #pragma once
-#include "utils/DataPool.h"
+#include "assets/AssetManager.h"
 
 #include "Serializable.h"
 
@@ -9,13 +9,13 @@ namespace Paper
 	{
 		glm::vec4 color = glm::vec4(1.0f);
 		std::string text = "][DEFAULT-TEXT][";
-		Shr<Font> font = DataPool::GetDefaultFont();
+		AssetRef<Font> font = AssetManager::GetDefaultFont();
 		bool register_alpha_pixels_to_event = false;
 
 		TextComponent() = default;
 		~TextComponent() override = default;
 
-		TextComponent(const glm::vec4 color, const std::string& text, const Shr<Font>& font = DataPool::GetFont("mononoki.ttf"), const bool registerAlphaPixelsToEvent = false)
+		TextComponent(const glm::vec4 color, const std::string& text, AssetHandle<Font> font = AssetManager::GetDefaultFont(), const bool registerAlphaPixelsToEvent = false)
 			: color(color), text(text), font(font), register_alpha_pixels_to_event(registerAlphaPixelsToEvent) {}
 
 		bool Serialize(YAML::Emitter& out) override;
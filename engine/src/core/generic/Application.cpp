@@ -5,24 +5,27 @@
 #include "event/Input.h"
 #include "imgui/ImGuiLayer.h"
 #include "renderer/RenderCommand.h"
+#include "assets/AssetManager.h"
 #include "scripting/ScriptEngine.h"
-#include "utils/DataPool.h"
 
 namespace Paper {
 
 	Application* Application::instance;
 
-	Application::Application(const WindowProps& props)
+	Application::Application(const WindowProps& props, RenderThreadPolicy renderThreadPolicy)
 	{
 		Log::Init();
  
 		instance = this;
 
+		RenderThread::SetPolicy(renderThreadPolicy);
+
 		//Core::Init();
 
 		window = Window::Create(props);
 		SetEventCallback(BIND_EVENT_FN(Application::OnEvent));
 
+		AssetManager::Init();
 		RenderCommand::Init();
 		ScriptEngine::Init();
 
@@ -33,7 +36,7 @@ namespace Paper {
 	{
 		ScriptEngine::Shutdown(!this->restart);
 		RenderCommand::Shutdown();
-		DataPool::ErasePool();
+		AssetManager::Shutdown();
 		Log::Shutdown();
 	}
 
@@ -81,13 +84,29 @@ namespace Paper {
 		AddOverlay(imguiLayer);
 		Init();
 
+		//everything created from here on goes through the render thread, if there is one
+		RenderThread::Start();
+
 		// start of the calculations
-		float begin_time = window->GetTime();
+		const double start_time = window->GetTime();
+		double begin_time = start_time;
 		dt = 0.0167f;
+		time = 0.0;
+		frameCount = 0;
+		fixedTimestep.Reset();
+		fixedTimestep.Advance(dt);
 		bool starting = true;
 
+		PAPER_PROFILE_THREAD("Main Thread");
+
 		while (gameRunning)
 		{
+			PAPER_PROFILE_NEW_FRAME();
+			PAPER_PROFILE_SCOPE("Frame");
+			FrameArena::NewFrame();
+			MemoryTracker::NewFrame();
+			RenderCommand::NewFrame();
+
 			if (!starting) {}
 				window->PollEvents();
 
@@ -95,29 +114,47 @@ namespace Paper {
 			
 			imguiLayer->Begin(dt);
 
-			for (Layer* layer : layerStack)
 			{
-				if (layer->IsAttached())
-					layer->Update(dt);
+				PAPER_PROFILE_SCOPE("Layer::Update");
+				for (Layer* layer : layerStack)
+				{
+					if (layer->IsAttached())
+						layer->Update(dt);
+				}
 			}
 
-			for (Layer* layer : layerStack) {
-				layer->Imgui(dt);
+			{
+				PAPER_PROFILE_SCOPE("Layer::Imgui");
+				for (Layer* layer : layerStack) {
+					layer->Imgui(dt);
+				}
 			}
 
 			imguiLayer->End();
 
-			window->SwapBuffers();
+			{
+				PAPER_PROFILE_SCOPE("SwapBuffers");
+				window->SwapBuffers();
+				RenderThread::Kick();
+			}
 
 			Input::Update();
 
 			resizing = false;
 			starting = false;
 
-			dt = window->GetTime() - begin_time;
-			begin_time = window->GetTime();
+			const double end_time = window->GetTime();
+			const double frame_time = end_time - begin_time;
+			begin_time = end_time;
+
+			dt = (float)frame_time;
+			time = end_time - start_time;
+			frameCount++;
+			fixedTimestep.Advance(frame_time);
 		}
 
+		RenderThread::Shutdown();
+
 		LOG_CORE_WARN("Reached end of game function. Shutting down.");
 	}
 
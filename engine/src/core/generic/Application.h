@@ -3,6 +3,8 @@
 #include "utility.h"
 
 #include "generic/Window.h"
+#include "generic/FixedTimestep.h"
+#include "renderer/RenderThread.h"
 #include "scene/Scene.h"
 #include "layer/Layer.h"
 #include "layer/LayerStack.h"
@@ -19,7 +21,7 @@ namespace Paper {
 	{
 	public:
 
-		Application(const WindowProps& props = WindowProps());
+		Application(const WindowProps& props = WindowProps(), RenderThreadPolicy renderThreadPolicy = RenderThreadPolicy::SingleThreaded);
 		virtual ~Application();
 
 		virtual void Init() = 0;
@@ -44,7 +46,15 @@ namespace Paper {
 
 		static Application* GetInstance() { return instance; }
 
+		//real time of the last frame, for things that follow the display like cameras and ui
 		static float GetDT() { return GetInstance()->dt; }
+		//seconds since Run started
+		static double GetTime() { return GetInstance()->time; }
+		static uint64_t GetFrameCount() { return GetInstance()->frameCount; }
+
+		//simulation (scripts and physics) runs in fixed ticks, independent of the frame rate
+		static FixedTimestep& GetFixedTimestep() { return GetInstance()->fixedTimestep; }
+		static float GetFixedDT() { return (float)GetInstance()->fixedTimestep.GetTickDelta(); }
 		static bool IsResizing() { return GetInstance()->resizing; }
 		static void SetEventCallback(const EventCallbackFunction& callbackFunction) { GetInstance()->window->SetEventCallback(callbackFunction); }
 
@@ -65,6 +75,9 @@ namespace Paper {
 		Scene* currentScene = nullptr;
 		Scene* queuedScene = nullptr;
 		float dt;
+		double time = 0.0;
+		uint64_t frameCount = 0;
+		FixedTimestep fixedTimestep;
 		bool gameRunning = true;
 		bool resizing = false;
 
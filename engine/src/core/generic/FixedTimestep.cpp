@@ -0,0 +1,52 @@
+#include "Engine.h"
+#include "generic/FixedTimestep.h"
+
+namespace Paper {
+
+	FixedTimestep::FixedTimestep(uint32_t tickRate, uint32_t maxTicksPerFrame)
+		: tickRate(std::max(tickRate, 1u)), tickDelta(1.0 / (double)std::max(tickRate, 1u)), maxTicksPerFrame(std::max(maxTicksPerFrame, 1u))
+	{
+	}
+
+	uint32_t FixedTimestep::Advance(double frameTime)
+	{
+		accumulator += std::max(frameTime, 0.0);
+
+		ticksThisFrame = 0;
+		while (accumulator >= tickDelta && ticksThisFrame < maxTicksPerFrame)
+		{
+			accumulator -= tickDelta;
+			ticksThisFrame++;
+		}
+
+		if (accumulator >= tickDelta)
+		{
+			const double dropped = std::floor(accumulator / tickDelta);
+			droppedTicks += (uint64_t)dropped;
+			accumulator -= dropped * tickDelta;
+		}
+
+		tick += ticksThisFrame;
+		tickTime += ticksThisFrame * tickDelta;
+		return ticksThisFrame;
+	}
+
+	void FixedTimestep::Reset()
+	{
+		accumulator = 0.0;
+		tick = 0;
+		tickTime = 0.0;
+		ticksThisFrame = 0;
+		droppedTicks = 0;
+	}
+
+	void FixedTimestep::SetTickRate(uint32_t ticksPerSecond)
+	{
+		//keep the fraction of a tick already accumulated
+		const double fraction = accumulator / tickDelta;
+
+		tickRate = std::max(ticksPerSecond, 1u);
+		tickDelta = 1.0 / (double)tickRate;
+		accumulator = fraction * tickDelta;
+	}
+}
@@ -0,0 +1,49 @@
+#pragma once
+#include "Engine.h"
+
+namespace Paper {
+
+	// Turns variable frame times into a whole number of fixed simulation ticks.
+	// Time is accumulated in doubles so long sessions don't lose precision.
+	class FixedTimestep
+	{
+	public:
+		FixedTimestep(uint32_t tickRate = 60, uint32_t maxTicksPerFrame = 8);
+
+		//adds the real time of a frame and returns how many ticks to run for it
+		uint32_t Advance(double frameTime);
+		void Reset();
+
+		void SetTickRate(uint32_t ticksPerSecond);
+		uint32_t GetTickRate() const { return tickRate; }
+		double GetTickDelta() const { return tickDelta; }
+
+		//frames that would need more ticks drop the rest of their time instead of spiralling
+		void SetMaxTicksPerFrame(uint32_t maxTicks) { maxTicksPerFrame = std::max(maxTicks, 1u); }
+		uint32_t GetMaxTicksPerFrame() const { return maxTicksPerFrame; }
+
+		void SetInterpolation(bool enabled) { interpolation = enabled; }
+		bool IsInterpolating() const { return interpolation; }
+
+		//how far the rendered frame lies between the previous and the latest tick, in [0, 1)
+		float GetAlpha() const { return interpolation ? (float)(accumulator / tickDelta) : 1.0f; }
+
+		uint64_t GetTick() const { return tick; }
+		//simulated seconds, the sum of every tick's delta
+		double GetTickTime() const { return tickTime; }
+		uint32_t GetTicksThisFrame() const { return ticksThisFrame; }
+		uint64_t GetDroppedTicks() const { return droppedTicks; }
+
+	private:
+		uint32_t tickRate;
+		double tickDelta;
+		uint32_t maxTicksPerFrame;
+		bool interpolation = true;
+
+		double accumulator = 0.0;
+		uint64_t tick = 0;
+		double tickTime = 0.0;
+		uint32_t ticksThisFrame = 0;
+		uint64_t droppedTicks = 0;
+	};
+}
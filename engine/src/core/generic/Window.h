@@ -28,13 +28,14 @@ namespace Paper {
 
         virtual void PollEvents() = 0;
         virtual void SwapBuffers() = 0;
+        virtual void MakeContextCurrent(bool current) = 0;
 
         virtual unsigned int GetWidth() const = 0;
         virtual unsigned int GetHeight() const = 0;
 
         virtual glm::ivec2 GetPosition() const = 0;
 
-        virtual float GetTime() const = 0;
+        virtual double GetTime() const = 0;
 
         virtual void SetEventCallback(const EventCallbackFunction& callback_function) = 0;
         virtual void SetTitle(const std::string& title) = 0;
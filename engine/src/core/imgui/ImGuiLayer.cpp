@@ -7,6 +7,7 @@
 #include "renderer/RenderCommand.h"
 #include "renderer/Renderer2D.h"
 #include "renderer/FrameBuffer.h"
+#include "renderer/RenderThread.h"
 
 #include <GLFW/glfw3.h>
 
@@ -17,6 +18,30 @@
 
 namespace Paper {
 
+	//the draw lists are rebuilt by the next NewFrame, so the render thread gets its own copy
+	struct OwnedDrawData
+	{
+		ImDrawData drawData;
+		std::vector<ImDrawList*> cmdLists;
+
+		OwnedDrawData(const ImDrawData* source)
+			: drawData(*source)
+		{
+			cmdLists.reserve(source->CmdListsCount);
+			for (int i = 0; i < source->CmdListsCount; i++)
+				cmdLists.push_back(source->CmdLists[i]->CloneOutput());
+
+			drawData.CmdLists = cmdLists.data();
+			drawData.OwnerViewport = nullptr;
+		}
+
+		~OwnedDrawData()
+		{
+			for (ImDrawList* list : cmdLists)
+				IM_DELETE(list);
+		}
+	};
+
 	void ImGuiLayer::SetDarkThemeV2Colors()
 	{
 		auto& style = ImGui::GetStyle();
@@ -131,6 +156,13 @@ namespace Paper {
 		io.ConfigFlags |= ImGuiConfigFlags_DockingEnable;           // Enable Docking
 		io.ConfigFlags |= ImGuiConfigFlags_ViewportsEnable;         // Enable Multi-Viewport / Platform Windows
 
+		//platform windows create and swap their own contexts on the main thread
+		if (RenderThread::GetPolicy() == RenderThreadPolicy::MultiThreaded)
+		{
+			io.ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+			LOG_CORE_WARN("ImGui multi-viewports are disabled while rendering on a separate thread");
+		}
+
 		ImGuiStyle& style = ImGui::GetStyle();
 		/// Temporary
 		ImGui::StyleColorsDark();
@@ -167,6 +199,8 @@ namespace Paper {
 		//init backend
 		ImGui_ImplGlfw_InitForOpenGL((GLFWwindow*)Application::GetWindow()->GetNativeWindow(), true);
 		ImGui_ImplOpenGL3_Init("#version 410");
+		//normally deferred to the first NewFrame, which would run without the context once it is handed over
+		ImGui_ImplOpenGL3_CreateDeviceObjects();
 	}
 
 	void ImGuiLayer::OnDetach()
@@ -183,7 +217,8 @@ namespace Paper {
 		io.DisplaySize = ImVec2(Application::GetWindow()->GetWidth(), Application::GetWindow()->GetHeight());
 		io.DeltaTime = dt;
 
-		ImGui_ImplOpenGL3_NewFrame();
+		if (!RenderThread::IsThreaded())
+			ImGui_ImplOpenGL3_NewFrame();
 		ImGui_ImplGlfw_NewFrame();
 		ImGui::NewFrame();
 		ImGuizmo::BeginFrame();
@@ -191,11 +226,28 @@ namespace Paper {
 
 	void ImGuiLayer::End()
 	{
+		PAPER_PROFILE_FUNCTION();
+
 		ImGuiIO& io = ImGui::GetIO();
 		io.DisplaySize = ImVec2(Application::GetWindow()->GetWidth(), Application::GetWindow()->GetHeight());
 
 		ImGui::Render();
-		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+		if (RenderThread::IsThreaded())
+		{
+			ScopedGPUPass gpuPass("ImGui");
+			RenderThread::Submit([drawData = std::make_shared<OwnedDrawData>(ImGui::GetDrawData())]()
+			{
+				ImGui_ImplOpenGL3_RenderDrawData(&drawData->drawData);
+			});
+			return;
+		}
+
+		{
+			//platform windows below render with their own contexts, which can't see our queries
+			ScopedGPUPass gpuPass("ImGui");
+			ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+		}
 
 		if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
 		{
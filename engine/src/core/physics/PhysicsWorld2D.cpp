@@ -0,0 +1,559 @@
+#include "Engine.h"
+#include "PhysicsWorld2D.h"
+
+#include "component/TransformComponent.h"
+#include "component/Rigidbody2DComponent.h"
+#include "component/BoxCollider2DComponent.h"
+#include "component/CircleCollider2DComponent.h"
+
+#include <numeric>
+
+namespace Paper
+{
+	static constexpr float LINEAR_SLOP = 0.005f;
+	static constexpr float POSITION_CORRECTION = 0.4f;
+	static constexpr float RESTITUTION_THRESHOLD = 1.0f;
+	static constexpr float AABB_MARGIN = 0.01f;
+
+	//keyed by entity so cached impulses survive bodies being gathered in a different order
+	static uint64_t PairKey(entt::entity a, entt::entity b)
+	{
+		const uint64_t x = entt::to_integral(a);
+		const uint64_t y = entt::to_integral(b);
+		return x < y ? (x << 32) | y : (y << 32) | x;
+	}
+
+	void PhysicsWorld2D::Bodies::Clear()
+	{
+		entity.clear();
+		shape.clear();
+		position.clear();
+		velocity.clear();
+		force.clear();
+		offset.clear();
+		halfExtents.clear();
+		invMass.clear();
+		gravityScale.clear();
+		damping.clear();
+		friction.clear();
+		restitution.clear();
+		sleepTime.clear();
+		dynamic.clear();
+		awake.clear();
+		allowSleep.clear();
+	}
+
+	void PhysicsWorld2D::Contacts::Clear()
+	{
+		pair.clear();
+		bodyA.clear();
+		bodyB.clear();
+		normal.clear();
+		depth.clear();
+		normalMass.clear();
+		friction.clear();
+		bounce.clear();
+		normalImpulse.clear();
+		tangentImpulse.clear();
+	}
+
+	void PhysicsWorld2D::Step(entt::registry& registry, float dt)
+	{
+		PAPER_PROFILE_FUNCTION();
+
+		if (dt <= 0.0f) return;
+
+		Gather(registry);
+		FixedStep(dt);
+		stats.steps++;
+		Writeback(registry);
+	}
+
+	void PhysicsWorld2D::Reset()
+	{
+		stats = PhysicsStats2D();
+		bodies.Clear();
+		contacts.Clear();
+		sortedBodies.clear();
+		pairs.clear();
+		pairKeys.clear();
+		pairNormalImpulse.clear();
+		pairTangentImpulse.clear();
+	}
+
+	void PhysicsWorld2D::Gather(entt::registry& registry)
+	{
+		bodies.Clear();
+
+		auto addBody = [&](entt::entity entity, const TransformComponent& transform, const Rigidbody2DComponent* rigidbody)
+		{
+			const glm::vec2 scale = glm::abs(glm::vec2(transform.scale));
+
+			Shape shape = Shape::None;
+			glm::vec2 offset(0.0f), halfExtents(0.0f);
+			float friction = 0.0f, restitution = 0.0f;
+
+			if (const auto* box = registry.try_get<BoxCollider2DComponent>(entity))
+			{
+				shape = Shape::Box;
+				offset = box->offset * scale;
+				halfExtents = glm::abs(box->size) * scale * 0.5f;
+				friction = box->friction;
+				restitution = box->restitution;
+			}
+			else if (const auto* circle = registry.try_get<CircleCollider2DComponent>(entity))
+			{
+				shape = Shape::Circle;
+				offset = circle->offset * scale;
+				halfExtents = glm::vec2(std::abs(circle->radius) * std::max(scale.x, scale.y));
+				friction = circle->friction;
+				restitution = circle->restitution;
+			}
+
+			bodies.entity.push_back(entity);
+			bodies.shape.push_back(shape);
+			bodies.position.push_back(glm::vec2(transform.position) + offset);
+			bodies.offset.push_back(offset);
+			bodies.halfExtents.push_back(halfExtents);
+			bodies.friction.push_back(friction);
+			bodies.restitution.push_back(restitution);
+
+			const bool moving = rigidbody && rigidbody->type != BodyType2D::Static;
+			bodies.velocity.push_back(moving ? rigidbody->velocity : glm::vec2(0.0f));
+			bodies.force.push_back(moving ? rigidbody->force : glm::vec2(0.0f));
+			bodies.invMass.push_back(rigidbody ? rigidbody->GetInverseMass() : 0.0f);
+			bodies.gravityScale.push_back(rigidbody ? rigidbody->gravityScale : 0.0f);
+			bodies.damping.push_back(rigidbody ? rigidbody->linearDamping : 0.0f);
+			bodies.sleepTime.push_back(rigidbody ? rigidbody->sleepTime : 0.0f);
+			bodies.dynamic.push_back(moving);
+			bodies.awake.push_back(moving && (rigidbody->awake || rigidbody->type == BodyType2D::Kinematic));
+			bodies.allowSleep.push_back(rigidbody && rigidbody->allowSleep);
+		};
+
+		for (auto [entity, transform, rigidbody] : registry.view<TransformComponent, Rigidbody2DComponent>().each())
+			addBody(entity, transform, &rigidbody);
+
+		//colliders without a body are static
+		for (auto [entity, transform, box] : registry.view<TransformComponent, BoxCollider2DComponent>(entt::exclude<Rigidbody2DComponent>).each())
+			addBody(entity, transform, nullptr);
+		for (auto [entity, transform, circle] : registry.view<TransformComponent, CircleCollider2DComponent>(entt::exclude<Rigidbody2DComponent, BoxCollider2DComponent>).each())
+			addBody(entity, transform, nullptr);
+
+		stats.bodies = (uint32_t)bodies.Size();
+		stats.awakeBodies = (uint32_t)std::count(bodies.awake.begin(), bodies.awake.end(), (uint8_t)true);
+	}
+
+	void PhysicsWorld2D::Writeback(entt::registry& registry)
+	{
+		for (uint32_t i = 0; i < bodies.Size(); i++)
+		{
+			if (!bodies.dynamic[i]) continue;
+
+			auto& transform = registry.get<TransformComponent>(bodies.entity[i]);
+			transform.position.x = bodies.position[i].x - bodies.offset[i].x;
+			transform.position.y = bodies.position[i].y - bodies.offset[i].y;
+
+			auto& rigidbody = registry.get<Rigidbody2DComponent>(bodies.entity[i]);
+			rigidbody.velocity = bodies.velocity[i];
+			rigidbody.force = glm::vec2(0.0f);
+			rigidbody.awake = bodies.awake[i];
+			rigidbody.sleepTime = bodies.sleepTime[i];
+		}
+	}
+
+	void PhysicsWorld2D::FixedStep(float h)
+	{
+		//a fully asleep world only needs to be woken from the components
+		if (stats.awakeBodies == 0)
+		{
+			stats.pairs = 0;
+			stats.contacts = 0;
+			return;
+		}
+
+		BroadPhase(h);
+
+		const uint32_t substeps = std::max(settings.substeps, 1u);
+		const float subH = h / (float)substeps;
+		for (uint32_t i = 0; i < substeps; i++)
+		{
+			IntegrateVelocities(subH);
+			NarrowPhase();
+			SolveVelocities();
+			IntegratePositions(subH);
+			CorrectPositions();
+		}
+
+		UpdateSleep(h);
+		stats.awakeBodies = (uint32_t)std::count(bodies.awake.begin(), bodies.awake.end(), (uint8_t)true);
+	}
+
+	void PhysicsWorld2D::BroadPhase(float h)
+	{
+		const uint32_t count = (uint32_t)bodies.Size();
+
+		fatMin.resize(count);
+		fatMax.resize(count);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			//grown by the distance travelled this step so the pairs hold for every substep
+			const glm::vec2 extents = bodies.halfExtents[i] + glm::abs(bodies.velocity[i]) * h + AABB_MARGIN;
+			fatMin[i] = bodies.position[i] - extents;
+			fatMax[i] = bodies.position[i] + extents;
+		}
+
+		if (sortedBodies.size() != count)
+		{
+			sortedBodies.resize(count);
+			std::iota(sortedBodies.begin(), sortedBodies.end(), 0u);
+		}
+
+		//insertion sort, bodies barely move between steps so this is close to one pass
+		for (uint32_t i = 1; i < count; i++)
+		{
+			const uint32_t body = sortedBodies[i];
+			const float key = fatMin[body].x;
+			uint32_t j = i;
+			while (j > 0 && fatMin[sortedBodies[j - 1]].x > key)
+			{
+				sortedBodies[j] = sortedBodies[j - 1];
+				j--;
+			}
+			sortedBodies[j] = body;
+		}
+
+		//remember the impulses of the last step so persistent pairs start warm
+		impulseCache.clear();
+		impulseCache.reserve(pairKeys.size());
+		for (uint32_t pair = 0; pair < pairKeys.size(); pair++)
+		{
+			if (pairNormalImpulse[pair] > 0.0f)
+				impulseCache[pairKeys[pair]] = glm::vec2(pairNormalImpulse[pair], pairTangentImpulse[pair]);
+		}
+
+		pairs.clear();
+		pairKeys.clear();
+		for (uint32_t i = 0; i < count; i++)
+		{
+			const uint32_t a = sortedBodies[i];
+			if (bodies.shape[a] == Shape::None) continue;
+
+			for (uint32_t j = i + 1; j < count; j++)
+			{
+				const uint32_t b = sortedBodies[j];
+				if (fatMin[b].x > fatMax[a].x) break;
+
+				if (bodies.shape[b] == Shape::None) continue;
+				if (fatMin[b].y > fatMax[a].y || fatMax[b].y < fatMin[a].y) continue;
+				if (bodies.invMass[a] == 0.0f && bodies.invMass[b] == 0.0f) continue;
+				if (!IsActive(a) && !IsActive(b)) continue;
+
+				pairs.emplace_back(a, b);
+				pairKeys.push_back(PairKey(bodies.entity[a], bodies.entity[b]));
+			}
+		}
+		pairNormalImpulse.assign(pairs.size(), 0.0f);
+		pairTangentImpulse.assign(pairs.size(), 0.0f);
+		if (!impulseCache.empty())
+		{
+			for (uint32_t pair = 0; pair < pairs.size(); pair++)
+			{
+				const auto it = impulseCache.find(pairKeys[pair]);
+				if (it == impulseCache.end()) continue;
+				pairNormalImpulse[pair] = it->second.x;
+				pairTangentImpulse[pair] = it->second.y;
+			}
+		}
+		stats.pairs = (uint32_t)pairs.size();
+	}
+
+	static bool CollideBoxes(glm::vec2 pA, glm::vec2 hA, glm::vec2 pB, glm::vec2 hB, glm::vec2& outNormal, float& outDepth)
+	{
+		const glm::vec2 d = pB - pA;
+		const glm::vec2 overlap = hA + hB - glm::abs(d);
+		if (overlap.x <= 0.0f || overlap.y <= 0.0f) return false;
+
+		if (overlap.x < overlap.y)
+		{
+			outNormal = glm::vec2(d.x < 0.0f ? -1.0f : 1.0f, 0.0f);
+			outDepth = overlap.x;
+		}
+		else
+		{
+			outNormal = glm::vec2(0.0f, d.y < 0.0f ? -1.0f : 1.0f);
+			outDepth = overlap.y;
+		}
+		return true;
+	}
+
+	static bool CollideCircles(glm::vec2 pA, float rA, glm::vec2 pB, float rB, glm::vec2& outNormal, float& outDepth)
+	{
+		const glm::vec2 d = pB - pA;
+		const float radius = rA + rB;
+		const float distanceSquared = glm::dot(d, d);
+		if (distanceSquared >= radius * radius) return false;
+
+		const float distance = std::sqrt(distanceSquared);
+		outNormal = distance > 1e-6f ? d / distance : glm::vec2(0.0f, 1.0f);
+		outDepth = radius - distance;
+		return true;
+	}
+
+	static bool CollideBoxCircle(glm::vec2 pA, glm::vec2 hA, glm::vec2 pB, float rB, glm::vec2& outNormal, float& outDepth)
+	{
+		const glm::vec2 d = pB - pA;
+		const glm::vec2 closest = glm::clamp(d, -hA, hA);
+
+		//circle center inside the box, push out along the nearest face
+		if (closest == d)
+		{
+			const glm::vec2 faceDistance = hA - glm::abs(d);
+			if (faceDistance.x < faceDistance.y)
+			{
+				outNormal = glm::vec2(d.x < 0.0f ? -1.0f : 1.0f, 0.0f);
+				outDepth = faceDistance.x + rB;
+			}
+			else
+			{
+				outNormal = glm::vec2(0.0f, d.y < 0.0f ? -1.0f : 1.0f);
+				outDepth = faceDistance.y + rB;
+			}
+			return true;
+		}
+
+		const glm::vec2 diff = d - closest;
+		const float distanceSquared = glm::dot(diff, diff);
+		if (distanceSquared >= rB * rB) return false;
+
+		const float distance = std::sqrt(distanceSquared);
+		outNormal = diff / distance;
+		outDepth = rB - distance;
+		return true;
+	}
+
+	void PhysicsWorld2D::NarrowPhase()
+	{
+		contacts.Clear();
+
+		for (uint32_t pair = 0; pair < pairs.size(); pair++)
+		{
+			const auto [a, b] = pairs[pair];
+			const glm::vec2 pA = bodies.position[a];
+			const glm::vec2 pB = bodies.position[b];
+			const glm::vec2 hA = bodies.halfExtents[a];
+			const glm::vec2 hB = bodies.halfExtents[b];
+
+			glm::vec2 normal;
+			float depth;
+			bool touching;
+			if (bodies.shape[a] == Shape::Box && bodies.shape[b] == Shape::Box)
+				touching = CollideBoxes(pA, hA, pB, hB, normal, depth);
+			else if (bodies.shape[a] == Shape::Circle && bodies.shape[b] == Shape::Circle)
+				touching = CollideCircles(pA, hA.x, pB, hB.x, normal, depth);
+			else if (bodies.shape[a] == Shape::Box)
+				touching = CollideBoxCircle(pA, hA, pB, hB.x, normal, depth);
+			else
+			{
+				touching = CollideBoxCircle(pB, hB, pA, hA.x, normal, depth);
+				normal = -normal;
+			}
+
+			if (!touching) continue;
+
+			//an active body touching a sleeping one wakes it
+			if (!bodies.awake[a] && bodies.invMass[a] > 0.0f) WakeUp(a);
+			if (!bodies.awake[b] && bodies.invMass[b] > 0.0f) WakeUp(b);
+
+			const float invMassSum = bodies.invMass[a] + bodies.invMass[b];
+			const float normalVelocity = glm::dot(bodies.velocity[b] - bodies.velocity[a], normal);
+			const float restitution = std::max(bodies.restitution[a], bodies.restitution[b]);
+
+			contacts.pair.push_back(pair);
+			contacts.bodyA.push_back(a);
+			contacts.bodyB.push_back(b);
+			contacts.normal.push_back(normal);
+			contacts.depth.push_back(depth);
+			contacts.normalMass.push_back(1.0f / invMassSum);
+			contacts.friction.push_back(std::sqrt(bodies.friction[a] * bodies.friction[b]));
+			contacts.bounce.push_back(normalVelocity < -RESTITUTION_THRESHOLD ? -restitution * normalVelocity : 0.0f);
+			contacts.normalImpulse.push_back(pairNormalImpulse[pair]);
+			contacts.tangentImpulse.push_back(pairTangentImpulse[pair]);
+		}
+		stats.contacts = (uint32_t)contacts.Size();
+	}
+
+	//sequential impulses, bodies do not rotate so the tangent mass equals the normal mass
+	void PhysicsWorld2D::SolveVelocities()
+	{
+		const size_t count = contacts.Size();
+
+		//warm start with the impulses of the previous substep
+		for (size_t c = 0; c < count; c++)
+		{
+			const uint32_t a = contacts.bodyA[c];
+			const uint32_t b = contacts.bodyB[c];
+			const glm::vec2 normal = contacts.normal[c];
+			const glm::vec2 impulse = contacts.normalImpulse[c] * normal + contacts.tangentImpulse[c] * glm::vec2(-normal.y, normal.x);
+			bodies.velocity[a] -= impulse * bodies.invMass[a];
+			bodies.velocity[b] += impulse * bodies.invMass[b];
+		}
+
+		for (uint32_t iteration = 0; iteration < settings.velocityIterations; iteration++)
+		{
+			for (size_t c = 0; c < count; c++)
+			{
+				const uint32_t a = contacts.bodyA[c];
+				const uint32_t b = contacts.bodyB[c];
+				const float invMassA = bodies.invMass[a];
+				const float invMassB = bodies.invMass[b];
+				glm::vec2& vA = bodies.velocity[a];
+				glm::vec2& vB = bodies.velocity[b];
+
+				const glm::vec2 normal = contacts.normal[c];
+				const float normalMass = contacts.normalMass[c];
+
+				//normal
+				{
+					const float vn = glm::dot(vB - vA, normal);
+					float lambda = -normalMass * (vn - contacts.bounce[c]);
+
+					const float newImpulse = std::max(contacts.normalImpulse[c] + lambda, 0.0f);
+					lambda = newImpulse - contacts.normalImpulse[c];
+					contacts.normalImpulse[c] = newImpulse;
+
+					const glm::vec2 impulse = lambda * normal;
+					vA -= impulse * invMassA;
+					vB += impulse * invMassB;
+				}
+
+				//friction
+				{
+					const glm::vec2 tangent(-normal.y, normal.x);
+					const float vt = glm::dot(vB - vA, tangent);
+					float lambda = -normalMass * vt;
+
+					const float maxFriction = contacts.friction[c] * contacts.normalImpulse[c];
+					const float newImpulse = std::clamp(contacts.tangentImpulse[c] + lambda, -maxFriction, maxFriction);
+					lambda = newImpulse - contacts.tangentImpulse[c];
+					contacts.tangentImpulse[c] = newImpulse;
+
+					const glm::vec2 impulse = lambda * tangent;
+					vA -= impulse * invMassA;
+					vB += impulse * invMassB;
+				}
+			}
+		}
+
+		for (size_t c = 0; c < count; c++)
+		{
+			pairNormalImpulse[contacts.pair[c]] = contacts.normalImpulse[c];
+			pairTangentImpulse[contacts.pair[c]] = contacts.tangentImpulse[c];
+		}
+	}
+
+	void PhysicsWorld2D::IntegrateVelocities(float h)
+	{
+		const size_t count = bodies.Size();
+		for (size_t i = 0; i < count; i++)
+		{
+			if (!bodies.awake[i] || bodies.invMass[i] == 0.0f) continue;
+
+			glm::vec2 v = bodies.velocity[i];
+			v += (settings.gravity * bodies.gravityScale[i] + bodies.force[i] * bodies.invMass[i]) * h;
+			v *= 1.0f / (1.0f + h * bodies.damping[i]);
+			bodies.velocity[i] = v;
+		}
+	}
+
+	void PhysicsWorld2D::IntegratePositions(float h)
+	{
+		const size_t count = bodies.Size();
+		for (size_t i = 0; i < count; i++)
+		{
+			if (!IsActive((uint32_t)i)) continue;
+			bodies.position[i] += bodies.velocity[i] * h;
+		}
+	}
+
+	//pushes overlapping bodies apart directly instead of adding velocity, so resting contacts stay calm
+	void PhysicsWorld2D::CorrectPositions()
+	{
+		const size_t count = contacts.Size();
+		for (size_t c = 0; c < count; c++)
+		{
+			const uint32_t a = contacts.bodyA[c];
+			const uint32_t b = contacts.bodyB[c];
+			const float invMassA = bodies.invMass[a];
+			const float invMassB = bodies.invMass[b];
+
+			const float correction = std::max(contacts.depth[c] - LINEAR_SLOP, 0.0f) * POSITION_CORRECTION * contacts.normalMass[c];
+			const glm::vec2 push = correction * contacts.normal[c];
+			bodies.position[a] -= push * invMassA;
+			bodies.position[b] += push * invMassB;
+		}
+	}
+
+	void PhysicsWorld2D::UpdateSleep(float h)
+	{
+		const uint32_t count = (uint32_t)bodies.Size();
+		const float sleepVelocitySquared = settings.sleepVelocity * settings.sleepVelocity;
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (!bodies.awake[i] || bodies.invMass[i] == 0.0f) continue;
+
+			const bool slow = glm::dot(bodies.velocity[i], bodies.velocity[i]) < sleepVelocitySquared;
+			bodies.sleepTime[i] = bodies.allowSleep[i] && slow ? bodies.sleepTime[i] + h : 0.0f;
+		}
+
+		//islands are groups of dynamic bodies in contact, static and kinematic bodies do not join them
+		islandParent.resize(count);
+		std::iota(islandParent.begin(), islandParent.end(), 0u);
+		for (size_t c = 0; c < contacts.Size(); c++)
+		{
+			const uint32_t a = contacts.bodyA[c];
+			const uint32_t b = contacts.bodyB[c];
+
+			//a moving kinematic body keeps everything it touches awake
+			if (bodies.invMass[a] == 0.0f && bodies.dynamic[a] && bodies.velocity[a] != glm::vec2(0.0f)) bodies.sleepTime[b] = 0.0f;
+			if (bodies.invMass[b] == 0.0f && bodies.dynamic[b] && bodies.velocity[b] != glm::vec2(0.0f)) bodies.sleepTime[a] = 0.0f;
+
+			if (bodies.invMass[a] == 0.0f || bodies.invMass[b] == 0.0f) continue;
+			islandParent[FindIsland(a)] = FindIsland(b);
+		}
+
+		//an island sleeps once its most restless body has been slow long enough
+		islandSleepTime.assign(count, std::numeric_limits<float>::max());
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (!bodies.awake[i] || bodies.invMass[i] == 0.0f) continue;
+			float& islandTime = islandSleepTime[FindIsland(i)];
+			islandTime = std::min(islandTime, bodies.sleepTime[i]);
+		}
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (!bodies.awake[i] || bodies.invMass[i] == 0.0f) continue;
+			if (islandSleepTime[FindIsland(i)] < settings.timeToSleep) continue;
+
+			bodies.awake[i] = false;
+			bodies.velocity[i] = glm::vec2(0.0f);
+		}
+	}
+
+	void PhysicsWorld2D::WakeUp(uint32_t body)
+	{
+		bodies.awake[body] = true;
+		bodies.sleepTime[body] = 0.0f;
+	}
+
+	uint32_t PhysicsWorld2D::FindIsland(uint32_t body)
+	{
+		while (islandParent[body] != body)
+		{
+			islandParent[body] = islandParent[islandParent[body]];
+			body = islandParent[body];
+		}
+		return body;
+	}
+}
@@ -0,0 +1,122 @@
+#pragma once
+#include "Engine.h"
+
+#include "utils/FlatHashMap.h"
+
+namespace Paper
+{
+	struct PhysicsSettings2D
+	{
+		glm::vec2 gravity = glm::vec2(0.0f, -9.81f);
+		uint32_t substeps = 4;
+		uint32_t velocityIterations = 4;
+
+		float sleepVelocity = 0.05f;
+		float timeToSleep = 0.5f;
+	};
+
+	struct PhysicsStats2D
+	{
+		uint32_t bodies = 0;
+		uint32_t awakeBodies = 0;
+		uint32_t pairs = 0;
+		uint32_t contacts = 0;
+		uint32_t steps = 0; //since the last Reset
+	};
+
+	// Rigid body world for entities with a Rigidbody2DComponent and/or a box or circle collider.
+	// Colliders without a body are static. Body state lives in the components; every Step gathers
+	// it into flat arrays, runs one step and writes positions and velocities back. The scene
+	// calls Step once per fixed simulation tick.
+	class PhysicsWorld2D
+	{
+	public:
+		PhysicsWorld2D() = default;
+
+		void Step(entt::registry& registry, float dt);
+		void Reset();
+
+		PhysicsSettings2D& GetSettings() { return settings; }
+		const PhysicsStats2D& GetStats() const { return stats; }
+
+	private:
+		enum class Shape : uint8_t { None, Box, Circle };
+
+		//structure of arrays so the integration and broadphase loops stay linear
+		struct Bodies
+		{
+			std::vector<entt::entity> entity;
+			std::vector<Shape> shape;
+			std::vector<glm::vec2> position;
+			std::vector<glm::vec2> velocity;
+			std::vector<glm::vec2> force;
+			std::vector<glm::vec2> offset;
+			std::vector<glm::vec2> halfExtents; //box half size, both hold the radius for circles
+			std::vector<float> invMass;
+			std::vector<float> gravityScale;
+			std::vector<float> damping;
+			std::vector<float> friction;
+			std::vector<float> restitution;
+			std::vector<float> sleepTime;
+			std::vector<uint8_t> dynamic; //dynamic or kinematic, moved by the integrator
+			std::vector<uint8_t> awake;
+			std::vector<uint8_t> allowSleep;
+
+			size_t Size() const { return entity.size(); }
+			void Clear();
+		};
+
+		struct Contacts
+		{
+			std::vector<uint32_t> pair;
+			std::vector<uint32_t> bodyA;
+			std::vector<uint32_t> bodyB;
+			std::vector<glm::vec2> normal; //from A to B
+			std::vector<float> depth;
+			std::vector<float> normalMass;
+			std::vector<float> friction;
+			std::vector<float> bounce; //restitution target for the normal velocity
+			std::vector<float> normalImpulse;
+			std::vector<float> tangentImpulse;
+
+			size_t Size() const { return bodyA.size(); }
+			void Clear();
+		};
+
+		void Gather(entt::registry& registry);
+		void Writeback(entt::registry& registry);
+
+		void FixedStep(float h);
+		void BroadPhase(float h);
+		void NarrowPhase();
+		void SolveVelocities();
+		void IntegrateVelocities(float h);
+		void IntegratePositions(float h);
+		void CorrectPositions();
+		void UpdateSleep(float h);
+
+		bool IsActive(uint32_t body) const { return bodies.awake[body] && bodies.dynamic[body]; }
+		void WakeUp(uint32_t body);
+		uint32_t FindIsland(uint32_t body);
+
+		PhysicsSettings2D settings;
+		PhysicsStats2D stats;
+
+		Bodies bodies;
+		Contacts contacts;
+
+		//sweep and prune order along x, kept between steps so the insertion sort stays near linear
+		std::vector<uint32_t> sortedBodies;
+		std::vector<glm::vec2> fatMin;
+		std::vector<glm::vec2> fatMax;
+		std::vector<std::pair<uint32_t, uint32_t>> pairs;
+		//entity keys of the pairs, taken when they are found since the body indices only hold for that step
+		std::vector<uint64_t> pairKeys;
+		//accumulated impulses per pair, carried between substeps and steps for warm starting
+		std::vector<float> pairNormalImpulse;
+		std::vector<float> pairTangentImpulse;
+		FlatHashMap<uint64_t, glm::vec2> impulseCache;
+		std::vector<uint32_t> islandParent;
+		std::vector<float> islandSleepTime;
+	};
+}
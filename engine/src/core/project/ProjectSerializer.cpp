@@ -7,6 +7,8 @@ namespace Paper
 {
 	void ProjectSerializer::Serialize(const Shr<Project>& project, const std::filesystem::path& filePath)
 	{
+		PAPER_PROFILE_FUNCTION();
+
 		const ProjectConfig& config = project->config;
 
 		YAML::Emitter out;
@@ -30,6 +32,8 @@ namespace Paper
 
 	Shr<Project> ProjectSerializer::Deserialize(const std::filesystem::path& filePath)
 	{
+		PAPER_PROFILE_FUNCTION();
+
 		Shr<Project> project = MakeShr<Project>();
 		ProjectConfig& config = project->config;
 		YAML::Node data;
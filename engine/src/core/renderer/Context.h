@@ -13,6 +13,8 @@ namespace Paper
 		virtual void Shutdown() = 0;
 
 		virtual void SwapBuffer() = 0;
+		//binds the context to the calling thread, or releases it from that thread
+		virtual void MakeCurrent(bool current) = 0;
 
 		static Shr<Context> CreateContext(void* window);
 	};
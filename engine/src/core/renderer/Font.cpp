@@ -127,7 +127,7 @@ namespace Paper
 		msdfgen::deinitializeFreetype(ft);
 	}
 
-	//replaced by DataPool
+	//replaced by AssetManager
 	
 	//Shr<Font> Font::GetFont(std::string fontPath)
 	//{
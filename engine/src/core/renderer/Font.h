@@ -18,7 +18,7 @@ namespace Paper
 		~Font();
 
 		MSDFData* GetMSDFData() const { return data; };
-		Shr<Texture> GetAtlasTexture() const { return atlasTexture; };
+		const Shr<Texture>& GetAtlasTexture() const { return atlasTexture; };
 
 		std::string GetFilePath() const { return fontPath.string(); }
 		std::string GetFontName() const { return fontPath.filename().string(); }
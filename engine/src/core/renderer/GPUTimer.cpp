@@ -0,0 +1,60 @@
+#include "Engine.h"
+#include "GPUTimer.h"
+
+#include "RenderAPI.h"
+
+#include "OpenGL/OpenGLGPUTimer.h"
+
+namespace Paper
+{
+	Shr<GPUTimer> GPUTimer::Create()
+	{
+		switch (RenderAPI::GetAPI())
+		{
+		case RenderAPI::NONE: CORE_ASSERT(false, "'NONE' is a non valid API"); return nullptr;
+		case RenderAPI::OPENGL: return MakeShr<OpenGLGPUTimer>();
+		case RenderAPI::VULKAN: CORE_ASSERT(false, "'VULKAN' is currently a not supportet API"); return nullptr;;
+		}
+
+		CORE_ASSERT(false, "");
+		return nullptr;
+	}
+
+	std::vector<GPUPassStats> GPUTimer::GetPassStats() const
+	{
+		std::scoped_lock<std::mutex> lock(mutex);
+		return passStats;
+	}
+
+	void GPUTimer::Resolve(const std::vector<std::pair<std::string, uint64_t>>& passTimes)
+	{
+		std::scoped_lock<std::mutex> lock(mutex);
+
+		for (GPUPassStats& stats : passStats)
+		{
+			stats.lastMs = 0.0f;
+			stats.count = 0;
+		}
+
+		for (const auto& [name, time] : passTimes)
+		{
+			auto it = std::find_if(passStats.begin(), passStats.end(), [&name](const GPUPassStats& stats) { return stats.name == name; });
+			if (it == passStats.end())
+			{
+				passStats.emplace_back().name = name;
+				it = passStats.end() - 1;
+			}
+
+			it->lastMs += (float)time / 1e6f;
+			it->count++;
+		}
+
+		//passes that didn't run this frame still get an entry, so all histories stay in step
+		for (GPUPassStats& stats : passStats)
+		{
+			stats.averageMs = stats.averageMs == 0.0f ? stats.lastMs : glm::mix(stats.averageMs, stats.lastMs, 0.05f);
+			stats.history[stats.historyOffset] = stats.lastMs;
+			stats.historyOffset = (stats.historyOffset + 1) % GPUPassStats::HISTORY_SIZE;
+		}
+	}
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include "Engine.h"
+#include "utility.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+
+namespace Paper
+{
+	struct GPUPassStats
+	{
+		static constexpr uint32_t HISTORY_SIZE = 240;
+
+		std::string name;
+		float lastMs = 0.0f;
+		float averageMs = 0.0f;
+		uint32_t count = 0; //passes with this name in the last resolved frame
+
+		std::array<float, HISTORY_SIZE> history = {};
+		uint32_t historyOffset = 0; //next slot to write, also the oldest entry
+	};
+
+	// Times named render passes on the gpu. Results are read back FRAME_LATENCY frames later
+	// and only if they are already available, so the cpu never waits on the gpu for them.
+	// Begin/EndPass may nest and have to run on the thread that owns the context.
+	class GPUTimer
+	{
+	public:
+		static constexpr uint32_t FRAME_LATENCY = 4;
+
+		virtual ~GPUTimer() = default;
+
+		virtual void BeginFrame() = 0;
+		virtual void BeginPass(const std::string& name) = 0;
+		virtual void EndPass() = 0;
+
+		virtual bool IsSupported() const = 0;
+
+		std::vector<GPUPassStats> GetPassStats() const;
+		uint64_t GetSkippedFrames() const { return skippedFrames; }
+
+		static Shr<GPUTimer> Create();
+
+	protected:
+		//total gpu time per pass of one frame in ns, passes sharing a name are summed up
+		void Resolve(const std::vector<std::pair<std::string, uint64_t>>& passTimes);
+		void SkipFrame() { skippedFrames++; }
+
+	private:
+		mutable std::mutex mutex;
+		std::vector<GPUPassStats> passStats;
+		std::atomic<uint64_t> skippedFrames = 0;
+	};
+}
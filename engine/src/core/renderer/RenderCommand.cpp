@@ -4,10 +4,12 @@
 #include "generic/Application.h"
 #include "renderer/Renderer2D.h"
 #include "renderer/Renderer3D.h"
+#include "renderer/RenderThread.h"
 
 namespace Paper
 {
 	Shr<RenderAPI> RenderCommand::rendererAPI = RenderAPI::CreateAPI();
+	Shr<GPUTimer> RenderCommand::gpuTimer;
 	SharedRenderData RenderCommand::sharedData;
 
 	void RenderCommand::Init()
@@ -16,6 +18,7 @@ namespace Paper
 		
 
 		sharedData.cameraUniformBuffer = UniformBuffer::CreateBuffer(0);
+		gpuTimer = GPUTimer::Create();
 
 		Renderer2D::Init();
 		Renderer3D::Init();
@@ -25,20 +28,30 @@ namespace Paper
 	{
 		Renderer2D::Shutdown();
 		Renderer3D::Shutdown();
+		gpuTimer = nullptr;
 	}
 
 	void RenderCommand::UploadCamera(const Shr<EditorCamera>& editorCamera)
 	{
 		sharedData.cameraData.uProjection = editorCamera->GetProjectionMatrix();
 		sharedData.cameraData.uView = editorCamera->GetViewMatrix();
-		sharedData.cameraUniformBuffer->SetData(&sharedData.cameraData, sizeof(SharedRenderData::CameraData));
+		UploadCameraData(sharedData.cameraData);
 	}
 
 	void RenderCommand::UploadCamera(const EntityCamera& entityCamera, const glm::mat4& viewMatrix)
 	{
 		sharedData.cameraData.uProjection = entityCamera.GetProjectionMatrix();
 		sharedData.cameraData.uView = viewMatrix;
-		sharedData.cameraUniformBuffer->SetData(&sharedData.cameraData, sizeof(SharedRenderData::CameraData));
+		UploadCameraData(sharedData.cameraData);
+	}
+
+	void RenderCommand::UploadCameraData(SharedRenderData::CameraData cameraData)
+	{
+		//the copy travels with the command, sharedData may already hold the next camera when it runs
+		RenderThread::Submit([cameraData]() mutable
+		{
+			sharedData.cameraUniformBuffer->SetData(&cameraData, sizeof(SharedRenderData::CameraData));
+		});
 	}
 
 	SharedRenderData::Stats& RenderCommand::GetStats()
@@ -48,22 +61,69 @@ namespace Paper
 
 	void RenderCommand::ClearStats()
 	{
-		memset(&sharedData.stats, 0, sizeof(SharedRenderData::Stats));
+		sharedData.stats = SharedRenderData::Stats();
+	}
+
+	void RenderCommand::CommitStats(const RenderStats& batchStats)
+	{
+		sharedData.stats += batchStats;
+		sharedData.frameStats += batchStats;
+	}
+
+	const RenderStatsHistory& RenderCommand::GetStatsHistory()
+	{
+		return sharedData.statsHistory;
+	}
+
+	void RenderCommand::NewFrame()
+	{
+		//runs at the top of a frame, what was accumulated belongs to the previous one
+		const uint64_t frame = Application::GetFrameCount();
+		if (frame > 0)
+			sharedData.statsHistory.Push({ .frame = frame - 1, .frameTime = Application::GetDT() * 1000.0f, .stats = sharedData.frameStats });
+		sharedData.frameStats = SharedRenderData::Stats();
+
+		RenderThread::Submit([]() { gpuTimer->BeginFrame(); });
+	}
+
+	void RenderCommand::BeginGPUPass(const std::string& name)
+	{
+		RenderThread::Submit([name]() { gpuTimer->BeginPass(name); });
+	}
+
+	void RenderCommand::EndGPUPass()
+	{
+		RenderThread::Submit([]() { gpuTimer->EndPass(); });
+	}
+
+	bool RenderCommand::IsGPUTimingSupported()
+	{
+		return gpuTimer->IsSupported();
+	}
+
+	std::vector<GPUPassStats> RenderCommand::GetGPUPassStats()
+	{
+		return gpuTimer->GetPassStats();
+	}
+
+	uint64_t RenderCommand::GetGPUSkippedFrames()
+	{
+		return gpuTimer->GetSkippedFrames();
 	}
 
 	void RenderCommand::ClearColor(glm::vec4 color)
 	{
-		rendererAPI->SetClearColor(color);
+		RenderThread::Submit([color]() mutable { rendererAPI->SetClearColor(color); });
 	}
 
 	void RenderCommand::Clear()
 	{
-		rendererAPI->Clear();
+		RenderThread::Submit([]() { rendererAPI->Clear(); });
 	}
 
 	void RenderCommand::EnableDepthTesting(bool enable)
 	{
-		return rendererAPI->EnableDepthTesting(enable);
+		RenderThread::Submit([enable]() { rendererAPI->EnableDepthTesting(enable); });
 	}
 
 	bool RenderCommand::IsDepthTestingEnabled()
@@ -73,26 +133,26 @@ namespace Paper
 
 	void RenderCommand::DrawElements(Shr<VertexArray>& vertexArray, uint32_t elementCount)
 	{
-		rendererAPI->DrawElements(vertexArray, elementCount);
+		RenderThread::Submit([vertexArray, elementCount]() mutable { rendererAPI->DrawElements(vertexArray, elementCount); });
 	}
 
 	void RenderCommand::DrawLines(Shr<VertexArray>& vertexArray, uint32_t vertexCount, float thickness)
 	{
-		rendererAPI->DrawLines(vertexArray, vertexCount, thickness);
+		RenderThread::Submit([vertexArray, vertexCount, thickness]() mutable { rendererAPI->DrawLines(vertexArray, vertexCount, thickness); });
 	}
 
 	void RenderCommand::SetViewPort(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 	{
-		rendererAPI->SetViewPort(x, y, width, height);
+		RenderThread::Submit([x, y, width, height]() { rendererAPI->SetViewPort(x, y, width, height); });
 	}
 
 	void RenderCommand::SetLineThickness(float width)
 	{
-		rendererAPI->SetLineWidth(width);
+		RenderThread::Submit([width]() { rendererAPI->SetLineWidth(width); });
 	}
 
 	void RenderCommand::SetPolygonModel(Polygon pol)
 	{
-		rendererAPI->SetPolygonModel(pol);
+		RenderThread::Submit([pol]() { rendererAPI->SetPolygonModel(pol); });
 	}
 }
@@ -4,6 +4,8 @@
 
 #include "renderer/VertexArray.h"
 #include "renderer/RenderAPI.h"
+#include "renderer/GPUTimer.h"
+#include "renderer/RenderStats.h"
 #include "camera/EditorCamera.h"
 #include "camera/EntityCamera.h"
 
@@ -20,21 +22,20 @@ namespace Paper
 		CameraData cameraData;
 		Shr<UniformBuffer> cameraUniformBuffer;
 
-		struct Stats
-		{
-			uint32_t drawCalls = 0;
-			uint32_t dataSize = 0;
-			uint32_t objectCount = 0;
-			uint32_t vertexCount = 0;
-			uint32_t elementCount = 0;
-		};
-		Stats stats;
+		using Stats = RenderStats;
+		Stats stats; //since the last ClearStats
+		Stats frameStats; //everything drawn this frame
+		RenderStatsHistory statsHistory;
 	};
 
+	// Every call that reaches the graphics api is submitted to the RenderThread.
 	class RenderCommand
 	{
 	private:
 		static Shr<RenderAPI> rendererAPI;
+		static Shr<GPUTimer> gpuTimer;
+
+		static void UploadCameraData(SharedRenderData::CameraData cameraData);
 
 	public:
 		static SharedRenderData sharedData;
@@ -44,8 +45,21 @@ namespace Paper
 
 		static void UploadCamera(const Shr<EditorCamera>& camera);
 		static void UploadCamera(const EntityCamera& entityCamera, const glm::mat4& viewMatrix);
+		//closes the stats of the last frame and starts gpu timing for the new one
+		static void NewFrame();
+
 		static SharedRenderData::Stats& GetStats();
 		static void ClearStats();
+		//renderers add the stats of a batch once, when it is flushed
+		static void CommitStats(const RenderStats& batchStats);
+		static const RenderStatsHistory& GetStatsHistory();
+
+		//gpu time of named passes, resolved a few frames late
+		static void BeginGPUPass(const std::string& name);
+		static void EndGPUPass();
+		static bool IsGPUTimingSupported();
+		static std::vector<GPUPassStats> GetGPUPassStats();
+		static uint64_t GetGPUSkippedFrames();
 
 		static void ClearColor(glm::vec4 color);
 		static void Clear();
@@ -58,5 +72,15 @@ namespace Paper
 		static void SetPolygonModel(Polygon pol);
 	};
 
+	class ScopedGPUPass
+	{
+	public:
+		ScopedGPUPass(const std::string& name) { RenderCommand::BeginGPUPass(name); }
+		~ScopedGPUPass() { RenderCommand::EndGPUPass(); }
+
+		ScopedGPUPass(const ScopedGPUPass&) = delete;
+		ScopedGPUPass& operator=(const ScopedGPUPass&) = delete;
+	};
+
 }
 
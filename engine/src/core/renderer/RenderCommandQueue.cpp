@@ -0,0 +1,89 @@
+#include "Engine.h"
+#include "RenderCommandQueue.h"
+
+namespace Paper
+{
+	static uint32_t AlignUp(uint32_t value, uint32_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	RenderCommandQueue::~RenderCommandQueue()
+	{
+		//commands that never ran still own their captures
+		Execute();
+
+		for (Chunk& chunk : chunks)
+		{
+			MemoryTracker::Untrack(MemoryTag::Renderer, chunk.capacity);
+			::operator delete[](chunk.memory, std::align_val_t(alignof(std::max_align_t)));
+		}
+	}
+
+	void* RenderCommandQueue::AllocateData(uint32_t size, uint32_t alignment)
+	{
+		return Allocate(nullptr, size, alignment);
+	}
+
+	void* RenderCommandQueue::Allocate(CommandFn fn, uint32_t size, uint32_t alignment)
+	{
+		alignment = std::max<uint32_t>(alignment, alignof(Header));
+		CORE_ASSERT(alignment <= alignof(std::max_align_t), "over aligned render commands are not supported");
+
+		const uint32_t payloadOffset = AlignUp(sizeof(Header), alignment);
+		const uint32_t recordSize = AlignUp(payloadOffset + size, alignof(Header));
+
+		//find a chunk with room, records bigger than a chunk get one of their own
+		while (currentChunk < chunks.size() && chunks[currentChunk].used + recordSize > chunks[currentChunk].capacity)
+			currentChunk++;
+
+		if (currentChunk == chunks.size())
+		{
+			Chunk chunk;
+			chunk.capacity = std::max(CHUNK_SIZE, recordSize);
+			chunk.memory = (uint8_t*)::operator new[](chunk.capacity, std::align_val_t(alignof(std::max_align_t)));
+			chunks.push_back(chunk);
+			MemoryTracker::Track(MemoryTag::Renderer, chunk.capacity);
+		}
+
+		Chunk& chunk = chunks[currentChunk];
+		uint8_t* record = chunk.memory + chunk.used;
+		chunk.used += recordSize;
+
+		Header* header = (Header*)record;
+		header->fn = fn;
+		header->payloadOffset = payloadOffset;
+		header->size = recordSize;
+
+		if (fn) commandCount++;
+
+		return record + payloadOffset;
+	}
+
+	void RenderCommandQueue::Execute()
+	{
+		for (Chunk& chunk : chunks)
+		{
+			uint32_t offset = 0;
+			while (offset < chunk.used)
+			{
+				const Header* header = (const Header*)(chunk.memory + offset);
+				if (header->fn)
+					header->fn(chunk.memory + offset + header->payloadOffset);
+				offset += header->size;
+			}
+			chunk.used = 0;
+		}
+
+		currentChunk = 0;
+		commandCount = 0;
+	}
+
+	size_t RenderCommandQueue::GetUsedBytes() const
+	{
+		size_t used = 0;
+		for (const Chunk& chunk : chunks)
+			used += chunk.used;
+		return used;
+	}
+}
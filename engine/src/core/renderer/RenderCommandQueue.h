@@ -0,0 +1,67 @@
+#pragma once
+#include "Engine.h"
+
+namespace Paper
+{
+	// Records type erased commands into chunked linear memory and runs them later in order.
+	// Chunks are kept between frames, so recording a frame doesn't allocate once warmed up.
+	class RenderCommandQueue
+	{
+	public:
+		using CommandFn = void(*)(void*);
+
+		RenderCommandQueue() = default;
+		~RenderCommandQueue();
+
+		RenderCommandQueue(const RenderCommandQueue&) = delete;
+		RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+		template<typename Fn>
+		void Submit(Fn&& fn)
+		{
+			using Command = std::decay_t<Fn>;
+
+			//runs the command and destroys it in place, the memory goes back with the chunk
+			const CommandFn thunk = [](void* ptr)
+			{
+				Command* command = (Command*)ptr;
+				(*command)();
+				command->~Command();
+			};
+
+			void* memory = Allocate(thunk, sizeof(Command), alignof(Command));
+			new (memory) Command(std::forward<Fn>(fn));
+		}
+
+		//raw memory that stays valid until the queue has been executed
+		void* AllocateData(uint32_t size, uint32_t alignment = 16);
+
+		void Execute();
+
+		uint32_t GetCommandCount() const { return commandCount; }
+		size_t GetUsedBytes() const;
+
+	private:
+		static constexpr uint32_t CHUNK_SIZE = 1024 * 1024;
+
+		struct Header
+		{
+			CommandFn fn; //nullptr for plain data
+			uint32_t payloadOffset; //from the header
+			uint32_t size; //whole record, header included
+		};
+
+		struct Chunk
+		{
+			uint8_t* memory = nullptr;
+			uint32_t capacity = 0;
+			uint32_t used = 0;
+		};
+
+		void* Allocate(CommandFn fn, uint32_t size, uint32_t alignment);
+
+		std::vector<Chunk> chunks;
+		uint32_t currentChunk = 0;
+		uint32_t commandCount = 0;
+	};
+}
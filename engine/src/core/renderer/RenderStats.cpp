@@ -0,0 +1,93 @@
+#include "Engine.h"
+#include "RenderStats.h"
+
+namespace Paper
+{
+	RenderStats& RenderStats::operator+=(const RenderStats& other)
+	{
+		drawCalls += other.drawCalls;
+		dataSize += other.dataSize;
+		objectCount += other.objectCount;
+		vertexCount += other.vertexCount;
+		elementCount += other.elementCount;
+		capacityFlushes += other.capacityFlushes;
+		textureFlushes += other.textureFlushes;
+		return *this;
+	}
+
+	void RenderStatsHistory::Push(const RenderStatsFrame& frame)
+	{
+		if (size < CAPACITY)
+		{
+			frames[(offset + size) % CAPACITY] = frame;
+			size++;
+			return;
+		}
+
+		frames[offset] = frame;
+		offset = (offset + 1) % CAPACITY;
+	}
+
+	void RenderStatsHistory::Clear()
+	{
+		offset = 0;
+		size = 0;
+	}
+
+	bool RenderStatsHistory::Export(const std::filesystem::path& filePath) const
+	{
+		if (filePath.extension() == ".json")
+			return ExportJSON(filePath);
+		return ExportCSV(filePath);
+	}
+
+	bool RenderStatsHistory::ExportCSV(const std::filesystem::path& filePath) const
+	{
+		std::ofstream out(filePath);
+		if (!out)
+		{
+			LOG_CORE_ERROR("Could not write render stats to '{}'", filePath.string());
+			return false;
+		}
+
+		out << "frame,frameTimeMs,drawCalls,dataSize,objectCount,vertexCount,elementCount,capacityFlushes,textureFlushes\n";
+		for (uint32_t i = 0; i < size; i++)
+		{
+			const RenderStatsFrame& frame = Get(i);
+			const RenderStats& stats = frame.stats;
+			out << frame.frame << ',' << frame.frameTime << ',' << stats.drawCalls << ',' << stats.dataSize << ','
+				<< stats.objectCount << ',' << stats.vertexCount << ',' << stats.elementCount << ','
+				<< stats.capacityFlushes << ',' << stats.textureFlushes << '\n';
+		}
+		return true;
+	}
+
+	bool RenderStatsHistory::ExportJSON(const std::filesystem::path& filePath) const
+	{
+		std::ofstream out(filePath);
+		if (!out)
+		{
+			LOG_CORE_ERROR("Could not write render stats to '{}'", filePath.string());
+			return false;
+		}
+
+		out << "{\"frames\":[";
+		for (uint32_t i = 0; i < size; i++)
+		{
+			const RenderStatsFrame& frame = Get(i);
+			const RenderStats& stats = frame.stats;
+			out << (i ? ",\n" : "\n")
+				<< "{\"frame\":" << frame.frame
+				<< ",\"frameTimeMs\":" << frame.frameTime
+				<< ",\"drawCalls\":" << stats.drawCalls
+				<< ",\"dataSize\":" << stats.dataSize
+				<< ",\"objectCount\":" << stats.objectCount
+				<< ",\"vertexCount\":" << stats.vertexCount
+				<< ",\"elementCount\":" << stats.elementCount
+				<< ",\"capacityFlushes\":" << stats.capacityFlushes
+				<< ",\"textureFlushes\":" << stats.textureFlushes << "}";
+		}
+		out << "\n]}\n";
+		return true;
+	}
+}
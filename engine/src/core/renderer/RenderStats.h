@@ -0,0 +1,55 @@
+#pragma once
+#include "Engine.h"
+#include "utility.h"
+
+#include <array>
+
+namespace Paper
+{
+	struct RenderStats
+	{
+		uint32_t drawCalls = 0;
+		uint32_t dataSize = 0;
+		uint32_t objectCount = 0;
+		uint32_t vertexCount = 0;
+		uint32_t elementCount = 0;
+
+		//why batches were flushed before the end of the pass
+		uint32_t capacityFlushes = 0;
+		uint32_t textureFlushes = 0;
+
+		RenderStats& operator+=(const RenderStats& other);
+	};
+
+	struct RenderStatsFrame
+	{
+		uint64_t frame = 0;
+		float frameTime = 0.0f; //ms
+		RenderStats stats;
+	};
+
+	// Fixed size ring of the last frames' render stats.
+	class RenderStatsHistory
+	{
+	public:
+		static constexpr uint32_t CAPACITY = 1024;
+
+		void Push(const RenderStatsFrame& frame);
+		void Clear();
+
+		uint32_t GetSize() const { return size; }
+		//0 is the oldest frame still kept
+		const RenderStatsFrame& Get(uint32_t index) const { return frames[(offset + index) % CAPACITY]; }
+		const RenderStatsFrame& GetLatest() const { return Get(size - 1); }
+
+		//the format follows the extension, .json or anything else for csv
+		bool Export(const std::filesystem::path& filePath) const;
+		bool ExportCSV(const std::filesystem::path& filePath) const;
+		bool ExportJSON(const std::filesystem::path& filePath) const;
+
+	private:
+		std::array<RenderStatsFrame, CAPACITY> frames = {};
+		uint32_t offset = 0; //oldest
+		uint32_t size = 0;
+	};
+}
@@ -0,0 +1,222 @@
+#include "Engine.h"
+#include "RenderThread.h"
+
+#include "generic/Application.h"
+
+#include <condition_variable>
+#include <future>
+
+namespace Paper
+{
+	struct RenderThreadData
+	{
+		RenderThreadPolicy policy = RenderThreadPolicy::SingleThreaded;
+
+		std::thread thread;
+		std::atomic<bool> threaded = false;
+		std::atomic<std::thread::id> renderThreadID;
+
+		//the main thread records into queues[submitIndex] while the render thread replays the other one
+		RenderCommandQueue queues[2];
+		uint32_t submitIndex = 0;
+
+		std::mutex mutex;
+		std::condition_variable condition;
+		bool running = false;
+		bool frameReady = false;
+		bool rendering = false;
+		std::vector<std::packaged_task<void()>> syncJobs;
+
+		float lastRenderTime = 0.0f;
+		RenderThreadStats stats;
+	};
+
+	static RenderThreadData data;
+
+	void RenderThread::SetPolicy(RenderThreadPolicy policy)
+	{
+		CORE_ASSERT(!data.threaded, "the render thread policy can't change while the render thread is running");
+		data.policy = policy;
+	}
+
+	RenderThreadPolicy RenderThread::GetPolicy()
+	{
+		return data.policy;
+	}
+
+	void RenderThread::Start()
+	{
+		if (data.policy != RenderThreadPolicy::MultiThreaded || data.threaded)
+			return;
+
+		//the context can only be current on one thread at a time
+		Application::GetWindow()->MakeContextCurrent(false);
+
+		data.running = true;
+		data.frameReady = false;
+		data.rendering = false;
+		data.submitIndex = 0;
+		data.stats = RenderThreadStats();
+
+		data.threaded = true;
+		data.thread = std::thread(Loop);
+
+		LOG_CORE_TRACE("Started render thread");
+	}
+
+	void RenderThread::Shutdown()
+	{
+		if (!data.threaded)
+			return;
+
+		WaitIdle();
+
+		{
+			std::scoped_lock<std::mutex> lock(data.mutex);
+			data.running = false;
+		}
+		data.condition.notify_all();
+		data.thread.join();
+
+		data.threaded = false;
+		data.renderThreadID = std::thread::id();
+
+		Application::GetWindow()->MakeContextCurrent(true);
+	}
+
+	bool RenderThread::IsThreaded()
+	{
+		return data.threaded;
+	}
+
+	bool RenderThread::IsRenderThread()
+	{
+		return data.renderThreadID.load() == std::this_thread::get_id();
+	}
+
+	const void* RenderThread::CopyToFrame(const void* source, uint32_t size)
+	{
+		if (!IsThreaded() || IsRenderThread())
+			return source;
+
+		void* destination = GetSubmitQueue().AllocateData(size);
+		memcpy(destination, source, size);
+		return destination;
+	}
+
+	void RenderThread::ExecuteSync(const std::function<void()>& fn)
+	{
+		if (!IsThreaded() || IsRenderThread())
+		{
+			fn();
+			return;
+		}
+
+		std::packaged_task<void()> task(fn);
+		std::future<void> done = task.get_future();
+		{
+			std::scoped_lock<std::mutex> lock(data.mutex);
+			data.syncJobs.push_back(std::move(task));
+		}
+		data.condition.notify_all();
+		done.wait();
+	}
+
+	void RenderThread::Kick()
+	{
+		if (!IsThreaded())
+			return;
+
+		PAPER_PROFILE_FUNCTION();
+		const auto waitStart = std::chrono::high_resolution_clock::now();
+
+		std::unique_lock<std::mutex> lock(data.mutex);
+		data.condition.wait(lock, [] { return !data.frameReady && !data.rendering; });
+
+		const RenderCommandQueue& queue = data.queues[data.submitIndex];
+		data.stats.commandCount = queue.GetCommandCount();
+		data.stats.commandBytes = queue.GetUsedBytes();
+		data.stats.renderTime = data.lastRenderTime;
+		data.stats.waitTime = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - waitStart).count();
+
+		data.submitIndex ^= 1;
+		data.frameReady = true;
+
+		lock.unlock();
+		data.condition.notify_all();
+	}
+
+	void RenderThread::WaitIdle()
+	{
+		if (!IsThreaded())
+			return;
+
+		Kick();
+
+		std::unique_lock<std::mutex> lock(data.mutex);
+		data.condition.wait(lock, [] { return !data.frameReady && !data.rendering; });
+	}
+
+	const RenderThreadStats& RenderThread::GetStats()
+	{
+		return data.stats;
+	}
+
+	RenderCommandQueue& RenderThread::GetSubmitQueue()
+	{
+		return data.queues[data.submitIndex];
+	}
+
+	void RenderThread::Loop()
+	{
+		data.renderThreadID = std::this_thread::get_id();
+		PAPER_PROFILE_THREAD("Render Thread");
+		Application::GetWindow()->MakeContextCurrent(true);
+
+		std::unique_lock<std::mutex> lock(data.mutex);
+		while (true)
+		{
+			data.condition.wait(lock, [] { return data.frameReady || !data.syncJobs.empty() || !data.running; });
+
+			//blocking requests go first, the main thread is stalled on them
+			if (!data.syncJobs.empty())
+			{
+				std::vector<std::packaged_task<void()>> jobs = std::move(data.syncJobs);
+				data.syncJobs.clear();
+
+				lock.unlock();
+				for (std::packaged_task<void()>& job : jobs)
+					job();
+				lock.lock();
+				continue;
+			}
+
+			if (data.frameReady)
+			{
+				data.frameReady = false;
+				data.rendering = true;
+				RenderCommandQueue& queue = data.queues[data.submitIndex ^ 1];
+
+				lock.unlock();
+				const auto renderStart = std::chrono::high_resolution_clock::now();
+				{
+					PAPER_PROFILE_SCOPE("RenderThread::Execute");
+					queue.Execute();
+				}
+				const float renderTime = std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - renderStart).count();
+				lock.lock();
+
+				data.lastRenderTime = renderTime;
+				data.rendering = false;
+				data.condition.notify_all();
+				continue;
+			}
+
+			if (!data.running)
+				break;
+		}
+		lock.unlock();
+
+		Application::GetWindow()->MakeContextCurrent(false);
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+#include "Engine.h"
+
+#include "renderer/RenderCommandQueue.h"
+
+namespace Paper
+{
+	enum class RenderThreadPolicy
+	{
+		//everything runs on the main thread, submitted commands execute immediately
+		SingleThreaded,
+		//a dedicated thread owns the graphics context and replays the previous frame's commands
+		//while the main thread records the next one
+		MultiThreaded
+	};
+
+	struct RenderThreadStats
+	{
+		float renderTime = 0.0f; //ms the render thread spent on the last frame
+		float waitTime = 0.0f; //ms the main thread waited for it at the last kick
+		uint32_t commandCount = 0;
+		size_t commandBytes = 0;
+	};
+
+	// Owner of the graphics context. Code that touches the graphics api goes through Submit,
+	// resource creation and read backs that need a result go through ExecuteSync.
+	class RenderThread
+	{
+	public:
+		static void SetPolicy(RenderThreadPolicy policy);
+		static RenderThreadPolicy GetPolicy();
+
+		//with the MultiThreaded policy, hands the context over to a new thread
+		static void Start();
+		static void Shutdown();
+
+		static bool IsThreaded();
+		static bool IsRenderThread();
+
+		template<typename Fn>
+		static void Submit(Fn&& fn)
+		{
+			if (!IsThreaded() || IsRenderThread())
+				fn();
+			else
+				GetSubmitQueue().Submit(std::forward<Fn>(fn));
+		}
+
+		//copies data into the frame being recorded, so the source can be reused right away
+		static const void* CopyToFrame(const void* data, uint32_t size);
+
+		//runs fn on the render thread and blocks until it is done
+		static void ExecuteSync(const std::function<void()>& fn);
+
+		//ends the recorded frame: waits for the previous one to finish and hands this one over
+		static void Kick();
+		static void WaitIdle();
+
+		static const RenderThreadStats& GetStats();
+
+	private:
+		static RenderCommandQueue& GetSubmitQueue();
+		static void Loop();
+	};
+}
@@ -2,7 +2,8 @@
 
 #include "renderer/Renderer2D.h"
 #include "renderer/RenderCommand.h"
-#include "utils/DataPool.h"
+#include "renderer/RenderThread.h"
+#include "assets/AssetManager.h"
 #include "renderer/Shader.h"
 #include "generic/Application.h"
 #include "imgui/ImGuiLayer.h"
@@ -179,16 +180,16 @@ namespace Paper {
 			{ GLSLDataType::INT , "aAlphaCoreID" }
 		};
 
-		data.edgeGeometryShader = DataPool::GetShader("EdgeGeometryShader_2D");
+		data.edgeGeometryShader = AssetManager::GetShared(AssetManager::LoadShader("EdgeGeometryShader_2D"));
 		data.edgeGeometryShader->Compile();
 
-		data.lineGeometryShader = DataPool::GetShader("LineGeometryShader_2D");
+		data.lineGeometryShader = AssetManager::GetShared(AssetManager::LoadShader("LineGeometryShader_2D"));
 		data.lineGeometryShader->Compile();
 
-		data.circleGeometryShader = DataPool::GetShader("CircleGeometryShader_2D");
+		data.circleGeometryShader = AssetManager::GetShared(AssetManager::LoadShader("CircleGeometryShader_2D"));
 		data.circleGeometryShader->Compile();
 
-		data.textShader = DataPool::GetShader("TextShader_2D");
+		data.textShader = AssetManager::GetShared(AssetManager::LoadShader("TextShader_2D"));
 		data.textShader->Compile();
 
 		data.rectangleVertexArray = VertexArray::CreateArray();
@@ -262,11 +263,11 @@ namespace Paper {
 		data.triangleVertexData[1] = glm::vec4( 0.5f, -0.5f, 0.0f, 1.0f);
 		data.triangleVertexData[2] = glm::vec4( 0.0f,  0.5f, 0.0f, 1.0f);
 
-		data.rectangleVertexBufferBase = new EdgeVertex[data.MAX_VERTICES];
-		data.triangleVertexBufferBase = new EdgeVertex[data.MAX_VERTICES];
-		data.circleVertexBufferBase = new CircleVertex[data.MAX_VERTICES];
-		data.lineVertexBufferBase = new LineVertex[data.MAX_VERTICES];
-		data.textVertexBufferBase = new TextVertex[data.MAX_VERTICES];
+		data.rectangleVertexBufferBase = MemoryTracker::NewArray<EdgeVertex>(data.MAX_VERTICES, MemoryTag::Renderer);
+		data.triangleVertexBufferBase = MemoryTracker::NewArray<EdgeVertex>(data.MAX_VERTICES, MemoryTag::Renderer);
+		data.circleVertexBufferBase = MemoryTracker::NewArray<CircleVertex>(data.MAX_VERTICES, MemoryTag::Renderer);
+		data.lineVertexBufferBase = MemoryTracker::NewArray<LineVertex>(data.MAX_VERTICES, MemoryTag::Renderer);
+		data.textVertexBufferBase = MemoryTracker::NewArray<TextVertex>(data.MAX_VERTICES, MemoryTag::Renderer);
 
 		for (uint32_t i = 0; i < data.MAX_TEXTURE_SLOTS - 1; i++)
 		{
@@ -278,11 +279,11 @@ namespace Paper {
 
 	void Renderer2D::Shutdown()
 	{
-		delete[] data.rectangleVertexBufferBase;
-		delete[] data.triangleVertexBufferBase;
-		delete[] data.circleVertexBufferBase;
-		delete[] data.lineVertexBufferBase;
-		delete[] data.textVertexBufferBase;
+		MemoryTracker::DeleteArray(data.rectangleVertexBufferBase, data.MAX_VERTICES, MemoryTag::Renderer);
+		MemoryTracker::DeleteArray(data.triangleVertexBufferBase, data.MAX_VERTICES, MemoryTag::Renderer);
+		MemoryTracker::DeleteArray(data.circleVertexBufferBase, data.MAX_VERTICES, MemoryTag::Renderer);
+		MemoryTracker::DeleteArray(data.lineVertexBufferBase, data.MAX_VERTICES, MemoryTag::Renderer);
+		MemoryTracker::DeleteArray(data.textVertexBufferBase, data.MAX_VERTICES, MemoryTag::Renderer);
 	}
 
 	void Renderer2D::BeginRender(const Shr<EditorCamera>& camera)
@@ -352,100 +353,133 @@ namespace Paper {
 
 	void Renderer2D::Render(RenderTarget2D target)
 	{
-		const SharedRenderData& sharedData = RenderCommand::sharedData;
-		sharedData.cameraUniformBuffer->Bind();
+		PAPER_PROFILE_FUNCTION();
 
+		//the cpu side batches are restarted right after this, so every draw gets its own copy of the
+		//vertices and texture slots in the frame's command stream
 		if (data.rectangleElementCount && (target == RECTANGLE || target == ALL))
 		{
 			const uint32_t dataSize = (uint32_t)((uint8_t*)data.rectangleVertexBufferPtr - (uint8_t*)data.rectangleVertexBufferBase);
-			data.rectangleVertexBuffer->AddData(data.rectangleVertexBufferBase, dataSize);
-			RenderCommand::GetStats().dataSize += dataSize;
+			RenderCommand::CommitStats({ .drawCalls = 1, .dataSize = dataSize, .objectCount = data.rectangleElementCount / 6,
+				.vertexCount = dataSize / (uint32_t)sizeof(EdgeVertex), .elementCount = data.rectangleElementCount });
+			ScopedGPUPass gpuPass("2D Rectangles");
 
-			//bind textures
-			for (uint32_t i = 0; i < data.rectangleTextureSlotIndex; i++)
-				data.rectangleTextureSlots[i]->Bind(i);
-
-			data.edgeGeometryShader->Bind();
-			data.edgeGeometryShader->UploadIntArray("uTexture", data.MAX_TEXTURE_SLOTS - 1, texSlots);
-			RenderCommand::DrawElements(data.rectangleVertexArray, data.rectangleElementCount);
-			data.edgeGeometryShader->Unbind();
-			RenderCommand::GetStats().drawCalls++;
-
-			//unbind textures
-			for (uint32_t i = 0; i < data.rectangleTextureSlotIndex; i++)
-				data.rectangleTextureSlots[i]->Unbind();
+			RenderThread::Submit([vertices = RenderThread::CopyToFrame(data.rectangleVertexBufferBase, dataSize), dataSize,
+				elementCount = data.rectangleElementCount, textures = data.rectangleTextureSlots, textureCount = data.rectangleTextureSlotIndex]()
+			{
+				RenderCommand::sharedData.cameraUniformBuffer->Bind();
+				data.rectangleVertexBuffer->AddData(vertices, dataSize);
+
+				//bind textures
+				for (uint32_t i = 0; i < textureCount; i++)
+					textures[i]->Bind(i);
+
+				data.edgeGeometryShader->Bind();
+				data.edgeGeometryShader->UploadIntArray("uTexture", data.MAX_TEXTURE_SLOTS - 1, texSlots);
+				RenderCommand::DrawElements(data.rectangleVertexArray, elementCount);
+				data.edgeGeometryShader->Unbind();
+
+				//unbind textures
+				for (uint32_t i = 0; i < textureCount; i++)
+					textures[i]->Unbind();
+			});
 		}
 
 		if (data.triangleElementCount && (target == TRIANGLE || target == ALL))
 		{
 			const uint32_t dataSize = (uint32_t)((uint8_t*)data.triangleVertexBufferPtr - (uint8_t*)data.triangleVertexBufferBase);
-			data.triangleVertexBuffer->AddData(data.triangleVertexBufferBase, dataSize);
-			RenderCommand::GetStats().dataSize += dataSize;
-		
-			//bind textures
-			for (uint32_t i = 0; i < data.triangleTextureSlotIndex; i++)
-				data.triangleTextureSlots[i]->Bind(i);
+			RenderCommand::CommitStats({ .drawCalls = 1, .dataSize = dataSize, .objectCount = data.triangleElementCount / 3,
+				.vertexCount = dataSize / (uint32_t)sizeof(EdgeVertex), .elementCount = data.triangleElementCount });
+			ScopedGPUPass gpuPass("2D Triangles");
 
-			//data.framebuffer->BindAttachmentAsTexture(1, data.MAX_TEXTURE_SLOTS - 1);
+			RenderThread::Submit([vertices = RenderThread::CopyToFrame(data.triangleVertexBufferBase, dataSize), dataSize,
+				elementCount = data.triangleElementCount, textures = data.triangleTextureSlots, textureCount = data.triangleTextureSlotIndex]()
+			{
+				RenderCommand::sharedData.cameraUniformBuffer->Bind();
+				data.triangleVertexBuffer->AddData(vertices, dataSize);
 
-			data.edgeGeometryShader->Bind();
-			data.edgeGeometryShader->UploadIntArray("uTexture", data.MAX_TEXTURE_SLOTS, texSlots);
-			RenderCommand::DrawElements(data.triangleVertexArray, data.triangleElementCount);
-			data.edgeGeometryShader->Unbind();
-			RenderCommand::GetStats().drawCalls++;
-		
-			//unbind textures
-			for (uint32_t i = 0; i < data.triangleTextureSlotIndex; i++)
-				data.triangleTextureSlots[i]->Unbind();
+				//bind textures
+				for (uint32_t i = 0; i < textureCount; i++)
+					textures[i]->Bind(i);
+
+				//data.framebuffer->BindAttachmentAsTexture(1, data.MAX_TEXTURE_SLOTS - 1);
+
+				data.edgeGeometryShader->Bind();
+				data.edgeGeometryShader->UploadIntArray("uTexture", data.MAX_TEXTURE_SLOTS, texSlots);
+				RenderCommand::DrawElements(data.triangleVertexArray, elementCount);
+				data.edgeGeometryShader->Unbind();
+
+				//unbind textures
+				for (uint32_t i = 0; i < textureCount; i++)
+					textures[i]->Unbind();
+			});
 		}
 
 		if (data.circleElementCount && (target == CIRCLE || target == ALL))
 		{
-			uint32_t dataSize = (uint32_t)((uint8_t*)data.circleVertexBufferPtr - (uint8_t*)data.circleVertexBufferBase);
-			data.circleVertexBuffer->AddData(data.circleVertexBufferBase, dataSize);
-			RenderCommand::GetStats().dataSize += dataSize;
+			const uint32_t dataSize = (uint32_t)((uint8_t*)data.circleVertexBufferPtr - (uint8_t*)data.circleVertexBufferBase);
+			RenderCommand::CommitStats({ .drawCalls = 1, .dataSize = dataSize, .objectCount = data.circleElementCount / 6,
+				.vertexCount = dataSize / (uint32_t)sizeof(CircleVertex), .elementCount = data.circleElementCount });
+			ScopedGPUPass gpuPass("2D Circles");
 
+			RenderThread::Submit([vertices = RenderThread::CopyToFrame(data.circleVertexBufferBase, dataSize), dataSize,
+				elementCount = data.circleElementCount, textures = data.circleTextureSlots, textureCount = data.circleTextureSlotIndex]()
+			{
+				RenderCommand::sharedData.cameraUniformBuffer->Bind();
+				data.circleVertexBuffer->AddData(vertices, dataSize);
 
-			//bind textures
-			for (uint32_t i = 0; i < data.circleTextureSlotIndex; i++)
-				data.circleTextureSlots[i]->Bind(i);
+				//bind textures
+				for (uint32_t i = 0; i < textureCount; i++)
+					textures[i]->Bind(i);
 
-			data.circleGeometryShader->Bind();
-			data.circleGeometryShader->UploadIntArray("uTexture", data.MAX_TEXTURE_SLOTS, texSlots);
-			RenderCommand::DrawElements(data.circleVertexArray, data.circleElementCount);
-			data.circleGeometryShader->Unbind();
-			RenderCommand::GetStats().drawCalls++;
+				data.circleGeometryShader->Bind();
+				data.circleGeometryShader->UploadIntArray("uTexture", data.MAX_TEXTURE_SLOTS, texSlots);
+				RenderCommand::DrawElements(data.circleVertexArray, elementCount);
+				data.circleGeometryShader->Unbind();
 
-			for (uint32_t i = 0; i < data.circleTextureSlotIndex; i++)
-				data.circleTextureSlots[i]->Unbind();
+				for (uint32_t i = 0; i < textureCount; i++)
+					textures[i]->Unbind();
+			});
 		}
 
 		if (data.lineElementCount && (target == LINE || target == ALL))
 		{
-			uint32_t dataSize = (uint32_t)((uint8_t*)data.lineVertexBufferPtr - (uint8_t*)data.lineVertexBufferBase);
-			data.lineVertexBuffer->AddData(data.lineVertexBufferBase, dataSize);
-			RenderCommand::GetStats().dataSize += dataSize;
-
-			
-			data.lineGeometryShader->Bind();
-			RenderCommand::SetLineThickness(data.lineWidth);
-			RenderCommand::DrawLines(data.lineVertexArray, data.lineElementCount, data.lineWidth);
-			data.lineGeometryShader->Unbind();
-			RenderCommand::GetStats().drawCalls++;
+			const uint32_t dataSize = (uint32_t)((uint8_t*)data.lineVertexBufferPtr - (uint8_t*)data.lineVertexBufferBase);
+			RenderCommand::CommitStats({ .drawCalls = 1, .dataSize = dataSize, .objectCount = data.lineElementCount / 2,
+				.vertexCount = dataSize / (uint32_t)sizeof(LineVertex), .elementCount = data.lineElementCount });
+			ScopedGPUPass gpuPass("2D Lines");
+
+			RenderThread::Submit([vertices = RenderThread::CopyToFrame(data.lineVertexBufferBase, dataSize), dataSize,
+				elementCount = data.lineElementCount, lineWidth = data.lineWidth]()
+			{
+				RenderCommand::sharedData.cameraUniformBuffer->Bind();
+				data.lineVertexBuffer->AddData(vertices, dataSize);
+
+				data.lineGeometryShader->Bind();
+				RenderCommand::SetLineThickness(lineWidth);
+				RenderCommand::DrawLines(data.lineVertexArray, elementCount, lineWidth);
+				data.lineGeometryShader->Unbind();
+			});
 		}
 
 		if (data.textElementCount && (target == TEXT || target == ALL))
 		{
-			uint32_t dataSize = (uint32_t)((uint8_t*)data.textVertexBufferPtr - (uint8_t*)data.textVertexBufferBase);
-			data.textVertexBuffer->AddData(data.textVertexBufferBase, dataSize);
-			RenderCommand::GetStats().dataSize += dataSize;
+			const uint32_t dataSize = (uint32_t)((uint8_t*)data.textVertexBufferPtr - (uint8_t*)data.textVertexBufferBase);
+			RenderCommand::CommitStats({ .drawCalls = 1, .dataSize = dataSize, .objectCount = data.textElementCount / 6,
+				.vertexCount = dataSize / (uint32_t)sizeof(TextVertex), .elementCount = data.textElementCount });
+			ScopedGPUPass gpuPass("2D Text");
 
+			RenderThread::Submit([vertices = RenderThread::CopyToFrame(data.textVertexBufferBase, dataSize), dataSize,
+				elementCount = data.textElementCount, fontAtlasTexture = data.fontAtlasTexture]()
+			{
+				RenderCommand::sharedData.cameraUniformBuffer->Bind();
+				data.textVertexBuffer->AddData(vertices, dataSize);
 
-			data.fontAtlasTexture->Bind(0);
+				fontAtlasTexture->Bind(0);
 
-			data.textShader->Bind();
-			RenderCommand::DrawElements(data.textVertexArray, data.textElementCount);
-			RenderCommand::GetStats().drawCalls++;
+				data.textShader->Bind();
+				RenderCommand::DrawElements(data.textVertexArray, elementCount);
+			});
 		}
 	}
 
@@ -457,15 +491,16 @@ namespace Paper {
 
 		if (data.rectangleElementCount >= data.MAX_ELEMENTS)
 		{
+			RenderCommand::CommitStats({ .capacityFlushes = 1 });
 			NextBatch(RECTANGLE);
 		}
 
 		int texIndex = -1;
-		if (renderData.texture != nullptr)
+		if (Texture* texture = AssetManager::Get(renderData.texture))
 		{
 			for (uint32_t i = 0; i < data.rectangleTextureSlotIndex; i++)
 			{
-				if (*data.rectangleTextureSlots[i] == *renderData.texture)
+				if (data.rectangleTextureSlots[i].get() == texture)
 				{
 					texIndex = i;
 					break;
@@ -475,10 +510,13 @@ namespace Paper {
 			if (texIndex == -1)
 			{
 				if (data.rectangleTextureSlotIndex >= data.MAX_TEXTURE_SLOTS)
+				{
+					RenderCommand::CommitStats({ .textureFlushes = 1 });
 					NextBatch(RECTANGLE);
+				}
 
 				texIndex = data.rectangleTextureSlotIndex;
-				data.rectangleTextureSlots[data.rectangleTextureSlotIndex] = renderData.texture;
+				data.rectangleTextureSlots[data.rectangleTextureSlotIndex] = AssetManager::GetShared(renderData.texture);
 				data.rectangleTextureSlotIndex++;
 			}
 		}
@@ -493,14 +531,9 @@ namespace Paper {
 			data.rectangleVertexBufferPtr->entity_id = renderData.enity_id;
 			data.rectangleVertexBufferPtr->alphaCoreID = renderData.coreIDToAlphaPixels;
 			data.rectangleVertexBufferPtr++;
-
-			RenderCommand::GetStats().vertexCount++;
 		}
 
 		data.rectangleElementCount += 6;
-
-		RenderCommand::GetStats().elementCount += 6;
-		RenderCommand::GetStats().objectCount++;
 	}
 
 	void Renderer2D::DrawTriangle(const EdgeRenderData& renderData)
@@ -511,15 +544,16 @@ namespace Paper {
 
 		if (data.triangleElementCount >= data.MAX_ELEMENTS)
 		{
+			RenderCommand::CommitStats({ .capacityFlushes = 1 });
 			NextBatch(TRIANGLE);
 		}
 
 		int texIndex = -1;
-		if (renderData.texture != nullptr)
+		if (Texture* texture = AssetManager::Get(renderData.texture))
 		{
 			for (uint32_t i = 0; i < data.triangleTextureSlotIndex; i++)
 			{
-				if (*data.triangleTextureSlots[i] == *renderData.texture)
+				if (data.triangleTextureSlots[i].get() == texture)
 				{
 					texIndex = i;
 					break;
@@ -529,10 +563,13 @@ namespace Paper {
 			if (texIndex == -1)
 			{
 				if (data.triangleTextureSlotIndex >= data.MAX_TEXTURE_SLOTS)
+				{
+					RenderCommand::CommitStats({ .textureFlushes = 1 });
 					NextBatch(TRIANGLE);
+				}
 
 				texIndex = data.triangleTextureSlotIndex;
-				data.triangleTextureSlots[data.triangleTextureSlotIndex] = renderData.texture;
+				data.triangleTextureSlots[data.triangleTextureSlotIndex] = AssetManager::GetShared(renderData.texture);
 				data.triangleTextureSlotIndex++;
 			}
 		}
@@ -550,14 +587,9 @@ namespace Paper {
 			data.triangleVertexBufferPtr->entity_id = renderData.enity_id;
 			data.triangleVertexBufferPtr->alphaCoreID = renderData.coreIDToAlphaPixels;
 			data.triangleVertexBufferPtr++;
-
-			RenderCommand::GetStats().vertexCount++;
 		}
 
 		data.triangleElementCount += 3;
-
-		RenderCommand::GetStats().elementCount += 3;
-		RenderCommand::GetStats().objectCount++;
 	}
 
 
@@ -573,20 +605,13 @@ namespace Paper {
 		data.lineVertexBufferPtr->entity_id = renderData.enity_id;
 		data.lineVertexBufferPtr++;
 
-		RenderCommand::GetStats().vertexCount++;
-		
 		data.lineVertexBufferPtr->position = transform * pos1;
 		data.lineVertexBufferPtr->color = renderData.color;
 		data.lineVertexBufferPtr->entity_id = renderData.enity_id;
 		data.lineVertexBufferPtr++;
 
-		RenderCommand::GetStats().vertexCount++;
-
 		data.lineElementCount += 2;
 
-		RenderCommand::GetStats().elementCount += 1;
-		RenderCommand::GetStats().objectCount++;
-
 		data.lineWidth = renderData.thickness;
 		NextBatch(LINE);
 	}
@@ -598,20 +623,13 @@ namespace Paper {
 		data.lineVertexBufferPtr->entity_id = renderData.enity_id;
 		data.lineVertexBufferPtr++;
 
-		RenderCommand::GetStats().vertexCount++;
-
 		data.lineVertexBufferPtr->position = renderData.point1;
 		data.lineVertexBufferPtr->color = renderData.color;
 		data.lineVertexBufferPtr->entity_id = renderData.enity_id;
 		data.lineVertexBufferPtr++;
 
-		RenderCommand::GetStats().vertexCount++;
-
 		data.lineElementCount += 2;
 
-		RenderCommand::GetStats().elementCount += 1;
-		RenderCommand::GetStats().objectCount++;
-
 		data.lineWidth = renderData.thickness;
 		NextBatch(LINE);
 	}
@@ -652,15 +670,16 @@ namespace Paper {
 
 		if (data.circleElementCount >= data.MAX_ELEMENTS)
 		{
+			RenderCommand::CommitStats({ .capacityFlushes = 1 });
 			NextBatch(CIRCLE);
 		}
 
 		int texIndex = -1;
-		if (renderData.texture != nullptr)
+		if (Texture* texture = AssetManager::Get(renderData.texture))
 		{
 			for (uint32_t i = 0; i < data.circleTextureSlotIndex; i++)
 			{
-				if (*data.circleTextureSlots[i] == *renderData.texture)
+				if (data.circleTextureSlots[i].get() == texture)
 				{
 					texIndex = i;
 					break;
@@ -670,10 +689,13 @@ namespace Paper {
 			if (texIndex == -1)
 			{
 				if (data.circleTextureSlotIndex >= data.MAX_TEXTURE_SLOTS)
+				{
+					RenderCommand::CommitStats({ .textureFlushes = 1 });
 					NextBatch(CIRCLE);
+				}
 
 				texIndex = data.circleTextureSlotIndex;
-				data.circleTextureSlots[data.circleTextureSlotIndex] = renderData.texture;
+				data.circleTextureSlots[data.circleTextureSlotIndex] = AssetManager::GetShared(renderData.texture);
 				data.circleTextureSlotIndex++;
 			}
 		}
@@ -691,13 +713,9 @@ namespace Paper {
 			data.circleVertexBufferPtr->entity_id = renderData.enity_id;
 			data.circleVertexBufferPtr->alphaCoreID = renderData.coreIDToAlphaPixels;
 			data.circleVertexBufferPtr++;
-			RenderCommand::GetStats().vertexCount++;
 		}
 
 		data.circleElementCount += 6;
-
-		RenderCommand::GetStats().elementCount += 6;
-		RenderCommand::GetStats().objectCount++;
 	}
 
 
@@ -705,11 +723,14 @@ namespace Paper {
 	{
 		if (data.textElementCount >= data.MAX_ELEMENTS)
 		{
+			RenderCommand::CommitStats({ .capacityFlushes = 1 });
 			NextBatch(TEXT);
 		}
 
-		std::string string = renderData.text;
-		auto& font = renderData.font;
+		const std::string_view string = renderData.text;
+		Font* font = AssetManager::Get(renderData.font);
+		if (!font)
+			font = AssetManager::Get(AssetManager::GetDefaultFont());
 
 		size_t dataSize = renderData.text.length() * 4;
 		size_t index = 0;
@@ -719,16 +740,17 @@ namespace Paper {
 		float highestVertex = 0.0f;
 		float lowestVertex = 0.0f;
 
-		std::vector<glm::vec4> vertexData;
+		FrameVector<glm::vec4> vertexData;
 		vertexData.resize(dataSize);
-		std::vector<glm::vec2> texCoordData;
+		FrameVector<glm::vec2> texCoordData;
 		texCoordData.resize(dataSize);
 
 		const auto& fontGeometry = font->GetMSDFData()->FontGeometry;
 		const auto& metrics = fontGeometry.getMetrics();
-		Shr<Texture> fontAtlas = font->GetAtlasTexture();
+		const Shr<Texture>& fontAtlas = font->GetAtlasTexture();
 
-		data.fontAtlasTexture = fontAtlas;
+		if (data.fontAtlasTexture != fontAtlas)
+			data.fontAtlasTexture = fontAtlas;
 
 		double x = 0.0;
 		double fsScale = 1.0;// / (metrics.ascenderY - metrics.descenderY);
@@ -820,14 +842,8 @@ namespace Paper {
 			data.textVertexBufferPtr->entity_id = renderData.enity_id;
 			data.textVertexBufferPtr->alphaCoreID = renderData.coreIDToAlphaPixels;
 			data.textVertexBufferPtr++;
-			RenderCommand::GetStats().vertexCount++;
-
-			
 		}
 
 		data.textElementCount += dataSize / 4 * 6;
-
-		RenderCommand::GetStats().elementCount += dataSize / 4 * 6;
-		RenderCommand::GetStats().objectCount += dataSize / 4;
 	}
 }
@@ -2,7 +2,7 @@
 #include "utility.h"
 
 #include "renderer/Texture.h"
-#include "utils/DataPool.h"
+#include "assets/AssetManager.h"
 #include "camera/EditorCamera.h"
 #include "camera/EntityCamera.h"
 
@@ -17,7 +17,7 @@ namespace Paper {
         glm::mat4 transform = glm::mat4(1.0f);
         glm::vec4 color = DEFAULT_COLOR;
 
-        Shr<Texture> texture = nullptr;
+        AssetHandle<Texture> texture;
         std::array<glm::vec2, 4> texCoords = { { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } } };
         float tilingFactor = 1.0f;
 
@@ -34,7 +34,7 @@ namespace Paper {
         float thickness = 1.0f;
         float fade = 0.005f;
 
-        Shr<Texture> texture = nullptr;
+        AssetHandle<Texture> texture;
         std::array<glm::vec2, 4> texCoords = { { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } } };
         float tilingFactor = 1.0f;
 
@@ -62,14 +62,20 @@ namespace Paper {
         glm::mat4 transform = glm::mat4(1.0f);
         glm::vec4 color = DEFAULT_COLOR;
 
-        std::string text = "";
-        Shr<Font> font = DataPool::GetDefaultFont();
+        std::string_view text; //must stay alive until DrawString returns
+        AssetHandle<Font> font; //empty uses the default font
 
         entity_id enity_id = 0;
         entity_id uiID = 0;
         bool coreIDToAlphaPixels = false;
     };
 
+    //packets are built per entity per frame, they must stay plain data (no refcounts, no owned strings)
+    static_assert(std::is_trivially_copyable_v<EdgeRenderData>);
+    static_assert(std::is_trivially_copyable_v<CircleRenderData>);
+    static_assert(std::is_trivially_copyable_v<LineRenderData>);
+    static_assert(std::is_trivially_copyable_v<TextRenderData>);
+
     enum RenderTarget2D
     {
         ALL, RECTANGLE, TRIANGLE, CIRCLE, LINE, TEXT
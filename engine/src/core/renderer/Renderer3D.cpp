@@ -2,7 +2,8 @@
 
 #include "renderer/Renderer3D.h"
 #include "renderer/RenderCommand.h"
-#include "utils/DataPool.h"
+#include "renderer/RenderThread.h"
+#include "assets/AssetManager.h"
 #include "renderer/Shader.h"
 #include "generic/Application.h"
 #include "imgui/ImGuiLayer.h"
@@ -69,7 +70,7 @@ namespace Paper {
         	{ GLSLDataType::INT , "aCoreID" },
         };
 
-        data.edgeGeometryShader = DataPool::GetShader("EdgeGeometryShader_3D");
+        data.edgeGeometryShader = AssetManager::GetShared(AssetManager::LoadShader("EdgeGeometryShader_3D"));
         data.edgeGeometryShader->Compile();
 
         data.cubeVertexArray = VertexArray::CreateArray();
@@ -172,7 +173,7 @@ namespace Paper {
         data.cubeNormalData[22] = glm::vec3( 1.0f, 0.0f, 0.0f);
         data.cubeNormalData[23] = glm::vec3( 1.0f, 0.0f, 0.0f);
 
-        data.cubeVertexBufferBase = new EdgeVertex[data.MAX_VERTICES];
+        data.cubeVertexBufferBase = MemoryTracker::NewArray<EdgeVertex>(data.MAX_VERTICES, MemoryTag::Renderer);
 
         for (uint32_t i = 0; i < data.MAX_TEXTURE_SLOTS - 1; i++)
         {
@@ -187,7 +188,7 @@ namespace Paper {
 
     void Renderer3D::Shutdown()
     {
-        delete[] data.cubeVertexBufferBase;
+        MemoryTracker::DeleteArray(data.cubeVertexBufferBase, data.MAX_VERTICES, MemoryTag::Renderer);
     }
 
     void Renderer3D::ResizeWindow(uint32_t width, uint32_t height)
@@ -223,32 +224,40 @@ namespace Paper {
 
     void Renderer3D::Render()
     {
-        const SharedRenderData& sharedData = RenderCommand::sharedData;
-        sharedData.cameraUniformBuffer->Bind();
+        PAPER_PROFILE_FUNCTION();
+
 	    if (data.cubeElementCount)
 	    {
             const uint32_t dataSize = (uint32_t)((uint8_t*)data.cubeVertexBufferPtr - (uint8_t*)data.cubeVertexBufferBase);
-            data.cubeVertexBuffer->AddData(data.cubeVertexBufferBase, dataSize);
-            RenderCommand::GetStats().dataSize += dataSize;
+            RenderCommand::CommitStats({ .drawCalls = 1, .dataSize = dataSize, .objectCount = data.cubeElementCount / 36,
+                .vertexCount = dataSize / (uint32_t)sizeof(EdgeVertex), .elementCount = data.cubeElementCount });
+            ScopedGPUPass gpuPass("3D Cubes");
 
-            //bind textures
-            for (uint32_t i = 0; i < data.cubeTextureSlotIndex; i++)
-                data.cubeTextureSlots[i]->Bind(i);
+            //the batch is restarted right away, the command keeps its own copy of the vertices
+            RenderThread::Submit([vertices = RenderThread::CopyToFrame(data.cubeVertexBufferBase, dataSize), dataSize,
+                elementCount = data.cubeElementCount, textures = data.cubeTextureSlots, textureCount = data.cubeTextureSlotIndex]()
+            {
+                RenderCommand::sharedData.cameraUniformBuffer->Bind();
+                data.cubeVertexBuffer->AddData(vertices, dataSize);
 
-            data.storageBuffer->Bind();
+                //bind textures
+                for (uint32_t i = 0; i < textureCount; i++)
+                    textures[i]->Bind(i);
 
-            data.edgeGeometryShader->Bind();
-            data.edgeGeometryShader->UploadIntArray("uTexture", data.MAX_TEXTURE_SLOTS - 1, texSlots);
-            data.edgeGeometryShader->UploadVec4f("uLightColor", glm::vec4(1.0f));
-            RenderCommand::DrawElements(data.cubeVertexArray, data.cubeElementCount);
+                data.storageBuffer->Bind();
 
-            data.storageBuffer->Unbind();
-            data.edgeGeometryShader->Unbind();
-            RenderCommand::GetStats().drawCalls++;
+                data.edgeGeometryShader->Bind();
+                data.edgeGeometryShader->UploadIntArray("uTexture", data.MAX_TEXTURE_SLOTS - 1, texSlots);
+                data.edgeGeometryShader->UploadVec4f("uLightColor", glm::vec4(1.0f));
+                RenderCommand::DrawElements(data.cubeVertexArray, elementCount);
 
-            //unbind textures
-            for (uint32_t i = 0; i < data.cubeTextureSlotIndex; i++)
-                data.cubeTextureSlots[i]->Unbind();
+                data.storageBuffer->Unbind();
+                data.edgeGeometryShader->Unbind();
+
+                //unbind textures
+                for (uint32_t i = 0; i < textureCount; i++)
+                    textures[i]->Unbind();
+            });
 	    }
     }
 
@@ -260,15 +269,16 @@ namespace Paper {
 
         if (data.cubeElementCount >= data.MAX_ELEMENTS)
         {
+            RenderCommand::CommitStats({ .capacityFlushes = 1 });
             NextBatch();
         }
 
         int texIndex = -1;
-        if (renderData.texture != nullptr)
+        if (Texture* texture = AssetManager::Get(renderData.texture))
         {
             for (uint32_t i = 0; i < data.cubeTextureSlotIndex; i++)
             {
-                if (*data.cubeTextureSlots[i] == *renderData.texture)
+                if (data.cubeTextureSlots[i].get() == texture)
                 {
                     texIndex = i;
                     break;
@@ -278,10 +288,13 @@ namespace Paper {
             if (texIndex == -1)
             {
                 if (data.cubeTextureSlotIndex >= data.MAX_TEXTURE_SLOTS)
+                {
+                    RenderCommand::CommitStats({ .textureFlushes = 1 });
                     NextBatch();
+                }
 
                 texIndex = data.cubeTextureSlotIndex;
-                data.cubeTextureSlots[data.cubeTextureSlotIndex] = renderData.texture;
+                data.cubeTextureSlots[data.cubeTextureSlotIndex] = AssetManager::GetShared(renderData.texture);
                 data.cubeTextureSlotIndex++;
             }
         }
@@ -297,13 +310,8 @@ namespace Paper {
             data.cubeVertexBufferPtr->texIndex = texIndex;
             data.cubeVertexBufferPtr->coreID = renderData.entity_id;
             data.cubeVertexBufferPtr++;
-
-            RenderCommand::GetStats().vertexCount++;
         }
 
         data.cubeElementCount += 36;
-
-        RenderCommand::GetStats().elementCount += 36;
-        RenderCommand::GetStats().objectCount++;
     }
 }
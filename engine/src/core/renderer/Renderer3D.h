@@ -4,6 +4,7 @@
 #include "renderer/Texture.h"
 
 #include "renderer/Font.h"
+#include "assets/AssetManager.h"
 
 #define DEFAULT_COLOR glm::vec4(0.925f, 0.329f, 0.956, 1.0f)
 
@@ -15,13 +16,15 @@ namespace Paper {
         glm::vec4 color = DEFAULT_COLOR;
         int isLightSource = false;
 
-        Shr<Texture> texture = nullptr;
+        AssetHandle<Texture> texture;
         glm::vec2 texCoords[4] = { { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f } };
         float tilingFactor = 1.0f;
 
         entity_id entity_id = 0;
     };
 
+    static_assert(std::is_trivially_copyable_v<EdgeRenderData3D>);
+
 
 
     class Renderer3D {
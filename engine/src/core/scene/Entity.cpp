@@ -7,46 +7,30 @@
 
 
 namespace Paper {
-	Entity::Entity(entt::entity entity, Scene* scene)
-		: scene(scene), entity(entity)
-	{
-		//debug
-		name = GetComponent<DataComponent>().name;
-		uuid = GetComponent<DataComponent>().uuid;
-	}
-
-	Entity::Entity(entt::entity entity, std::string name, Scene* scene)
+	Entity::Entity(entt::entity entity, const std::string& name, Scene* scene)
 		: scene(scene), entity(entity)
 	{
 		AddComponent<DataComponent>(name);
 		AddComponent<TransformComponent>();
-
-		//debug
-		name = GetComponent<DataComponent>().name;
-		uuid = GetComponent<DataComponent>().uuid;
 	}
 
-	Entity::Entity(entt::entity entity, const PaperID& id, std::string name, Scene* scene)
+	Entity::Entity(entt::entity entity, const PaperID& id, const std::string& name, Scene* scene)
 		: scene(scene), entity(entity)
 	{
 		AddComponent<DataComponent>(id, name);
 		AddComponent<TransformComponent>();
-
-		//debug
-		name = GetComponent<DataComponent>().name;
-		uuid = GetComponent<DataComponent>().uuid;
 	}
 
 	Entity* Entity::AddTag(std::string tag)
 	{
-		auto& tagList = GetComponent<DataComponent>().tags;
 		std::ranges::transform(tag.begin(), tag.end(), tag.begin(), ::toupper);
-		if (std::ranges::find(tagList.begin(), tagList.end(), tag) != tagList.end())
+		if (HasTag(tag))
 		{
 			LOG_CORE_WARN("Adding a tag to a Entity which it already has: '" + tag + "'");
 			return this;
 		}
-		tagList.emplace_back(tag);
+		GetComponent<DataComponent>().tags.emplace_back(tag);
+		scene->IndexTag(entity, tag);
 		return this;
 	}
 
@@ -59,26 +43,39 @@ namespace Paper {
 		return this;
 	}
 
-	bool Entity::RemoveTag(std::string tag)
+	bool Entity::RemoveTag(const std::string& tag)
 	{
 		auto& tagList = GetComponent<DataComponent>().tags;
-		std::ranges::transform(tag.begin(), tag.end(), tag.begin(), ::toupper);
-		const auto it = std::ranges::find(tagList.begin(), tagList.end(), tag);
+		const auto it = std::ranges::find_if(tagList, [&tag](const std::string& t) { return Scene::TagsEqual(t, tag); });
 		if (it == tagList.end())
 		{
 			LOG_CORE_WARN("Removing a tag from a Entity which it doesn't have: '" + tag + "'");
 			return false;
 		}
 		tagList.erase(it);
+
+		scene->UnindexTag(entity, tag);
 		return true;
 	}
 
-	bool Entity::HasTag(std::string tag)
+	bool Entity::HasTag(std::string_view tag) const
+	{
+		return scene->EntityHasTag(*this, tag);
+	}
+
+	const std::vector<std::string>& Entity::GetTags()
+	{
+		return GetComponent<DataComponent>().tags;
+	}
+
+	void Entity::SetTags(const std::vector<std::string>& tags)
 	{
 		auto& tagList = GetComponent<DataComponent>().tags;
-		std::ranges::transform(tag.begin(), tag.end(), tag.begin(), ::toupper);
-		const auto it = std::ranges::find(tagList.begin(), tagList.end(), tag);
-		return it != tagList.end();
+		scene->UnindexTags(entity, tagList);
+
+		tagList = tags;
+		for (const std::string& tag : tagList)
+			scene->IndexTag(entity, tag);
 	}
 
 	PaperID Entity::GetPaperID()
@@ -95,6 +92,11 @@ namespace Paper {
 
 	void Entity::SetName(const std::string& name)
 	{
-		GetComponent<DataComponent>().name = name;
+		auto& dc = GetComponent<DataComponent>();
+		if (dc.name == name) return;
+
+		scene->UnindexName(entity, dc.name);
+		dc.name = name;
+		scene->IndexName(entity, dc.name);
 	}
 }
\ No newline at end of file
@@ -12,9 +12,10 @@ namespace Paper {
     class Entity {
     public:
         Entity() = default;
-        Entity(entt::entity entity, Scene* scene);
-        Entity(entt::entity entity, std::string name, Scene* scene);
-        Entity(entt::entity entity, const PaperID& id, std::string name, Scene* scene);
+        Entity(entt::entity entity, Scene* scene)
+            : scene(scene), entity(entity) { }
+        Entity(entt::entity entity, const std::string& name, Scene* scene);
+        Entity(entt::entity entity, const PaperID& id, const std::string& name, Scene* scene);
 
         ~Entity() = default;
 
@@ -42,8 +43,10 @@ namespace Paper {
 
         Entity* AddTag(std::string tag);
         Entity* AddTag(std::initializer_list<std::string> tags);
-        bool RemoveTag(std::string tag);
-        bool HasTag(std::string tag);
+        bool RemoveTag(const std::string& tag);
+        bool HasTag(std::string_view tag) const;
+        const std::vector<std::string>& GetTags();
+        void SetTags(const std::vector<std::string>& tags);
 
     	PaperID GetPaperID();
         Scene* GetScene() const { return scene; }
@@ -56,12 +59,11 @@ namespace Paper {
         Scene* scene = nullptr;
 
         entt::entity entity = entt::null;
-
-        //debug
-        std::string name;
-        PaperID uuid;
     };
 
+    //handle is copied by value into every internal call and per entity loop, name and id are read from the DataComponent on demand
+    static_assert(std::is_trivially_copyable_v<Entity>, "Entity must stay a plain (entity, scene) handle");
+
     template <typename T>
     T& Entity::GetComponent()
     {
@@ -11,8 +11,18 @@
 
 #include "Components.h"
 
+#include "generic/Hash.h"
+
 namespace Paper {
 
+	//transform before the latest tick, rendering interpolates from it to the current one
+	struct PreviousTransform
+	{
+		glm::vec3 position;
+		glm::vec3 scale;
+		glm::quat rotation;
+	};
+
 	Scene::Scene()
 		: uuid(PaperID()), name("[Scene]"), is_dirty(true) { }
 
@@ -31,25 +41,37 @@ namespace Paper {
 	}
 
 	template <typename... Component>
-	static void CopyComponent(entt::registry& dst, entt::registry& src, const std::unordered_map<PaperID, entt::entity>& dstEntityMap)
+	static void CopyStorage(entt::registry& dst, const entt::registry& src)
 	{
 		([&]()
 		{
-			auto view = src.view<Component>();
-			for (auto [e, component] : view.each())
+			const auto* srcPool = src.storage<Component>();
+			if (!srcPool || srcPool->empty()) return;
+
+			const entt::sparse_set& srcEntities = *srcPool;
+			auto& dstPool = dst.storage<Component>();
+			dstPool.reserve(srcPool->size());
+
+			if constexpr (std::is_trivially_copyable_v<Component>)
 			{
-				PaperID srcUUID = src.get<DataComponent>(e).uuid;
-				entt::entity dstEntity = dstEntityMap.at(srcUUID);
+				//entities are inserted in packed order, so the pages line up and can be copied as raw memory
+				dstPool.insert(srcEntities.data(), srcEntities.data() + srcEntities.size());
 
-				dst.emplace_or_replace<Component>(dstEntity, component);
+				constexpr size_t pageSize = entt::component_traits<Component>::page_size;
+				for (size_t offset = 0, page = 0; offset < srcPool->size(); offset += pageSize, ++page)
+					memcpy(dstPool.raw()[page], srcPool->raw()[page], std::min(pageSize, srcPool->size() - offset) * sizeof(Component));
+			}
+			else
+			{
+				dstPool.insert(srcEntities.begin(), srcEntities.end(), srcPool->begin());
 			}
 		}(), ...);
 	}
 
 	template<typename... Component>
-	static void CopyComponent(ComponentGroup<Component...>, entt::registry& dst, entt::registry& src, const std::unordered_map<PaperID, entt::entity>& dstEntityMap)
+	static void CopyStorage(ComponentGroup<Component...>, entt::registry& dst, const entt::registry& src)
 	{
-		CopyComponent<Component...>(dst, src, dstEntityMap);
+		CopyStorage<Component...>(dst, src);
 	}
 
 	template <typename... Component>
@@ -68,24 +90,44 @@ namespace Paper {
 		CopyComponentIfExists<Component...>(dst, src);
 	}
 
+	template<typename... Component>
+	static size_t StorageMemory(const entt::registry& registry)
+	{
+		size_t bytes = 0;
+		([&]()
+		{
+			//packed entities and payload plus the sparse pages
+			if (const auto* storage = registry.storage<Component>())
+				bytes += storage->capacity() * (sizeof(Component) + sizeof(entt::entity)) + storage->extent() * sizeof(entt::entity);
+		}(), ...);
+		return bytes;
+	}
+
+	template<typename... Component>
+	static size_t StorageMemory(ComponentGroup<Component...>, const entt::registry& registry)
+	{
+		return StorageMemory<Component...>(registry);
+	}
+
 	Shr<Scene> Scene::Copy()
 	{
 		Shr<Scene> newScene = MakeShr<Scene>();
 
 		auto& dstSceneRegistry = newScene->registry;
 
-		auto dataView = registry.view<DataComponent>();
-		for (auto e : dataView)
-		{
-			PaperID uuid = registry.get<DataComponent>(e).uuid;
-			std::string name = registry.get<DataComponent>(e).name;
-			auto tags = registry.get<DataComponent>(e).tags;
+		//copy the entity pool as is, so every entt::entity keeps its value (and version) in the copy
+		const auto& srcEntities = registry.storage<entt::entity>();
+		auto& dstEntities = dstSceneRegistry.storage<entt::entity>();
+		dstEntities.push(srcEntities.data(), srcEntities.data() + srcEntities.size());
+		dstEntities.in_use(srcEntities.in_use());
 
-			Entity entity = newScene->CreateEntity(uuid, name);
-			entity.GetComponent<DataComponent>().tags = tags;
-		}
+		CopyStorage<DataComponent>(dstSceneRegistry, registry);
+		CopyStorage(AllComponents{}, dstSceneRegistry, registry);
 
-		CopyComponent(AllComponents{},dstSceneRegistry, registry, newScene->entity_map);
+		//entity handles are identical, so the id lookup can be taken over in one go
+		newScene->entity_map = entity_map;
+		newScene->name_index = name_index;
+		newScene->tag_index = tag_index;
 
 		newScene->name = name;
 		newScene->path = path;
@@ -106,6 +148,13 @@ namespace Paper {
 
 	void Scene::OnRuntimeStart()
 	{
+		spatialIndex.Sync(registry);
+		physicsWorld.Reset();
+
+		//scripts hold pointers into these pools, removals move other components around
+		registry.on_destroy<TransformComponent>().connect<&ScriptEngine::InvalidateComponentViews>();
+		registry.on_destroy<SpriteComponent>().connect<&ScriptEngine::InvalidateComponentViews>();
+
 		//Scripting
 		{
 			ScriptEngine::OnRuntimeStart(this);
@@ -127,10 +176,18 @@ namespace Paper {
 			}
 		}
 		ScriptEngine::OnRuntimeStop();
+
+		registry.on_destroy<TransformComponent>().disconnect<&ScriptEngine::InvalidateComponentViews>();
+		registry.on_destroy<SpriteComponent>().disconnect<&ScriptEngine::InvalidateComponentViews>();
+
+		registry.clear<PreviousTransform>();
+		renderAlpha = 1.0f;
 	}
 
 	void Scene::OnRuntimeUpdate()
 	{
+		PAPER_PROFILE_FUNCTION();
+
 		//Update rotation in transform component
 		{
 			auto view = registry.view<TransformComponent>();
@@ -139,22 +196,21 @@ namespace Paper {
 			}
 		}
 
-		if (!isPaused || framesToStep-- > 0)
+		const uint32_t ticks = ConsumeTicks();
+		const float dt = Application::GetFixedDT();
+		for (uint32_t tick = 0; tick < ticks; tick++)
 		{
+			if (tick == ticks - 1)
+				SnapshotTransforms();
 
-			//Scripting
-			float dt = Application::GetDT();
-			{
-				auto view = registry.view<ScriptComponent>();
-				for (auto [e, script] : view.each()) {
-					Entity entity(e, this);
-					ScriptEngine::OnUpdateEntity(entity, dt);
-				}
-			}
+			spatialIndex.Sync(registry);
 
-			//TODO: update physics
+			//Scripting
+			ScriptEngine::OnUpdateEntities(dt);
 
+			physicsWorld.Step(registry, dt);
 		}
+
 		//get primary camera
 		EntityCamera* entityCamera = nullptr;
 		glm::mat4 cameraTransform;
@@ -165,7 +221,7 @@ namespace Paper {
 				if (camera.primary)
 				{
 					entityCamera = &camera.camera;
-					cameraTransform = transform.GetTransform();
+					cameraTransform = GetRenderTransform(entity, transform);
 					break;
 				}
 			}
@@ -182,15 +238,19 @@ namespace Paper {
 
 	void Scene::OnSimulationStart()
 	{
-		
+		physicsWorld.Reset();
 	}
 
 	void Scene::OnSimulationStop()
 	{
+		registry.clear<PreviousTransform>();
+		renderAlpha = 1.0f;
 	}
 
 	void Scene::OnSimulationUpdate(const Shr<EditorCamera>& camera)
 	{
+		PAPER_PROFILE_FUNCTION();
+
 		//Update rotation in transform component
 		{
 			auto view = registry.view<TransformComponent>();
@@ -199,10 +259,13 @@ namespace Paper {
 			}
 		}
 
-		if (!isPaused || framesToStep-- > 0)
+		const uint32_t ticks = ConsumeTicks();
+		for (uint32_t tick = 0; tick < ticks; tick++)
 		{
-			//TODO: update physics
+			if (tick == ticks - 1)
+				SnapshotTransforms();
 
+			physicsWorld.Step(registry, Application::GetFixedDT());
 		}
 
 		//render
@@ -211,6 +274,50 @@ namespace Paper {
 		Renderer2D::EndRender();
 	}
 
+	uint32_t Scene::ConsumeTicks()
+	{
+		//several viewports can show the same scene, only the first update of a frame advances it
+		const uint64_t frame = Application::GetFrameCount();
+		if (frame == lastTickedFrame)
+			return 0;
+		lastTickedFrame = frame;
+
+		const FixedTimestep& timestep = Application::GetFixedTimestep();
+		if (isPaused)
+		{
+			renderAlpha = 1.0f;
+			if (framesToStep <= 0)
+				return 0;
+			framesToStep--;
+			return 1;
+		}
+
+		renderAlpha = timestep.GetAlpha();
+		return timestep.GetTicksThisFrame();
+	}
+
+	void Scene::SnapshotTransforms()
+	{
+		auto view = registry.view<TransformComponent>();
+		for (auto [entity, transform] : view.each())
+			registry.emplace_or_replace<PreviousTransform>(entity, transform.position, transform.scale, glm::quat(glm::radians(transform.rotation)));
+	}
+
+	glm::mat4 Scene::GetRenderTransform(entt::entity entity, const TransformComponent& transform) const
+	{
+		const PreviousTransform* previous = renderAlpha < 1.0f ? registry.try_get<PreviousTransform>(entity) : nullptr;
+		if (!previous)
+			return transform.GetTransform();
+
+		const glm::vec3 position = glm::mix(previous->position, transform.position, renderAlpha);
+		const glm::vec3 scale = glm::mix(previous->scale, transform.scale, renderAlpha);
+		const glm::quat rotation = glm::slerp(previous->rotation, glm::quat(glm::radians(transform.rotation)), renderAlpha);
+
+		return glm::translate(glm::mat4(1.0f), position)
+			* glm::toMat4(rotation)
+			* glm::scale(glm::mat4(1.0f), scale);
+	}
+
 	void Scene::OnEditorUpdate(const Shr<EditorCamera>& camera)
 	{
 		//render
@@ -219,16 +326,20 @@ namespace Paper {
 
 	void Scene::EditorRender(const Shr<EditorCamera>& camera)
 	{
+		PAPER_PROFILE_FUNCTION();
+
 		Renderer2D::BeginRender(camera);
 		Render();
 
 		//camera icons
 		{
+			static const AssetHandle<Texture> cameraSymbol = AssetManager::LoadTexture("resources/editor/world/camera_symbol.png");
+
 			auto view = registry.view<TransformComponent, CameraComponent>();
 			for (auto [entity, transform, line] : view.each())
 			{
 				EdgeRenderData data;
-				data.texture = DataPool::GetTexture("resources/editor/world/camera_symbol.png", true);
+				data.texture = cameraSymbol;
 				data.color = glm::vec4(1.0f);
 				data.transform = transform.GetTransform() * glm::toMat4(glm::quat(glm::radians(glm::vec3(0.0f, -90.0f, 0.0f))));
 				data.enity_id = (entity_id)entity;
@@ -240,8 +351,18 @@ namespace Paper {
 		Renderer2D::EndRender();
 	}
 
+	size_t Scene::GetMemoryUsage() const
+	{
+		const size_t entities = registry.storage<entt::entity>()->capacity() * sizeof(entt::entity);
+		return entities + StorageMemory<DataComponent>(registry) + StorageMemory(AllComponents{}, registry);
+	}
+
 	void Scene::Render()
 	{
+		PAPER_PROFILE_FUNCTION();
+
+		MemoryTracker::Sample(MemoryTag::Scene, GetMemoryUsage());
+
 		//Sprites
 		{
 			auto view = registry.view<TransformComponent, SpriteComponent>();
@@ -249,7 +370,7 @@ namespace Paper {
 				if (sprite.geometry == Geometry::CIRCLE)
 				{
 					CircleRenderData data;
-					data.transform = transform.GetTransform();
+					data.transform = GetRenderTransform(entity, transform);
 					data.color = sprite.color;
 					data.texture = sprite.texture;
 					data.tilingFactor = sprite.tiling_factor;
@@ -265,7 +386,7 @@ namespace Paper {
 				else
 				{
 					EdgeRenderData data;
-					data.transform = transform.GetTransform();
+					data.transform = GetRenderTransform(entity, transform);
 					data.color = sprite.color;
 					data.texture = sprite.texture;
 					data.tilingFactor = sprite.tiling_factor;
@@ -287,7 +408,7 @@ namespace Paper {
 			for (auto [entity, transform, line] : view.each()) 
 			{
 				LineRenderData data;
-				data.transform = transform.GetTransform();
+				data.transform = GetRenderTransform(entity, transform);
 				data.color = line.color;
 				data.thickness = line.thickness;
 				data.enity_id = (entity_id)entity;
@@ -302,7 +423,7 @@ namespace Paper {
 			for (auto [entity, transform, text] : view.each()) {
 
 				TextRenderData data;
-				data.transform = transform.GetTransform();
+				data.transform = GetRenderTransform(entity, transform);
 				data.color = text.color;
 				data.text = text.text;
 				data.font = text.font;
@@ -325,6 +446,7 @@ namespace Paper {
 		is_dirty = true;
 		Entity entity(registry.create(), id, name, this);
 		entity_map[id] = entity;
+		IndexName(entity, name);
 
 		return entity;
 	}
@@ -345,6 +467,11 @@ namespace Paper {
 
 		is_dirty = true;
 
+		const auto& dc = entity.GetComponent<DataComponent>();
+		UnindexName(entity, dc.name);
+		UnindexTags(entity, dc.tags);
+
+		spatialIndex.Remove(entity);
 		entity_map.erase(entity.GetPaperID());
 		registry.destroy(entity);
 		return true;
@@ -353,20 +480,158 @@ namespace Paper {
 	Entity Scene::GetEntity(const PaperID& id)
 	{
 		//CORE_ASSERT(entity_map.contains(id), "Entity does not exists");
-		if (!entity_map.contains(id))
+		const auto it = entity_map.find(id);
+		if (it == entity_map.end())
 			return {};
 
-		return {entity_map.at(id), this};
+		return {it->second, this};
 	}
 
-	Entity Scene::GetEntityByName(const std::string& name)
+	Entity Scene::GetEntityByName(std::string_view name)
 	{
-		for (const auto& entt : entity_map | std::views::values)
+		auto [begin, end] = name_index.equal_range(Hash::GenerateFNVHash(name));
+		for (auto it = begin; it != end; ++it)
 		{
-			Entity entity{ entt, this };
-			if (entity.GetName() == name)
-				return entity;
+			//different names can share a hash
+			if (registry.get<DataComponent>(it->second).name == name)
+				return { it->second, this };
 		}
 		return Entity();
 	}
+
+	std::vector<Entity> Scene::GetEntitiesByName(std::string_view name)
+	{
+		std::vector<Entity> entities;
+		auto [begin, end] = name_index.equal_range(Hash::GenerateFNVHash(name));
+		for (auto it = begin; it != end; ++it)
+		{
+			if (registry.get<DataComponent>(it->second).name == name)
+				entities.emplace_back(it->second, this);
+		}
+		return entities;
+	}
+
+	static bool ListHasTag(const std::vector<std::string>& tags, std::string_view tag)
+	{
+		return std::ranges::any_of(tags, [tag](const std::string& t) { return Scene::TagsEqual(t, tag); });
+	}
+
+	std::vector<Entity> Scene::GetEntitiesWithTag(std::string_view tag)
+	{
+		std::vector<Entity> entities;
+		const auto it = tag_index.find(GetTagID(tag));
+		if (it == tag_index.end())
+			return entities;
+
+		for (entt::entity e : it->second)
+		{
+			//different tags can share an id
+			if (ListHasTag(registry.get<DataComponent>(e).tags, tag))
+				entities.emplace_back(e, this);
+		}
+		return entities;
+	}
+
+	std::vector<Entity> Scene::GetEntitiesWithTag(uint32_t tagID)
+	{
+		std::vector<Entity> entities;
+		const auto it = tag_index.find(tagID);
+		if (it == tag_index.end())
+			return entities;
+
+		entities.reserve(it->second.size());
+		for (entt::entity e : it->second)
+			entities.emplace_back(e, this);
+		return entities;
+	}
+
+	bool Scene::EntityHasTag(Entity entity, std::string_view tag) const
+	{
+		return EntityHasTag(entity, GetTagID(tag)) && ListHasTag(registry.get<DataComponent>(entity).tags, tag);
+	}
+
+	bool Scene::EntityHasTag(Entity entity, uint32_t tagID) const
+	{
+		const auto it = tag_index.find(tagID);
+		return it != tag_index.end() && it->second.contains(entity);
+	}
+
+	uint32_t Scene::GetTagID(std::string_view tag)
+	{
+		//same as Hash::GenerateFNVHash but on the upper case string, without building it
+		constexpr uint32_t FNV_PRIME = 16777619u;
+		constexpr uint32_t OFFSET_BASIS = 2166136261u;
+
+		uint32_t hash = OFFSET_BASIS;
+		for (const char c : tag)
+		{
+			hash ^= (char)::toupper((unsigned char)c);
+			hash *= FNV_PRIME;
+		}
+		hash ^= '\0';
+		hash *= FNV_PRIME;
+
+		return hash;
+	}
+
+	bool Scene::TagsEqual(std::string_view a, std::string_view b)
+	{
+		return std::ranges::equal(a, b, [](char x, char y) { return ::toupper((unsigned char)x) == ::toupper((unsigned char)y); });
+	}
+
+	void Scene::IndexName(entt::entity entity, const std::string& name)
+	{
+		name_index.emplace(Hash::GenerateFNVHash(name), entity);
+	}
+
+	void Scene::UnindexName(entt::entity entity, const std::string& name)
+	{
+		auto [begin, end] = name_index.equal_range(Hash::GenerateFNVHash(name));
+		for (auto it = begin; it != end; ++it)
+		{
+			if (it->second == entity)
+			{
+				name_index.erase(it);
+				return;
+			}
+		}
+	}
+
+	void Scene::IndexTag(entt::entity entity, const std::string& tag)
+	{
+		if (tag.empty()) return;
+		tag_index[GetTagID(tag)].insert(entity);
+	}
+
+	void Scene::UnindexTag(entt::entity entity, const std::string& tag)
+	{
+		if (tag.empty()) return;
+
+		//the same tag twice (editor input) or a different one with the same id
+		const uint32_t tagID = GetTagID(tag);
+		const auto& tags = registry.get<DataComponent>(entity).tags;
+		if (std::ranges::any_of(tags, [tagID](const std::string& t) { return !t.empty() && GetTagID(t) == tagID; }))
+			return;
+
+		RemoveFromTagIndex(entity, tagID);
+	}
+
+	void Scene::UnindexTags(entt::entity entity, const std::vector<std::string>& tags)
+	{
+		for (const std::string& tag : tags)
+		{
+			if (!tag.empty())
+				RemoveFromTagIndex(entity, GetTagID(tag));
+		}
+	}
+
+	void Scene::RemoveFromTagIndex(entt::entity entity, uint32_t tagID)
+	{
+		const auto it = tag_index.find(tagID);
+		if (it == tag_index.end()) return;
+
+		it->second.erase(entity);
+		if (it->second.empty())
+			tag_index.erase(it);
+	}
 }
@@ -3,12 +3,17 @@
 #include "utility.h"
 
 #include "utils/PaperID.h"
+#include "utils/FlatHashMap.h"
+
+#include "SpatialIndex.h"
+#include "physics/PhysicsWorld2D.h"
 
 #include "camera/EditorCamera.h"
 
 namespace Paper {
 
     class Entity;
+    struct TransformComponent;
 
     class Scene {
     public:
@@ -44,7 +49,17 @@ namespace Paper {
     	bool DestroyEntity(Entity entity);
 
         Entity GetEntity(const PaperID& id);
-        Entity GetEntityByName(const std::string& name);
+        Entity GetEntityByName(std::string_view name);
+        std::vector<Entity> GetEntitiesByName(std::string_view name);
+        //the string overloads compare the tag names, the id overloads can't tell apart tags that share an id
+        std::vector<Entity> GetEntitiesWithTag(std::string_view tag);
+        std::vector<Entity> GetEntitiesWithTag(uint32_t tagID);
+        bool EntityHasTag(Entity entity, std::string_view tag) const;
+        bool EntityHasTag(Entity entity, uint32_t tagID) const;
+
+        //tags are case insensitive, so 'Enemy' and 'ENEMY' share one id
+        static uint32_t GetTagID(std::string_view tag);
+        static bool TagsEqual(std::string_view a, std::string_view b);
 
         PaperID GetPaperID() const { return uuid; }
         std::string GetName() const { return name; }
@@ -52,9 +67,16 @@ namespace Paper {
         std::filesystem::path GetPath() { return path; }
         void SetPath(const std::filesystem::path& path ) { this->path = path; }
 
+        //approximate bytes held by the component pools
+        size_t GetMemoryUsage() const;
+
         auto& Registry() { return registry; }
         auto& EntityMap() { return entity_map; }
 
+        //synced from transforms at the start of every runtime update
+        SpatialIndex& GetSpatialIndex() { return spatialIndex; }
+        PhysicsWorld2D& GetPhysicsWorld() { return physicsWorld; }
+
         bool IsDirty() const { return is_dirty; }
         void SetClean() { is_dirty = false; }
 
@@ -62,11 +84,28 @@ namespace Paper {
         bool IsPaused() const { return isPaused; }
         void SetPaused(const bool paused) { isPaused = paused; }
 
+        //while paused, runs this many simulation ticks, one per frame
         void StepFrames(const int frames = 1) { framesToStep = frames; }
+        //interpolation factor between the last two ticks used for this frame's rendering
+        float GetRenderAlpha() const { return renderAlpha; }
 
         static void SetActive(const Shr<Scene>& newActiveScene) { activeScene = newActiveScene; }
         static Shr<Scene> GetActive() { return activeScene; }
     private:
+        //fixed ticks this frame's update should run, zero for repeated updates within one frame
+        uint32_t ConsumeTicks();
+        void SnapshotTransforms();
+        glm::mat4 GetRenderTransform(entt::entity entity, const TransformComponent& transform) const;
+
+        void IndexName(entt::entity entity, const std::string& name);
+        void UnindexName(entt::entity entity, const std::string& name);
+        void IndexTag(entt::entity entity, const std::string& tag);
+        //call once the tag is gone from DataComponent::tags, keeps the entity indexed while another of its tags has the same id
+        void UnindexTag(entt::entity entity, const std::string& tag);
+        //for when all of the entity's tags go at once
+        void UnindexTags(entt::entity entity, const std::vector<std::string>& tags);
+        void RemoveFromTagIndex(entt::entity entity, uint32_t tagID);
+
         PaperID uuid;
         std::string name;
 
@@ -75,15 +114,25 @@ namespace Paper {
         std::filesystem::path path;
 
         entt::registry registry;
-        std::unordered_map<PaperID, entt::entity> entity_map;
+        FlatHashMap<PaperID, entt::entity> entity_map;
+
+        //kept in sync by CreateEntity/DestroyEntity and the Entity name and tag setters
+        std::unordered_multimap<uint32_t, entt::entity> name_index;
+        std::unordered_map<uint32_t, std::unordered_set<entt::entity>> tag_index;
+
+        SpatialIndex spatialIndex;
+        PhysicsWorld2D physicsWorld;
 
         //runtime
         bool isPaused = false;
         int framesToStep = 0;
+        uint64_t lastTickedFrame = std::numeric_limits<uint64_t>::max();
+        float renderAlpha = 1.0f;
 
         inline static Shr<Scene> activeScene = nullptr;
 
         friend class Application;
+        friend class Entity;
         friend class SceneSerializer;
     };
 
@@ -129,6 +129,15 @@ namespace Paper
 		if (entity.HasComponent<CameraComponent>())
 			entity.GetComponent<CameraComponent>().Serialize(out);
 
+		if (entity.HasComponent<Rigidbody2DComponent>())
+			entity.GetComponent<Rigidbody2DComponent>().Serialize(out);
+
+		if (entity.HasComponent<BoxCollider2DComponent>())
+			entity.GetComponent<BoxCollider2DComponent>().Serialize(out);
+
+		if (entity.HasComponent<CircleCollider2DComponent>())
+			entity.GetComponent<CircleCollider2DComponent>().Serialize(out);
+
 		out << YAML::EndMap;
 		out << YAML::EndMap; // Entity
 
@@ -137,6 +146,8 @@ namespace Paper
 
 	void SceneSerializer::Serialize(const Shr<Scene>& scene, const std::filesystem::path& filePath)
 	{
+		PAPER_PROFILE_FUNCTION();
+
 		YAML::Emitter out;
 		out << YAML::BeginMap;
 		out << YAML::Key << "Scene" << YAML::Value << scene->GetPaperID();
@@ -267,6 +278,8 @@ namespace Paper
 
 	Shr<Scene> SceneSerializer::Deserialize(const std::filesystem::path& filePath)
 	{
+		PAPER_PROFILE_FUNCTION();
+
 		Shr<Scene> scene = MakeShr<Scene>();
 
 		YAML::Node data;
@@ -338,6 +351,15 @@ namespace Paper
 
 					if (auto camera_component = components["CameraComponent"])
 						deserialized_entity.AddComponent<CameraComponent>().Deserialize(camera_component);
+
+					if (auto rigidbody2d_component = components["Rigidbody2DComponent"])
+						deserialized_entity.AddComponent<Rigidbody2DComponent>().Deserialize(rigidbody2d_component);
+
+					if (auto box_collider2d_component = components["BoxCollider2DComponent"])
+						deserialized_entity.AddComponent<BoxCollider2DComponent>().Deserialize(box_collider2d_component);
+
+					if (auto circle_collider2d_component = components["CircleCollider2DComponent"])
+						deserialized_entity.AddComponent<CircleCollider2DComponent>().Deserialize(circle_collider2d_component);
 				}
 			}
 		}
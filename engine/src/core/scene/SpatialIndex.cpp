@@ -0,0 +1,558 @@
+#include "Engine.h"
+#include "SpatialIndex.h"
+
+#include "component/TransformComponent.h"
+
+#include <queue>
+
+namespace Paper
+{
+	//per thread, so queries can run from several script workers at once
+	static thread_local std::vector<int32_t> traversalStack;
+
+	AABB2D AABB2D::FromTransform(const TransformComponent& transform)
+	{
+		const float angle = glm::radians(transform.rotation.z);
+		const float c = std::abs(std::cos(angle));
+		const float s = std::abs(std::sin(angle));
+		const glm::vec2 half = glm::abs(glm::vec2(transform.scale)) * 0.5f;
+
+		const glm::vec2 extents(c * half.x + s * half.y, s * half.x + c * half.y);
+		const glm::vec2 center(transform.position);
+		return { center - extents, center + extents };
+	}
+
+	static AABB2D Fatten(const AABB2D& box, float margin)
+	{
+		return { box.min - glm::vec2(margin), box.max + glm::vec2(margin) };
+	}
+
+	//slab test, outDistance is 0 when the origin is inside the box
+	static bool RayIntersectsBox(const AABB2D& box, glm::vec2 origin, glm::vec2 invDirection, float maxDistance, float& outDistance)
+	{
+		const glm::vec2 t1 = (box.min - origin) * invDirection;
+		const glm::vec2 t2 = (box.max - origin) * invDirection;
+
+		const float tEnter = std::max(std::min(t1.x, t2.x), std::min(t1.y, t2.y));
+		const float tExit = std::min(std::max(t1.x, t2.x), std::max(t1.y, t2.y));
+
+		if (tExit < std::max(tEnter, 0.0f) || tEnter > maxDistance)
+			return false;
+
+		outDistance = std::max(tEnter, 0.0f);
+		return true;
+	}
+
+	static bool PrepareRay(glm::vec2 direction, glm::vec2& outInvDirection)
+	{
+		const float length = glm::length(direction);
+		if (length <= 0.0f) return false;
+
+		direction /= length;
+		//avoid 0 * inf in the slab test for axis aligned rays
+		constexpr float epsilon = 1e-12f;
+		if (std::abs(direction.x) < epsilon) direction.x = std::copysign(epsilon, direction.x);
+		if (std::abs(direction.y) < epsilon) direction.y = std::copysign(epsilon, direction.y);
+
+		outInvDirection = 1.0f / direction;
+		return true;
+	}
+
+	void SpatialIndex::Sync(entt::registry& registry)
+	{
+		++syncStamp;
+
+		auto view = registry.view<TransformComponent>();
+		for (auto [entity, transform] : view.each())
+		{
+			const AABB2D box = AABB2D::FromTransform(transform);
+
+			int32_t proxy;
+			if (const auto it = proxies.find(entity); it != proxies.end())
+			{
+				proxy = it->second;
+				MoveProxy(proxy, box);
+			}
+			else
+			{
+				proxy = CreateProxy(entity, box);
+				proxies[entity] = proxy;
+			}
+			nodes[proxy].syncStamp = syncStamp;
+		}
+
+		//every live transform has been stamped, anything left over belongs to a destroyed entity
+		if (proxies.size() > view.size())
+		{
+			std::vector<entt::entity> stale;
+			for (const auto& [entity, proxy] : proxies)
+			{
+				if (nodes[proxy].syncStamp != syncStamp)
+					stale.push_back(entity);
+			}
+			for (entt::entity entity : stale)
+				Remove(entity);
+		}
+	}
+
+	void SpatialIndex::Remove(entt::entity entity)
+	{
+		const auto it = proxies.find(entity);
+		if (it == proxies.end()) return;
+
+		DestroyProxy(it->second);
+		proxies.erase(it);
+	}
+
+	void SpatialIndex::Clear()
+	{
+		nodes.clear();
+		root = NULL_NODE;
+		freeList = NULL_NODE;
+		proxies.clear();
+	}
+
+	template <typename Fn>
+	void SpatialIndex::Traverse(const AABB2D& region, Fn&& fn) const
+	{
+		if (root == NULL_NODE) return;
+
+		std::vector<int32_t>& stack = traversalStack;
+		stack.clear();
+		stack.push_back(root);
+		while (!stack.empty())
+		{
+			const Node& node = nodes[stack.back()];
+			stack.pop_back();
+
+			if (!node.fatBox.Overlaps(region)) continue;
+
+			if (node.IsLeaf())
+			{
+				fn(node);
+			}
+			else
+			{
+				stack.push_back(node.child1);
+				stack.push_back(node.child2);
+			}
+		}
+	}
+
+	void SpatialIndex::QueryRegion(const AABB2D& region, std::vector<entt::entity>& outEntities) const
+	{
+		Traverse(region, [&](const Node& node)
+		{
+			if (node.box.Overlaps(region))
+				outEntities.push_back(node.entity);
+		});
+	}
+
+	void SpatialIndex::QueryRadius(glm::vec2 center, float radius, std::vector<entt::entity>& outEntities) const
+	{
+		const float radiusSquared = radius * radius;
+		Traverse(AABB2D(center - glm::vec2(radius), center + glm::vec2(radius)), [&](const Node& node)
+		{
+			if (node.box.DistanceSquared(center) <= radiusSquared)
+				outEntities.push_back(node.entity);
+		});
+	}
+
+	void SpatialIndex::QueryNearest(glm::vec2 point, uint32_t count, std::vector<entt::entity>& outEntities) const
+	{
+		if (root == NULL_NODE || count == 0) return;
+
+		//best first: inner nodes are keyed by their fat box as a lower bound, leaves by their exact box
+		using Candidate = std::pair<float, int32_t>;
+		std::priority_queue<Candidate, std::vector<Candidate>, std::greater<>> queue;
+		auto push = [&](int32_t index)
+		{
+			const Node& node = nodes[index];
+			queue.emplace((node.IsLeaf() ? node.box : node.fatBox).DistanceSquared(point), index);
+		};
+		push(root);
+
+		uint32_t found = 0;
+		while (!queue.empty() && found < count)
+		{
+			const int32_t index = queue.top().second;
+			queue.pop();
+
+			const Node& node = nodes[index];
+			if (node.IsLeaf())
+			{
+				outEntities.push_back(node.entity);
+				++found;
+				continue;
+			}
+
+			push(node.child1);
+			push(node.child2);
+		}
+	}
+
+	bool SpatialIndex::Raycast(glm::vec2 origin, glm::vec2 direction, float maxDistance, RaycastHit2D& outHit) const
+	{
+		glm::vec2 invDirection;
+		if (root == NULL_NODE || !PrepareRay(direction, invDirection)) return false;
+
+		float closest = maxDistance;
+		bool hit = false;
+
+		std::vector<int32_t>& stack = traversalStack;
+		stack.clear();
+		stack.push_back(root);
+		while (!stack.empty())
+		{
+			const Node& node = nodes[stack.back()];
+			stack.pop_back();
+
+			float distance;
+			if (!RayIntersectsBox(node.fatBox, origin, invDirection, closest, distance)) continue;
+
+			if (!node.IsLeaf())
+			{
+				stack.push_back(node.child1);
+				stack.push_back(node.child2);
+			}
+			else if (RayIntersectsBox(node.box, origin, invDirection, closest, distance))
+			{
+				closest = distance;
+				outHit = { node.entity, distance };
+				hit = true;
+			}
+		}
+		return hit;
+	}
+
+	void SpatialIndex::RaycastAll(glm::vec2 origin, glm::vec2 direction, float maxDistance, std::vector<RaycastHit2D>& outHits) const
+	{
+		glm::vec2 invDirection;
+		if (root == NULL_NODE || !PrepareRay(direction, invDirection)) return;
+
+		const size_t first = outHits.size();
+
+		std::vector<int32_t>& stack = traversalStack;
+		stack.clear();
+		stack.push_back(root);
+		while (!stack.empty())
+		{
+			const Node& node = nodes[stack.back()];
+			stack.pop_back();
+
+			float distance;
+			if (!RayIntersectsBox(node.fatBox, origin, invDirection, maxDistance, distance)) continue;
+
+			if (!node.IsLeaf())
+			{
+				stack.push_back(node.child1);
+				stack.push_back(node.child2);
+			}
+			else if (RayIntersectsBox(node.box, origin, invDirection, maxDistance, distance))
+			{
+				outHits.push_back({ node.entity, distance });
+			}
+		}
+
+		std::sort(outHits.begin() + first, outHits.end(), [](const RaycastHit2D& a, const RaycastHit2D& b) { return a.distance < b.distance; });
+	}
+
+	void SpatialIndex::QueryRegions(std::span<const AABB2D> regions, std::vector<entt::entity>& outEntities, std::vector<uint32_t>& outCounts) const
+	{
+		outCounts.reserve(outCounts.size() + regions.size());
+		for (const AABB2D& region : regions)
+		{
+			const size_t before = outEntities.size();
+			QueryRegion(region, outEntities);
+			outCounts.push_back((uint32_t)(outEntities.size() - before));
+		}
+	}
+
+	void SpatialIndex::QueryRadii(std::span<const glm::vec2> centers, std::span<const float> radii, std::vector<entt::entity>& outEntities, std::vector<uint32_t>& outCounts) const
+	{
+		CORE_ASSERT(centers.size() == radii.size(), "");
+
+		outCounts.reserve(outCounts.size() + centers.size());
+		for (size_t i = 0; i < centers.size(); i++)
+		{
+			const size_t before = outEntities.size();
+			QueryRadius(centers[i], radii[i], outEntities);
+			outCounts.push_back((uint32_t)(outEntities.size() - before));
+		}
+	}
+
+	int32_t SpatialIndex::CreateProxy(entt::entity entity, const AABB2D& box)
+	{
+		const int32_t proxy = AllocateNode();
+		Node& node = nodes[proxy];
+		node.box = box;
+		node.fatBox = Fatten(box, FAT_MARGIN);
+		node.entity = entity;
+		node.height = 0;
+
+		InsertLeaf(proxy);
+		return proxy;
+	}
+
+	void SpatialIndex::MoveProxy(int32_t proxy, const AABB2D& box)
+	{
+		Node& node = nodes[proxy];
+		node.box = box;
+		if (node.fatBox.Contains(box)) return;
+
+		RemoveLeaf(proxy);
+		nodes[proxy].fatBox = Fatten(box, FAT_MARGIN);
+		InsertLeaf(proxy);
+	}
+
+	void SpatialIndex::DestroyProxy(int32_t proxy)
+	{
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+	}
+
+	int32_t SpatialIndex::AllocateNode()
+	{
+		if (freeList == NULL_NODE)
+		{
+			nodes.emplace_back();
+			return (int32_t)nodes.size() - 1;
+		}
+
+		const int32_t index = freeList;
+		freeList = nodes[index].parent;
+		nodes[index] = Node();
+		return index;
+	}
+
+	void SpatialIndex::FreeNode(int32_t node)
+	{
+		nodes[node].parent = freeList;
+		nodes[node].height = -1;
+		nodes[node].entity = entt::null;
+		freeList = node;
+	}
+
+	void SpatialIndex::InsertLeaf(int32_t leaf)
+	{
+		if (root == NULL_NODE)
+		{
+			root = leaf;
+			nodes[root].parent = NULL_NODE;
+			return;
+		}
+
+		//find the cheapest sibling by perimeter, the 2D surface area heuristic
+		const AABB2D leafBox = nodes[leaf].fatBox;
+		int32_t index = root;
+		while (!nodes[index].IsLeaf())
+		{
+			const Node& node = nodes[index];
+
+			const float perimeter = node.fatBox.Perimeter();
+			const float combinedPerimeter = AABB2D::Merge(node.fatBox, leafBox).Perimeter();
+
+			const float cost = 2.0f * combinedPerimeter;
+			const float inheritanceCost = 2.0f * (combinedPerimeter - perimeter);
+
+			auto descendCost = [&](int32_t child)
+			{
+				const Node& childNode = nodes[child];
+				const float merged = AABB2D::Merge(leafBox, childNode.fatBox).Perimeter();
+				return (childNode.IsLeaf() ? merged : merged - childNode.fatBox.Perimeter()) + inheritanceCost;
+			};
+			const float cost1 = descendCost(node.child1);
+			const float cost2 = descendCost(node.child2);
+
+			if (cost < cost1 && cost < cost2)
+				break;
+
+			index = cost1 < cost2 ? node.child1 : node.child2;
+		}
+
+		const int32_t sibling = index;
+		const int32_t oldParent = nodes[sibling].parent;
+		const int32_t newParent = AllocateNode();
+
+		nodes[newParent].parent = oldParent;
+		nodes[newParent].fatBox = AABB2D::Merge(leafBox, nodes[sibling].fatBox);
+		nodes[newParent].height = nodes[sibling].height + 1;
+		nodes[newParent].child1 = sibling;
+		nodes[newParent].child2 = leaf;
+		nodes[sibling].parent = newParent;
+		nodes[leaf].parent = newParent;
+
+		if (oldParent != NULL_NODE)
+		{
+			if (nodes[oldParent].child1 == sibling)
+				nodes[oldParent].child1 = newParent;
+			else
+				nodes[oldParent].child2 = newParent;
+		}
+		else
+		{
+			root = newParent;
+		}
+
+		Refit(nodes[leaf].parent);
+	}
+
+	void SpatialIndex::RemoveLeaf(int32_t leaf)
+	{
+		if (leaf == root)
+		{
+			root = NULL_NODE;
+			return;
+		}
+
+		const int32_t parent = nodes[leaf].parent;
+		const int32_t grandParent = nodes[parent].parent;
+		const int32_t sibling = nodes[parent].child1 == leaf ? nodes[parent].child2 : nodes[parent].child1;
+
+		if (grandParent != NULL_NODE)
+		{
+			if (nodes[grandParent].child1 == parent)
+				nodes[grandParent].child1 = sibling;
+			else
+				nodes[grandParent].child2 = sibling;
+			nodes[sibling].parent = grandParent;
+			FreeNode(parent);
+
+			Refit(grandParent);
+		}
+		else
+		{
+			root = sibling;
+			nodes[sibling].parent = NULL_NODE;
+			FreeNode(parent);
+		}
+	}
+
+	//walks to the root rebalancing and fixing heights and boxes
+	void SpatialIndex::Refit(int32_t node)
+	{
+		while (node != NULL_NODE)
+		{
+			node = Balance(node);
+
+			Node& current = nodes[node];
+			const Node& child1 = nodes[current.child1];
+			const Node& child2 = nodes[current.child2];
+			current.height = 1 + std::max(child1.height, child2.height);
+			current.fatBox = AABB2D::Merge(child1.fatBox, child2.fatBox);
+
+			node = current.parent;
+		}
+	}
+
+	//single left or right rotation when the children heights differ by more than one
+	int32_t SpatialIndex::Balance(int32_t iA)
+	{
+		Node& A = nodes[iA];
+		if (A.IsLeaf() || A.height < 2)
+			return iA;
+
+		const int32_t iB = A.child1;
+		const int32_t iC = A.child2;
+		Node& B = nodes[iB];
+		Node& C = nodes[iC];
+
+		const int32_t balance = C.height - B.height;
+
+		//rotate C up
+		if (balance > 1)
+		{
+			const int32_t iF = C.child1;
+			const int32_t iG = C.child2;
+			Node& F = nodes[iF];
+			Node& G = nodes[iG];
+
+			C.child1 = iA;
+			C.parent = A.parent;
+			A.parent = iC;
+
+			if (C.parent != NULL_NODE)
+			{
+				if (nodes[C.parent].child1 == iA)
+					nodes[C.parent].child1 = iC;
+				else
+					nodes[C.parent].child2 = iC;
+			}
+			else
+			{
+				root = iC;
+			}
+
+			if (F.height > G.height)
+			{
+				C.child2 = iF;
+				A.child2 = iG;
+				G.parent = iA;
+				A.fatBox = AABB2D::Merge(B.fatBox, G.fatBox);
+				C.fatBox = AABB2D::Merge(A.fatBox, F.fatBox);
+				A.height = 1 + std::max(B.height, G.height);
+				C.height = 1 + std::max(A.height, F.height);
+			}
+			else
+			{
+				C.child2 = iG;
+				A.child2 = iF;
+				F.parent = iA;
+				A.fatBox = AABB2D::Merge(B.fatBox, F.fatBox);
+				C.fatBox = AABB2D::Merge(A.fatBox, G.fatBox);
+				A.height = 1 + std::max(B.height, F.height);
+				C.height = 1 + std::max(A.height, G.height);
+			}
+			return iC;
+		}
+
+		//rotate B up
+		if (balance < -1)
+		{
+			const int32_t iD = B.child1;
+			const int32_t iE = B.child2;
+			Node& D = nodes[iD];
+			Node& E = nodes[iE];
+
+			B.child1 = iA;
+			B.parent = A.parent;
+			A.parent = iB;
+
+			if (B.parent != NULL_NODE)
+			{
+				if (nodes[B.parent].child1 == iA)
+					nodes[B.parent].child1 = iB;
+				else
+					nodes[B.parent].child2 = iB;
+			}
+			else
+			{
+				root = iB;
+			}
+
+			if (D.height > E.height)
+			{
+				B.child2 = iD;
+				A.child1 = iE;
+				E.parent = iA;
+				A.fatBox = AABB2D::Merge(C.fatBox, E.fatBox);
+				B.fatBox = AABB2D::Merge(A.fatBox, D.fatBox);
+				A.height = 1 + std::max(C.height, E.height);
+				B.height = 1 + std::max(A.height, D.height);
+			}
+			else
+			{
+				B.child2 = iE;
+				A.child1 = iD;
+				D.parent = iA;
+				A.fatBox = AABB2D::Merge(C.fatBox, D.fatBox);
+				B.fatBox = AABB2D::Merge(A.fatBox, E.fatBox);
+				A.height = 1 + std::max(C.height, D.height);
+				B.height = 1 + std::max(A.height, E.height);
+			}
+			return iB;
+		}
+
+		return iA;
+	}
+}
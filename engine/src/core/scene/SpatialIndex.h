@@ -0,0 +1,117 @@
+#pragma once
+#include "Engine.h"
+
+#include <span>
+
+#include "utils/FlatHashMap.h"
+
+namespace Paper
+{
+	struct TransformComponent;
+
+	struct AABB2D
+	{
+		glm::vec2 min = glm::vec2(0.0f);
+		glm::vec2 max = glm::vec2(0.0f);
+
+		AABB2D() = default;
+		AABB2D(glm::vec2 min, glm::vec2 max) : min(min), max(max) {}
+
+		//bounds of the unit quad the renderer draws for this transform, rotated around z
+		static AABB2D FromTransform(const TransformComponent& transform);
+
+		bool Overlaps(const AABB2D& other) const
+		{
+			return min.x <= other.max.x && max.x >= other.min.x && min.y <= other.max.y && max.y >= other.min.y;
+		}
+
+		bool Contains(const AABB2D& other) const
+		{
+			return min.x <= other.min.x && min.y <= other.min.y && max.x >= other.max.x && max.y >= other.max.y;
+		}
+
+		float Perimeter() const { return 2.0f * ((max.x - min.x) + (max.y - min.y)); }
+
+		float DistanceSquared(glm::vec2 point) const
+		{
+			const glm::vec2 d = glm::max(glm::max(min - point, point - max), glm::vec2(0.0f));
+			return glm::dot(d, d);
+		}
+
+		static AABB2D Merge(const AABB2D& a, const AABB2D& b) { return { glm::min(a.min, b.min), glm::max(a.max, b.max) }; }
+	};
+
+	struct RaycastHit2D
+	{
+		entt::entity entity = entt::null;
+		float distance = 0.0f;
+	};
+
+	// Dynamic AABB tree over the xy extents of every entity with a TransformComponent.
+	// Leaves store a fattened box, so entities that move a little do not touch the tree.
+	class SpatialIndex
+	{
+	public:
+		SpatialIndex() = default;
+
+		//inserts new transforms, refits moved ones and drops entities that lost their transform
+		void Sync(entt::registry& registry);
+		void Remove(entt::entity entity);
+		void Clear();
+
+		size_t Size() const { return proxies.size(); }
+
+		void QueryRegion(const AABB2D& region, std::vector<entt::entity>& outEntities) const;
+		void QueryRadius(glm::vec2 center, float radius, std::vector<entt::entity>& outEntities) const;
+		//sorted by distance, nearest first
+		void QueryNearest(glm::vec2 point, uint32_t count, std::vector<entt::entity>& outEntities) const;
+
+		bool Raycast(glm::vec2 origin, glm::vec2 direction, float maxDistance, RaycastHit2D& outHit) const;
+		//sorted by distance, nearest first
+		void RaycastAll(glm::vec2 origin, glm::vec2 direction, float maxDistance, std::vector<RaycastHit2D>& outHits) const;
+
+		//results of all queries are appended to outEntities, outCounts gets one entry per query
+		void QueryRegions(std::span<const AABB2D> regions, std::vector<entt::entity>& outEntities, std::vector<uint32_t>& outCounts) const;
+		void QueryRadii(std::span<const glm::vec2> centers, std::span<const float> radii, std::vector<entt::entity>& outEntities, std::vector<uint32_t>& outCounts) const;
+
+	private:
+		static constexpr int32_t NULL_NODE = -1;
+		static constexpr float FAT_MARGIN = 0.1f;
+
+		struct Node
+		{
+			AABB2D fatBox;
+			AABB2D box;
+			int32_t parent = NULL_NODE; //next free node while on the free list
+			int32_t child1 = NULL_NODE;
+			int32_t child2 = NULL_NODE;
+			int32_t height = 0;
+			entt::entity entity = entt::null;
+			uint32_t syncStamp = 0;
+
+			bool IsLeaf() const { return child1 == NULL_NODE; }
+		};
+
+		template <typename Fn>
+		void Traverse(const AABB2D& region, Fn&& fn) const;
+
+		int32_t CreateProxy(entt::entity entity, const AABB2D& box);
+		void MoveProxy(int32_t proxy, const AABB2D& box);
+		void DestroyProxy(int32_t proxy);
+
+		int32_t AllocateNode();
+		void FreeNode(int32_t node);
+
+		void InsertLeaf(int32_t leaf);
+		void RemoveLeaf(int32_t leaf);
+		int32_t Balance(int32_t node);
+		void Refit(int32_t node);
+
+		std::vector<Node> nodes;
+		int32_t root = NULL_NODE;
+		int32_t freeList = NULL_NODE;
+
+		FlatHashMap<entt::entity, int32_t> proxies;
+		uint32_t syncStamp = 0;
+	};
+}
@@ -13,8 +13,16 @@ extern "C"
 	typedef struct _MonoClassField MonoClassField;
 	typedef struct _MonoProperty MonoProperty;
 	typedef struct _MonoString MonoString;
+	typedef struct _MonoException MonoException;
 }
 
+//calling convention of thunks from mono_method_get_unmanaged_thunk
+#ifdef CORE_PLATFORM_WINDOWS
+	#define MONO_THUNK_CALL __stdcall
+#else
+	#define MONO_THUNK_CALL
+#endif
+
 namespace Paper
 {
 	using CacheID = uint32_t;
@@ -118,7 +126,9 @@ namespace Paper
 
 		Buffer initialFieldValue;
 
-		void* monoField = nullptr;
+		//resolved once when the class is cached, only one of them is set
+		MonoClassField* monoField = nullptr;
+		MonoProperty* monoProperty = nullptr;
 
 		uint32_t monoFieldSize = 0;
 
@@ -36,15 +36,20 @@ namespace Paper
 		assemblyFileWatchers.erase(this);
 	}
 
-	void ScriptAssembly::ReloadAssembly()
+	void ScriptAssembly::ReloadAssembly(MonoImage* preparedImage)
 	{
 		UnloadAssembly();
-		LoadAssembly();
+		LoadAssembly(preparedImage);
 	}
 
-	void ScriptAssembly::LoadAssembly()
+	void ScriptAssembly::LoadAssembly(MonoImage* preparedImage)
 	{
-		monoAssembly = ScriptUtils::LoadMonoAssembly(filePath, containsPDB);
+		PAPER_PROFILE_FUNCTION();
+
+		if (preparedImage)
+			monoAssembly = ScriptUtils::LoadMonoAssembly(preparedImage, filePath);
+		else
+			monoAssembly = ScriptUtils::LoadMonoAssembly(filePath, containsPDB);
 
 		if (monoAssembly)
 			monoAssemblyImage = mono_assembly_get_image(monoAssembly);
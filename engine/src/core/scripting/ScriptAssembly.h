@@ -22,9 +22,11 @@ namespace Paper
 
 		~ScriptAssembly();
 
-		void ReloadAssembly();
+		//preparedImage comes from ScriptUtils::OpenMonoImage, without it the file is read here
+		void ReloadAssembly(MonoImage* preparedImage = nullptr);
 
 		bool IsCoreAssembly() const { return isCoreAssembly; }
+		bool ContainsPDB() const { return containsPDB; }
 		MonoAssembly* GetMonoAssembly() const { return monoAssembly; }
 		MonoImage* GetMonoAssemblyImage() const { return monoAssemblyImage; }
 		std::string GetFileName() const { return filePath.filename().string(); }
@@ -32,7 +34,7 @@ namespace Paper
 
 		static std::vector<ScriptAssembly*>& GetAllAssemblies() { return allAssemblies; }
 	private:
-		void LoadAssembly();
+		void LoadAssembly(MonoImage* preparedImage = nullptr);
 		void UnloadAssembly();
 
 		std::filesystem::path filePath = "";
@@ -19,6 +19,7 @@ namespace Paper
 		std::unordered_map<uint32_t, ManagedClass> managedClasses;
 		std::unordered_map<uint32_t, ManagedField> managedFields;
 		std::unordered_map<uint32_t, std::vector<ManagedMethod>> managedMethods;
+		std::vector<ManagedClass*> entityClasses;
 		std::vector<std::filesystem::path> assemblyPathsCached;
 	};
 
@@ -42,26 +43,17 @@ namespace Paper
 		cache->managedClasses.clear();
 		cache->managedFields.clear();
 		cache->managedMethods.clear();
+		cache->entityClasses.clear();
 		cache->assemblyPathsCached.clear();
 	}
 
 	void ScriptCache::ClearAssemblyCache(ScriptAssembly* assembly)
 	{
-		for (auto& [id, managedClass] : cache->managedClasses)
-		{
-			if (managedClass.assembly != assembly) continue;
-			cache->managedClasses.erase(id);
-		}
-		for (auto& [id, managedField] : cache->managedFields)
-		{
-			if (managedField.assembly != assembly) continue;
-			cache->managedClasses.erase(id);
-		}
-		for (auto& [id, managedMethod] : cache->managedMethods)
-		{
-			if (managedMethod.begin()->assembly != assembly) continue;
-			cache->managedClasses.erase(id);
-		}
+		std::erase_if(cache->entityClasses, [assembly](const ManagedClass* managedClass) { return managedClass->assembly == assembly; });
+		std::erase_if(cache->managedClasses, [assembly](const auto& pair) { return pair.second.assembly == assembly; });
+		std::erase_if(cache->managedFields, [assembly](const auto& pair) { return pair.second.assembly == assembly; });
+		std::erase_if(cache->managedMethods, [assembly](const auto& pair) { return pair.second.front().assembly == assembly; });
+		std::erase(cache->assemblyPathsCached, assembly->GetFilePath());
 	}
 
 	void ScriptCache::CacheAssembly(ScriptAssembly* assembly)
@@ -76,6 +68,7 @@ namespace Paper
 		const MonoTableInfo* typeDefinitionsTable = mono_image_get_table_info(assemblyImage, MONO_TABLE_TYPEDEF);
 		int32_t numTypes = mono_table_info_get_rows(typeDefinitionsTable);
 
+		std::vector<ManagedClass*> assemblyClasses;
 		for (int32_t i = 0; i < numTypes; i++)
 		{
 			uint32_t cols[MONO_TYPEDEF_SIZE];
@@ -89,14 +82,26 @@ namespace Paper
 			ManagedClass* managedClass = GetManagedClass(CacheClass(nameSpace, name, assembly));
 			if (managedClass->fullClassName == "Paper.Entity")
 				ScriptEngine::SetEntityClass(managedClass);
+			assemblyClasses.push_back(managedClass);
+		}
+
+		//the core assembly is cached first, so Paper.Entity is known by now
+		if (ManagedClass* entityClass = ScriptEngine::GetEntityClass())
+		{
+			for (ManagedClass* managedClass : assemblyClasses)
+			{
+				if (managedClass != entityClass && ScriptClass(managedClass).IsSubclassOf(entityClass))
+					cache->entityClasses.push_back(managedClass);
+			}
 		}
 
 		cache->assemblyPathsCached.push_back(assembly->GetFilePath());
 	}
 
-	std::vector<ManagedClass*> ScriptCache::GetManagedClasses()
+	FrameVector<ManagedClass*> ScriptCache::GetManagedClasses()
 	{
-		std::vector<ManagedClass*> managedClasses;
+		FrameVector<ManagedClass*> managedClasses;
+		managedClasses.reserve(cache->managedClasses.size());
 		for (ManagedClass& managedClass : cache->managedClasses | std::views::values)
 		{
 			managedClasses.push_back(&managedClass);
@@ -106,18 +111,22 @@ namespace Paper
 
 	ManagedClass* ScriptCache::GetManagedClass(CacheID classID)
 	{
-		if (!cache->managedClasses.contains(classID)) return nullptr;
-		return &cache->managedClasses.at(classID);
+		const auto it = cache->managedClasses.find(classID);
+		if (it == cache->managedClasses.end()) return nullptr;
+		return &it->second;
 	}
 
 	ManagedClass* ScriptCache::GetManagedClassFromName(const std::string& fullClassName)
 	{
-		for (ManagedClass& managedClass : cache->managedClasses | std::views::values)
-		{
-			if (managedClass.fullClassName == fullClassName)
-				return &managedClass;
-		}
-		return nullptr;
+		//class ids are the hash of the full name
+		ManagedClass* managedClass = GetManagedClass(Hash::GenerateFNVHash(fullClassName));
+		if (!managedClass || managedClass->fullClassName != fullClassName) return nullptr;
+		return managedClass;
+	}
+
+	const std::vector<ManagedClass*>& ScriptCache::GetEntityClasses()
+	{
+		return cache->entityClasses;
 	}
 
 	ManagedField* ScriptCache::GetManagedField(CacheID fieldID)
@@ -128,11 +137,10 @@ namespace Paper
 
 	ManagedMethod* ScriptCache::GetManagedMethod(ManagedClass* managedClass, const std::string& name, uint32_t parameterCount)
 	{
-		std::string methodIDName = fmt::format("{}:{}", managedClass->fullClassName, name);
-		std::string methodIDNameStd = std::format("{}:{}", managedClass->fullClassName, name);
-		CacheID methodID = Hash::GenerateFNVHash(methodIDName);
-		if (!cache->managedMethods.contains(methodID)) return nullptr;
-		for (ManagedMethod& managedMethod : cache->managedMethods.at(methodID))
+		CacheID methodID = Hash::GenerateFNVHash(fmt::format("{}:{}", managedClass->fullClassName, name));
+		const auto it = cache->managedMethods.find(methodID);
+		if (it == cache->managedMethods.end()) return nullptr;
+		for (ManagedMethod& managedMethod : it->second)
 		{
 			if (managedMethod.parameterCount == parameterCount)
 				return &managedMethod;
@@ -198,7 +206,7 @@ namespace Paper
 			managedField.monoFieldSize = mono_type_size(monoType, &align);
 
 			if (tempInstance)
-				managedField.initialFieldValue = ScriptUtils::GetFieldValue(tempInstance, managedField.fieldName, managedField.fieldType, managedField.isProperty);
+				managedField.initialFieldValue = ScriptUtils::GetFieldValue(tempInstance, managedField);
 
 			if (!managedField.initialFieldValue)
 			{
@@ -222,7 +230,7 @@ namespace Paper
 			managedField.classID = managedClass.classID;
 			managedField.fieldName = propertyName;
 			managedField.isProperty = true;
-			managedField.monoField = property;
+			managedField.monoProperty = property;
 			managedField.fieldFlags = mono_property_get_flags(property);
 			managedField.accessibilityFlags = ScriptUtils::GetFieldFlags(managedField.fieldFlags);
 			managedField.isStatic = managedField.fieldFlags & FIELD_ATTRIBUTE_STATIC;
@@ -239,7 +247,7 @@ namespace Paper
 			}
 
 			if (tempInstance)
-				managedField.initialFieldValue = ScriptUtils::GetFieldValue(tempInstance, managedField.fieldName, managedField.fieldType, managedField.isProperty);
+				managedField.initialFieldValue = ScriptUtils::GetFieldValue(tempInstance, managedField);
 
 			managedField.assembly = assembly;
 
@@ -14,9 +14,11 @@ namespace Paper
 
 		static void CacheAssembly(ScriptAssembly* assembly);
 
-		static std::vector<ManagedClass*> GetManagedClasses();
+		static FrameVector<ManagedClass*> GetManagedClasses();
 		static ManagedClass* GetManagedClass(CacheID classID);
 		static ManagedClass* GetManagedClassFromName(const std::string& fullClassName);
+		//classes deriving from Paper.Entity, collected when their assembly is cached
+		static const std::vector<ManagedClass*>& GetEntityClasses();
 
 		static ManagedField* GetManagedField(CacheID fieldID);
 		static ManagedMethod* GetManagedMethod(ManagedClass* managedClass, const std::string& name, uint32_t parameterCount = 0);
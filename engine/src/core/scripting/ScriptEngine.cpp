@@ -5,6 +5,11 @@
 #include "ScriptAssembly.h"
 #include "ScriptCache.h"
 #include "ScriptFieldStorage.h"
+#include "ScriptProfiler.h"
+#include "ScriptJobs.h"
+
+#include "utils/FlatHashMap.h"
+#include "utils/Timer.h"
 
 #include "component/ScriptComponent.h"
 #include "generic/Application.h"
@@ -16,6 +21,7 @@
 #include <mono/metadata/mono-debug.h>
 #include <mono/metadata/threads.h>
 #include <mono/metadata/attrdefs.h>
+#include <mono/metadata/mono-gc.h>
 
 #include <filewatch/FileWatch.h>
 
@@ -24,6 +30,61 @@
 
 namespace Paper
 {
+    //static methods of Paper.ScriptRuntime, which keeps the live instances grouped by class
+    struct ScriptRuntimeThunks
+    {
+        using EntityFn = void(MONO_THUNK_CALL*)(MonoObject* instance, MonoException** exception);
+        using ClearFn = void(MONO_THUNK_CALL*)(MonoException** exception);
+        using UpdateFn = void(MONO_THUNK_CALL*)(float dt, MonoException** exception);
+
+        EntityFn registerEntity = nullptr;
+        EntityFn unregisterEntity = nullptr;
+        ClearFn clear = nullptr;
+        UpdateFn update = nullptr;
+        ScriptJobs::RunBatchFn runBatch = nullptr;
+    };
+
+    //hot reload reads and opens the new images on a worker while the editor keeps running
+    struct AssemblyReloadJob
+    {
+        std::thread worker;
+        std::atomic<bool> done = false;
+
+        //core assembly first, then the app assemblies in order
+        std::vector<std::pair<std::filesystem::path, bool>> assemblies;
+        std::vector<MonoImage*> images;
+    };
+
+    //field values of every live instance in one block, taken before their domain is unloaded
+    struct FieldSnapshot
+    {
+        struct Field
+        {
+            CacheID fieldID = 0;
+            ScriptFieldType fieldType = ScriptFieldType::None;
+            uint32_t offset = 0;
+            uint32_t size = 0;
+        };
+
+        struct Instance
+        {
+            PaperID entityID;
+            uint32_t firstField = 0;
+            uint32_t fieldCount = 0;
+        };
+
+        std::vector<Instance> instances;
+        std::vector<Field> fields;
+        std::vector<uint8_t> data;
+    };
+
+    //shared with the AOT worker
+    struct AotCompileJob
+    {
+        std::atomic<bool> done = false;
+        std::atomic<bool> cancelled = false;
+    };
+
     struct ScriptEngineData
     {
         MonoDomain* rootDomain = nullptr;
@@ -34,24 +95,232 @@ namespace Paper
 
         ManagedClass* entityClass = nullptr;
 
-        std::unordered_map<PaperID, EntityInstance> entityInstances;
+        //instances are boxed, field storages keep raw pointers to them across inserts
+        FlatHashMap<PaperID, Scope<EntityInstance>> entityInstances;
 
-        std::unordered_map<PaperID, std::unordered_map<CacheID, EntityFieldStorage>> entityFieldStorage;
+        FlatHashMap<PaperID, std::unordered_map<CacheID, EntityFieldStorage>> entityFieldStorage;
 
-        bool assembliesReloadSchedule = false;
+        uint32_t componentViewVersion = 1;
 
-        bool debugEnabled = true;
+        ScriptGCStats gcStats;
+
+        //per class, invalidated with the script cache
+        std::unordered_map<CacheID, EntityCallbacks> entityCallbacks;
+
+        //set from the file watcher threads
+        std::atomic<bool> assembliesReloadSchedule = false;
+        AssemblyReloadJob reloadJob;
+
+        //compiles the AOT images of release mode for the next start
+        std::thread aotWorker;
+        Shr<AotCompileJob> aotJob;
 
         bool monoInitialized = false;
 
         //Runtime
     	Scene* sceneContext = nullptr;
+        ScriptRuntimeThunks runtime;
     };
 
-    static ScriptEngineData* script_data;
+    static ScriptEngineData* script_data = nullptr;
+
+#ifdef BUILD_DEBUG
+    static ScriptRuntimeMode runtimeMode = ScriptRuntimeMode::Debug;
+#else
+    static ScriptRuntimeMode runtimeMode = ScriptRuntimeMode::Release;
+#endif
+
+    template<typename Fn>
+    static Fn GetThunk(ManagedClass* managedClass, const std::string& methodName, uint32_t paramCount)
+    {
+        const ManagedMethod* managedMethod = ScriptCache::GetManagedMethod(managedClass, methodName, paramCount);
+        return managedMethod ? (Fn)mono_method_get_unmanaged_thunk(managedMethod->monoMethod) : nullptr;
+    }
+
+    static void HandleException(MonoException* exception)
+    {
+        if (exception)
+            mono_print_unhandled_exception((MonoObject*)exception);
+    }
+
+    static void InvokeEntityCallback(EntityCallbacks::OnCreateFn callback, MonoObject* instance, CacheID classID, PaperID entityID, ScriptCallback type)
+    {
+        MonoException* exception = nullptr;
+        if (!ScriptProfiler::IsEnabled())
+        {
+            callback(instance, &exception);
+            HandleException(exception);
+            return;
+        }
+
+        const int64_t usedBefore = mono_gc_get_used_size();
+        const uint64_t start = Profiler::Now();
+        callback(instance, &exception);
+        const float time = (float)(Profiler::Now() - start) / 1e6f;
+        const int64_t allocated = std::max<int64_t>(mono_gc_get_used_size() - usedBefore, 0);
+        HandleException(exception);
+
+        ScriptProfiler::RecordClass(classID, type, time, 1, allocated, exception ? 1 : 0);
+        ScriptProfiler::RecordEntity(entityID, classID, type, time);
+    }
+
+    //Paper.ScriptRuntime lives in the core assembly and runs the OnUpdate loop on the managed side
+    static void LoadScriptRuntime()
+    {
+        script_data->runtime = ScriptRuntimeThunks();
+
+        ManagedClass* runtimeClass = ScriptCache::GetManagedClassFromName("Paper.ScriptRuntime");
+        if (!runtimeClass)
+        {
+            LOG_CORE_ERROR("Scripting: could not find 'Paper.ScriptRuntime' in the core assembly, scripts will not update");
+            return;
+        }
+
+        script_data->runtime.registerEntity = GetThunk<ScriptRuntimeThunks::EntityFn>(runtimeClass, "Register", 1);
+        script_data->runtime.unregisterEntity = GetThunk<ScriptRuntimeThunks::EntityFn>(runtimeClass, "Unregister", 1);
+        script_data->runtime.clear = GetThunk<ScriptRuntimeThunks::ClearFn>(runtimeClass, "Clear", 0);
+        script_data->runtime.update = GetThunk<ScriptRuntimeThunks::UpdateFn>(runtimeClass, "Update", 1);
+        script_data->runtime.runBatch = GetThunk<ScriptJobs::RunBatchFn>(runtimeClass, "RunBatch", 1);
+    }
+
+    static void RegisterRuntimeInstance(const EntityInstance* instance)
+    {
+        if (!script_data->runtime.registerEntity || !instance->GetMonoInstance()) return;
+
+        MonoException* exception = nullptr;
+        script_data->runtime.registerEntity(instance->GetMonoInstance(), &exception);
+        HandleException(exception);
+    }
+
+    static void UnregisterRuntimeInstance(const EntityInstance* instance)
+    {
+        if (!script_data->runtime.unregisterEntity || !instance->GetMonoInstance()) return;
+
+        MonoException* exception = nullptr;
+        script_data->runtime.unregisterEntity(instance->GetMonoInstance(), &exception);
+        HandleException(exception);
+    }
+
+    static void StartReloadJob()
+    {
+        AssemblyReloadJob& job = script_data->reloadJob;
+        job.done = false;
+        job.images.clear();
+        job.assemblies.clear();
+
+        job.assemblies.emplace_back(script_data->coreAssembly.GetFilePath(), script_data->coreAssembly.ContainsPDB());
+        for (const ScriptAssembly& scriptAssembly : script_data->appAssemblies)
+            job.assemblies.emplace_back(scriptAssembly.GetFilePath(), scriptAssembly.ContainsPDB());
+
+        job.worker = std::thread([&job, rootDomain = script_data->rootDomain]()
+        {
+            mono_thread_attach(rootDomain);
+
+            for (const auto& [assemblyPath, loadPDB] : job.assemblies)
+                job.images.push_back(ScriptUtils::OpenMonoImage(assemblyPath, loadPDB));
+
+            mono_thread_detach(mono_thread_current());
+            job.done.store(true, std::memory_order_release);
+        });
+    }
+
+    static bool IsReloadJobRunning()
+    {
+        return script_data->reloadJob.worker.joinable();
+    }
+
+    //blocks until the worker is done, the caller owns the images afterwards
+    static std::vector<MonoImage*> FinishReloadJob()
+    {
+        AssemblyReloadJob& job = script_data->reloadJob;
+        job.worker.join();
+        return std::move(job.images);
+    }
+
+    static void CancelReloadJob()
+    {
+        if (!IsReloadJobRunning()) return;
+
+        for (MonoImage* image : FinishReloadJob())
+            if (image) mono_image_close(image);
+    }
+
+    //images that are missing or compiled from another build of their assembly get rebuilt in the background, this run keeps using the JIT for them
+    static void UpdateAotImages()
+    {
+        if (runtimeMode != ScriptRuntimeMode::Release) return;
+
+        if (script_data->aotWorker.joinable())
+        {
+            //still compiling, whatever it misses or compiled from an outdated assembly is picked up by the next reload or start
+            if (!script_data->aotJob->done.load(std::memory_order_acquire)) return;
+            script_data->aotWorker.join();
+        }
+
+        std::vector<std::filesystem::path> staleAssemblies;
+        if (!ScriptUtils::IsAotImageCurrent(script_data->coreAssembly.GetFilePath()))
+            staleAssemblies.push_back(script_data->coreAssembly.GetFilePath());
+        for (const ScriptAssembly& scriptAssembly : script_data->appAssemblies)
+            if (!ScriptUtils::IsAotImageCurrent(scriptAssembly.GetFilePath()))
+                staleAssemblies.push_back(scriptAssembly.GetFilePath());
+
+        if (staleAssemblies.empty()) return;
+
+        script_data->aotJob = MakeShr<AotCompileJob>();
+        script_data->aotWorker = std::thread([job = script_data->aotJob, staleAssemblies = std::move(staleAssemblies)]()
+        {
+            for (const std::filesystem::path& assemblyPath : staleAssemblies)
+            {
+                if (job->cancelled.load(std::memory_order_relaxed)) break;
+                ScriptUtils::CompileAotImage(assemblyPath, job->cancelled);
+            }
+            job->done.store(true, std::memory_order_release);
+        });
+    }
+
+    static FieldSnapshot TakeFieldSnapshot()
+    {
+        FieldSnapshot snapshot;
+        for (const auto& [entityID, entityInstance] : ScriptEngine::GetEntityInstances())
+        {
+            FieldSnapshot::Instance& instance = snapshot.instances.emplace_back();
+            instance.entityID = entityID;
+            instance.firstField = (uint32_t)snapshot.fields.size();
+
+            for (const CacheID fieldID : entityInstance->GetManagedClass()->fieldIDs)
+            {
+                ManagedField* managedField = ScriptCache::GetManagedField(fieldID);
+                Buffer value = entityInstance->GetFieldValue(managedField);
+                if (!value) continue;
+
+                FieldSnapshot::Field& field = snapshot.fields.emplace_back();
+                field.fieldID = fieldID;
+                field.fieldType = managedField->fieldType;
+                field.offset = (uint32_t)snapshot.data.size();
+                field.size = (uint32_t)value.size;
+                snapshot.data.insert(snapshot.data.end(), (const uint8_t*)value.data, (const uint8_t*)value.data + value.size);
+                value.Release();
+            }
+
+            instance.fieldCount = (uint32_t)snapshot.fields.size() - instance.firstField;
+        }
+        return snapshot;
+    }
+
+    void ScriptEngine::SetRuntimeMode(ScriptRuntimeMode mode)
+    {
+        CORE_ASSERT(!script_data, "the script runtime mode can't change after ScriptEngine::Init");
+        runtimeMode = mode;
+    }
+
+    ScriptRuntimeMode ScriptEngine::GetRuntimeMode()
+    {
+        return runtimeMode;
+    }
 
     void ScriptEngine::Init()
 	{
+        Timer timer;
         script_data = new ScriptEngineData();
 
         ScriptCache::Init();
@@ -63,13 +332,42 @@ namespace Paper
 
         script_data->coreAssembly = ScriptAssembly("resources/scripts/scriptcore.dll", true, true);
         ScriptGlue::RegisterComponents();
+        LoadScriptRuntime();
+
+        LOG_CORE_TRACE("Script engine initialized in {:.2f} ms ({} mode)", timer.GetElapsedMillis(), runtimeMode == ScriptRuntimeMode::Debug ? "debug" : "release");
+        UpdateAotImages();
+
+        MemoryTracker::SetSampler(MemoryTag::Mono, []() { return mono_gc_get_heap_size(); });
+        MemoryTracker::SetSampler(MemoryTag::ScriptFields, []()
+        {
+            int64_t bytes = 0;
+            for (const auto& [entityID, classStorages] : script_data->entityFieldStorage)
+                for (const auto& [classID, fieldStorages] : classStorages)
+                    for (const Shr<ScriptFieldStorage>& fieldStorage : fieldStorages)
+                        bytes += fieldStorage->data.size;
+            return bytes;
+        });
 	}
 
 	void ScriptEngine::Shutdown(bool appClose)
 	{
+        CancelReloadJob();
+
+        //a mono --aot compile can take minutes with llvm, cancelling kills it so the join returns right away.
+        //the images it didn't finish are compiled on the next start.
+        if (script_data->aotWorker.joinable())
+        {
+            script_data->aotJob->cancelled.store(true, std::memory_order_relaxed);
+            script_data->aotWorker.join();
+        }
+
+        MemoryTracker::SetSampler(MemoryTag::Mono, nullptr);
+        MemoryTracker::SetSampler(MemoryTag::ScriptFields, nullptr);
+
         ScriptCache::Shutdown();
         ShutdownMono(appClose);
     	delete script_data;
+        script_data = nullptr;
 	}
 
 	void ScriptEngine::ResetEngine()
@@ -113,29 +411,50 @@ namespace Paper
 
 	void ScriptEngine::ReloadAssemblies(bool bypassReloadScheduleCheck)
     {
+        //scheduled reloads read the new assemblies on a worker first and swap them in on a later frame
+        std::vector<MonoImage*> preparedImages;
         if (!bypassReloadScheduleCheck)
         {
-            //if no assemblies to reload just return
-            if (!script_data->assembliesReloadSchedule) return;
-            script_data->assembliesReloadSchedule = false;
+            if (!IsReloadJobRunning())
+            {
+                //if no assemblies to reload just return
+                if (!script_data->assembliesReloadSchedule.exchange(false)) return;
 
-            LOG_CORE_TRACE("Assembly change detected");
-            LOG_CORE_TRACE("\t->Reloading script assemblies");
-        }
+                LOG_CORE_TRACE("Assembly change detected");
+                LOG_CORE_TRACE("\t->Loading script assemblies in the background");
+                StartReloadJob();
+                return;
+            }
 
-        //cache scriptfieldstorage and restore it later
-        std::unordered_map<PaperID, std::unordered_map<CacheID, Buffer>> oldScriptFieldValues;
-        for (const auto& [entityID, entityInstance] : GetEntityInstances())
-        {
-            for (auto fieldID : entityInstance->GetManagedClass()->fieldIDs)
+            if (!script_data->reloadJob.done.load(std::memory_order_acquire)) return;
+
+            preparedImages = FinishReloadJob();
+            if (preparedImages.size() != script_data->appAssemblies.size() + 1 || std::ranges::find(preparedImages, nullptr) != preparedImages.end())
             {
-                ManagedField* managedField = ScriptCache::GetManagedField(fieldID);
-                oldScriptFieldValues[entityID][fieldID] = entityInstance->GetFieldValue(managedField);;
+                LOG_CORE_ERROR("Could not load the changed script assemblies, keeping the current ones");
+                for (MonoImage* image : preparedImages)
+                    if (image) mono_image_close(image);
+                return;
             }
-            DestroyScriptEntity(script_data->sceneContext->GetEntity(entityID));
+
+            LOG_CORE_TRACE("\t->Reloading script assemblies");
         }
+        else
+        {
+            //the synchronous reload reads the files itself
+            CancelReloadJob();
+        }
+
+        PAPER_PROFILE_FUNCTION();
+        Timer timer;
+
+        const FieldSnapshot snapshot = TakeFieldSnapshot();
+        for (const FieldSnapshot::Instance& instance : snapshot.instances)
+            DestroyScriptEntity(script_data->sceneContext->GetEntity(instance.entityID));
         script_data->entityInstances.clear();
 
+        //the workers are attached to the old domain
+        ScriptJobs::Shutdown();
         SetToRootDomain();
 
         mono_domain_unload(script_data->appDomain);
@@ -144,36 +463,47 @@ namespace Paper
         mono_domain_set(script_data->appDomain, true);
 
         ScriptCache::ClearCache();
+        script_data->entityCallbacks.clear();
 
-        script_data->coreAssembly.ReloadAssembly();
+        script_data->coreAssembly.ReloadAssembly(preparedImages.empty() ? nullptr : preparedImages[0]);
 
         ScriptGlue::RegisterComponents();
+        LoadScriptRuntime();
 
-        for (ScriptAssembly& scriptAssembly : script_data->appAssemblies)
-            scriptAssembly.ReloadAssembly();
+        for (size_t i = 0; i < script_data->appAssemblies.size(); i++)
+            script_data->appAssemblies[i].ReloadAssembly(preparedImages.empty() ? nullptr : preparedImages[i + 1]);
 
-
-        for (const auto& [entityID, classFieldMapBuffer] : oldScriptFieldValues)
+        for (const FieldSnapshot::Instance& instance : snapshot.instances)
         {
-            Entity entity = script_data->sceneContext->GetEntity(entityID);
+            Entity entity = script_data->sceneContext->GetEntity(instance.entityID);
             const auto& scrc = entity.GetComponent<ScriptComponent>();
 
             CreateScriptEntity(entity);
 
-            EntityInstance instance(GetEntityInheritClass(scrc.scriptClassName)->classID, entity);
-            script_data->entityInstances[entity.GetPaperID()] = instance;
-
+            Scope<EntityInstance>& instanceSlot = script_data->entityInstances[instance.entityID];
+            instanceSlot = MakeScoped<EntityInstance>(scrc.scriptClassID, entity);
+            RegisterRuntimeInstance(instanceSlot.get());
 
-            for (const auto& [fieldID, fieldBuffer] : classFieldMapBuffer)
+            for (uint32_t i = instance.firstField; i < instance.firstField + instance.fieldCount; i++)
             {
-                ManagedField* managedField = ScriptCache::GetManagedField(fieldID);
-                GetEntityScriptInstance(entityID)->SetFieldValue(managedField, fieldBuffer.data);
+                const FieldSnapshot::Field& field = snapshot.fields[i];
+
+                //fields that were removed or changed type are dropped
+                ManagedField* managedField = ScriptCache::GetManagedField(field.fieldID);
+                if (!managedField || managedField->fieldType != field.fieldType) continue;
+
+                instanceSlot->SetFieldValue(managedField, snapshot.data.data() + field.offset);
             }
         }
+
+        LOG_CORE_TRACE("Script assemblies reloaded, main thread stalled for {:.2f} ms", timer.GetElapsedMillis());
+        UpdateAotImages();
     }
 
     bool ScriptEngine::ShouldReloadAssemblies()
     {
+        if (IsReloadJobRunning())
+            return script_data->reloadJob.done.load(std::memory_order_acquire);
         return script_data->assembliesReloadSchedule;
     }
 
@@ -190,13 +520,24 @@ namespace Paper
     void ScriptEngine::OnRuntimeStart(Scene* scene)
     {
         script_data->sceneContext = scene;
+        InvalidateComponentViews();
+        ScriptProfiler::Reset();
     }
 
     void ScriptEngine::OnRuntimeStop()
     {
+        if (script_data->runtime.clear)
+        {
+            MonoException* exception = nullptr;
+            script_data->runtime.clear(&exception);
+            HandleException(exception);
+        }
+
         script_data->sceneContext = nullptr;
+        InvalidateComponentViews();
 
         script_data->entityInstances.clear();
+        ScriptJobs::Shutdown();
     }
 
     void ScriptEngine::CreateScriptEntity(Entity entity)
@@ -205,7 +546,7 @@ namespace Paper
         
         ScriptComponent& sc = entity.GetComponent<ScriptComponent>();
         
-        if (!GetEntityInheritClass(sc.scriptClassName))
+        if (!GetEntityInheritClass(sc.scriptClassID))
         {
             LOG_CORE_ERROR("tried to destroy script entity with entity '{}' because script was null", entity.GetPaperID());
             return;
@@ -214,7 +555,7 @@ namespace Paper
         auto& entityFieldStorages = GetActiveEntityFieldStorageInternal(entity);
 
 		
-        const auto& scriptFields = ScriptClass(GetEntityInheritClass(sc.scriptClassName)).GetManagedFields();
+        const auto& scriptFields = ScriptClass(GetEntityInheritClass(sc.scriptClassID)).GetManagedFields();
         for (auto field : scriptFields)
         {
             bool found = false;
@@ -235,7 +576,7 @@ namespace Paper
         
         ScriptComponent& sc = entity.GetComponent<ScriptComponent>();
         
-        if (!GetEntityInheritClass(sc.scriptClassName))
+        if (!GetEntityInheritClass(sc.scriptClassID))
         {
             LOG_CORE_ERROR("tried to destroy script entity with entity '{}' because script was null", entity.GetPaperID());
             return;
@@ -251,17 +592,19 @@ namespace Paper
             return;
         }
         const auto& scrc = entity.GetComponent<ScriptComponent>();
-        if (GetEntityInheritClass(scrc.scriptClassName))
+        if (GetEntityInheritClass(scrc.scriptClassID))
         {
-            EntityInstance instance(GetEntityInheritClass(scrc.scriptClassName)->classID, entity);
-            script_data->entityInstances[entity.GetPaperID()] = instance;
+            Scope<EntityInstance>& instanceSlot = script_data->entityInstances[entity.GetPaperID()];
+            instanceSlot = MakeScoped<EntityInstance>(scrc.scriptClassID, entity);
+            EntityInstance* instance = instanceSlot.get();
 
             //apply class variables defined in editor
             if (script_data->entityFieldStorage.contains(entity.GetPaperID()))
                 for (const auto& fieldStorage : GetActiveEntityFieldStorage(entity))
-                    fieldStorage->SetRuntimeInstance(GetEntityScriptInstance(entity.GetPaperID()));
+                    fieldStorage->SetRuntimeInstance(instance);
 
-            instance.InvokeOnCreate();
+            instance->InvokeOnCreate();
+            RegisterRuntimeInstance(instance);
         }
     }
 
@@ -276,6 +619,7 @@ namespace Paper
 
     	if (!entityInstance) return;
 
+        UnregisterRuntimeInstance(entityInstance);
         entityInstance->InvokeOnDestroy();
 
         //remove runtime instance of field storages
@@ -286,26 +630,67 @@ namespace Paper
         script_data->entityInstances.erase(entity.GetPaperID());
     }
 
-    void ScriptEngine::OnUpdateEntity(Entity entity, float dt)
+    void ScriptEngine::OnUpdateEntities(float dt)
     {
-        if (!script_data->entityInstances.contains(entity.GetPaperID()))
-        {
-            LOG_CORE_WARN("!script_data->entityInstances.contains(entity.GetPaperID()) has asserted");
-            return;
-        }
+        if (!script_data->sceneContext || !script_data->runtime.update) return;
+
+        PAPER_PROFILE_FUNCTION();
+        if (ScriptProfiler::IsEnabled())
+            ScriptProfiler::NewFrame();
+
+        ScriptGCStats& gcStats = script_data->gcStats;
+        const int64_t usedBefore = mono_gc_get_used_size();
+        const uint32_t collectionsBefore = mono_gc_collection_count(0);
+
+        MonoException* exception = nullptr;
+        script_data->runtime.update(dt, &exception);
+        HandleException(exception);
+
+        gcStats.minorCollections = mono_gc_collection_count(0);
+        gcStats.majorCollections = mono_gc_collection_count(mono_gc_max_generation());
+        gcStats.heapSize = mono_gc_get_heap_size();
+        gcStats.usedSize = mono_gc_get_used_size();
+        gcStats.lastUpdateCollected = gcStats.minorCollections != collectionsBefore;
+        gcStats.lastUpdateAllocated = std::max<int64_t>(gcStats.usedSize - usedBefore, 0);
+    }
+
+    void ScriptEngine::RunUpdateBatches(uint32_t batchCount)
+    {
+        ScriptJobs::Run(script_data->appDomain, script_data->runtime.runBatch, batchCount);
+    }
+
+    const ScriptGCStats& ScriptEngine::GetGCStats()
+    {
+        return script_data->gcStats;
+    }
+
+    const EntityCallbacks& ScriptEngine::GetEntityCallbacks(ManagedClass* entityInheritClass)
+    {
+        const auto it = script_data->entityCallbacks.find(entityInheritClass->classID);
+        if (it != script_data->entityCallbacks.end())
+            return it->second;
+
+        EntityCallbacks& callbacks = script_data->entityCallbacks[entityInheritClass->classID];
+        callbacks.onCreate = GetThunk<EntityCallbacks::OnCreateFn>(entityInheritClass, "OnCreate", 0);
+        callbacks.onDestroy = GetThunk<EntityCallbacks::OnDestroyFn>(entityInheritClass, "OnDestroy", 0);
+        return callbacks;
+    }
+
+    void ScriptEngine::InvalidateComponentViews()
+    {
+        script_data->componentViewVersion++;
+    }
 
-        GetEntityScriptInstance(entity.GetPaperID())->InvokeOnUpdate(dt);
+    uint32_t* ScriptEngine::GetComponentViewVersion()
+    {
+        return &script_data->componentViewVersion;
     }
 
     bool ScriptEngine::EntityInheritClassExists(const std::string& fullClassName)
     {
-	    const std::vector<ManagedClass*> entityInheritClasses = GetEntityInheritClasses();
-        for (const ManagedClass* entityInheritClass : entityInheritClasses)
-        {
-            if (entityInheritClass->fullClassName == fullClassName)
-                return true;
-        }
-        return false;
+        const std::vector<ManagedClass*>& entityInheritClasses = GetEntityInheritClasses();
+        ManagedClass* managedClass = ScriptCache::GetManagedClassFromName(fullClassName);
+        return managedClass && std::ranges::find(entityInheritClasses, managedClass) != entityInheritClasses.end();
     }
 
     ManagedClass* ScriptEngine::GetEntityInheritClass(const std::string& fullClassName)
@@ -313,6 +698,11 @@ namespace Paper
         return ScriptCache::GetManagedClassFromName(fullClassName);
     }
 
+    ManagedClass* ScriptEngine::GetEntityInheritClass(CacheID classID)
+    {
+        return ScriptCache::GetManagedClass(classID);
+    }
+
     Scene* ScriptEngine::GetSceneContext()
     {
         return script_data->sceneContext;
@@ -320,19 +710,20 @@ namespace Paper
 
     EntityInstance* ScriptEngine::GetEntityScriptInstance(PaperID entityID)
     {
-        if (!script_data->entityInstances.contains(entityID)) return nullptr;
-        return &script_data->entityInstances.at(entityID);
+        const auto it = script_data->entityInstances.find(entityID);
+        if (it == script_data->entityInstances.end()) return nullptr;
+        return it->second.get();
     }
 
     const EntityFieldStorage& ScriptEngine::GetActiveEntityFieldStorage(Entity entity)
     {
         ScriptComponent& sc = entity.GetComponent<ScriptComponent>();
-        if (!script_data->entityFieldStorage.contains(entity.GetPaperID()) || !script_data->entityFieldStorage.at(entity.GetPaperID()).contains(GetEntityInheritClass(sc.scriptClassName)->classID))
+        if (!script_data->entityFieldStorage.contains(entity.GetPaperID()) || !script_data->entityFieldStorage.at(entity.GetPaperID()).contains(sc.scriptClassID))
         {
             LOG_CORE_ERROR("Does not have field storage for entity '{}'", entity.GetPaperID().toString());
             return EntityFieldStorage();
         }
-        return script_data->entityFieldStorage.at(entity.GetPaperID()).at(GetEntityInheritClass(sc.scriptClassName)->classID);
+        return script_data->entityFieldStorage.at(entity.GetPaperID()).at(sc.scriptClassID);
     }
 
     std::unordered_map<CacheID, EntityFieldStorage>& ScriptEngine::GetEntityFieldStorage(Entity entity)
@@ -355,30 +746,23 @@ namespace Paper
         script_data->entityClass = managedEntityClass;
     }
 
-    std::vector<ManagedClass*> ScriptEngine::GetScriptClasses()
+    FrameVector<ManagedClass*> ScriptEngine::GetScriptClasses()
     {
         return ScriptCache::GetManagedClasses();
     }
 
-    std::vector<ManagedClass*> ScriptEngine::GetEntityInheritClasses()
+    const std::vector<ManagedClass*>& ScriptEngine::GetEntityInheritClasses()
     {
-        std::vector<ManagedClass*> managedClasses = ScriptCache::GetManagedClasses();
-        std::vector<ManagedClass*> entityClasses;
-        for (ManagedClass* managedClass : managedClasses)
-        {
-            if (managedClass->fullClassName == "Paper.Entity") continue;
-            if (ScriptClass(managedClass).IsSubclassOf(script_data->entityClass))
-                entityClasses.push_back(managedClass);
-        }
-        return entityClasses;
+        return ScriptCache::GetEntityClasses();
     }
 
-    std::unordered_map<PaperID, EntityInstance*> ScriptEngine::GetEntityInstances()
+    FrameVector<std::pair<PaperID, EntityInstance*>> ScriptEngine::GetEntityInstances()
     {
-        std::unordered_map<PaperID, EntityInstance*> entityInstances;
+        FrameVector<std::pair<PaperID, EntityInstance*>> entityInstances;
+        entityInstances.reserve(script_data->entityInstances.size());
         for (auto& [entityID, entityInstance] : script_data->entityInstances)
         {
-            entityInstances[entityID] = &entityInstance;
+            entityInstances.emplace_back(entityID, entityInstance.get());
         }
         return entityInstances;
     }
@@ -387,7 +771,7 @@ namespace Paper
     {
         mono_set_assemblies_path("mono/lib");
 
-        if (script_data->debugEnabled)
+        if (runtimeMode == ScriptRuntimeMode::Debug)
         {
             const char* argv[2] = {
                 "--debugger-agent=transport=dt_socket,address=127.0.0.1:2550,server=y,suspend=n,loglevel=3,logfile=MonoDebugger.log",
@@ -397,6 +781,11 @@ namespace Paper
             mono_jit_parse_options(2, (char**)argv);
             mono_debug_init(MONO_DEBUG_FORMAT_MONO);
         }
+        else
+        {
+            //uses an AOT image when mono finds a matching one, stale images are rejected and the JIT takes over
+            mono_jit_set_aot_mode(MONO_AOT_MODE_NORMAL);
+        }
 
         MonoDomain* rootDomain = mono_jit_init("PaperJITRuntime");
         ASSERT(rootDomain, "");
@@ -404,7 +793,7 @@ namespace Paper
         // Store the root domain pointer
         script_data->rootDomain = rootDomain;
 
-        if (script_data->debugEnabled)
+        if (runtimeMode == ScriptRuntimeMode::Debug)
             mono_debug_domain_create(script_data->rootDomain);
 
         mono_thread_set_main(mono_thread_current());
@@ -412,6 +801,7 @@ namespace Paper
 
     void ScriptEngine::ShutdownMono(bool appClose)
     {
+        ScriptJobs::Shutdown();
         SetToRootDomain();
 
         mono_domain_unload(script_data->appDomain);
@@ -428,7 +818,7 @@ namespace Paper
     EntityFieldStorage& ScriptEngine::GetActiveEntityFieldStorageInternal(Entity entity)
     {
         ScriptComponent& sc = entity.GetComponent<ScriptComponent>();
-        return script_data->entityFieldStorage[entity.GetPaperID()][GetEntityInheritClass(sc.scriptClassName)->classID];
+        return script_data->entityFieldStorage[entity.GetPaperID()][sc.scriptClassID];
     }
 
     ScriptAssembly* ScriptEngine::GetCoreAssembly()
@@ -581,12 +971,12 @@ namespace Paper
 
     Buffer ScriptInstance::GetFieldValue(ManagedField* managedField) const
     {
-        return ScriptUtils::GetFieldValue(monoInstance, managedField->fieldName, managedField->fieldType, managedField->isProperty);
+        return ScriptUtils::GetFieldValue(monoInstance, *managedField);
     }
 
     void ScriptInstance::SetFieldValue(ManagedField* managedField, const void* value) const
     {
-        ScriptUtils::SetFieldValue(monoInstance, managedField->fieldName, managedField->fieldType, managedField->isProperty, value);
+        ScriptUtils::SetFieldValue(monoInstance, *managedField, value);
     }
 
     ManagedClass* ScriptInstance::GetManagedClass() const
@@ -605,7 +995,7 @@ namespace Paper
         LoadMethods();
 
         //constructor
-        PaperID entityID = entity.GetPaperID();
+        entityID = entity.GetPaperID();
         void* param = &entityID;
         scriptClass.InvokeMethod(monoInstance, constructor, &param);
     }
@@ -613,27 +1003,18 @@ namespace Paper
     void EntityInstance::LoadMethods()
     {
         constructor = ScriptClass(script_data->entityClass).GetMethod(".ctor", 1);
-        onCreateMethod = scriptClass.GetMethod("OnCreate", 0);
-        onDestroyMethod = scriptClass.GetMethod("OnDestroy", 0);
-        onUpdateMethod = scriptClass.GetMethod("OnUpdate", 1);
+        callbacks = ScriptEngine::GetEntityCallbacks(managedClass);
     }
 
     void EntityInstance::InvokeOnCreate() const
     {
-        if (onCreateMethod)
-			scriptClass.InvokeMethod(monoInstance, onCreateMethod);
+        if (!callbacks.onCreate) return;
+        InvokeEntityCallback(callbacks.onCreate, monoInstance, managedClassID, entityID, ScriptCallback::OnCreate);
     }
 
     void EntityInstance::InvokeOnDestroy() const
     {
-        if (onDestroyMethod)
-			scriptClass.InvokeMethod(monoInstance, onDestroyMethod);
-    }
-
-    void EntityInstance::InvokeOnUpdate(float dt) const
-    {
-        void* param = &dt;
-        if (onUpdateMethod)
-			scriptClass.InvokeMethod(monoInstance, onUpdateMethod, &param);
+        if (!callbacks.onDestroy) return;
+        InvokeEntityCallback(callbacks.onDestroy, monoInstance, managedClassID, entityID, ScriptCallback::OnDestroy);
     }
 }
@@ -62,6 +62,18 @@ namespace Paper
 		ManagedClass* managedClass = nullptr;
 	};
 
+	// Unmanaged thunks of the entity callbacks, resolved once per class. They are called with the instance
+	// first and an exception out param last, without the boxing and marshalling of mono_runtime_invoke.
+	// OnUpdate is not here, Paper.ScriptRuntime calls it from managed code.
+	struct EntityCallbacks
+	{
+		using OnCreateFn = void(MONO_THUNK_CALL*)(MonoObject* instance, MonoException** exception);
+		using OnDestroyFn = void(MONO_THUNK_CALL*)(MonoObject* instance, MonoException** exception);
+
+		OnCreateFn onCreate = nullptr;
+		OnDestroyFn onDestroy = nullptr;
+	};
+
 	class ScriptInstance
 	{
 	public:
@@ -91,21 +103,44 @@ namespace Paper
 
 		void InvokeOnCreate() const;
 		void InvokeOnDestroy() const;
-		void InvokeOnUpdate(float dt) const;
 
 	private:
 		ManagedMethod* constructor = nullptr;
-		ManagedMethod* onCreateMethod = nullptr;
-		ManagedMethod* onDestroyMethod = nullptr;
-		ManagedMethod* onUpdateMethod = nullptr;
+		EntityCallbacks callbacks;
+		PaperID entityID;
 
 		//convenience
 		ScriptClass scriptClass;
 	};
 
+	//garbage collector counters, sampled around each script update
+	struct ScriptGCStats
+	{
+		uint32_t minorCollections = 0;
+		uint32_t majorCollections = 0;
+		int64_t heapSize = 0;
+		int64_t usedSize = 0;
+
+		//bytes the last script update added to the heap, only exact when no collection ran during it
+		int64_t lastUpdateAllocated = 0;
+		bool lastUpdateCollected = false;
+	};
+
+	enum class ScriptRuntimeMode
+	{
+		//debugger agent and soft breakpoints, everything is JIT compiled
+		Debug,
+		//no debugger, loads AOT images of the assemblies when they are current and JIT compiles the rest
+		Release
+	};
+
 	class ScriptEngine
 	{
 	public:
+		//has to be set before Init
+		static void SetRuntimeMode(ScriptRuntimeMode mode);
+		static ScriptRuntimeMode GetRuntimeMode();
+
 		static void Init();
 		static void Shutdown(bool appClose = false);
 
@@ -115,6 +150,8 @@ namespace Paper
 		static void RemoveAppAssembly(const std::filesystem::path& assemblyPath);
 		static void ClearAppAssemblies();
 
+		//a scheduled reload first loads the assemblies on a worker and swaps them in once that is done,
+		//call it every frame while ShouldReloadAssemblies is true. bypassReloadScheduleCheck reloads right away.
 		static void ReloadAssemblies(bool bypassReloadScheduleCheck = false);
 
 		static bool ShouldReloadAssemblies();
@@ -130,7 +167,11 @@ namespace Paper
 
 		static void OnCreateEntity(Entity entity);
 		static void OnDestroyEntity(Entity entity);
-		static void OnUpdateEntity(Entity entity, float dt);
+		//one call into managed code per tick, updates every registered instance
+		static void OnUpdateEntities(float dt);
+		//called back by Paper.ScriptRuntime during OnUpdateEntities, runs the OnUpdate batches
+		//of the [ThreadSafe] scripts on the script workers
+		static void RunUpdateBatches(uint32_t batchCount);
 
 
 		static Scene* GetSceneContext();
@@ -141,16 +182,25 @@ namespace Paper
 		static ScriptAssembly* GetCoreAssembly();
 		static std::vector<ScriptAssembly*> GetAppAssemblies();
 
+		static const EntityCallbacks& GetEntityCallbacks(ManagedClass* entityInheritClass);
+
 		static ManagedClass* GetEntityClass();
 		static void SetEntityClass(ManagedClass* managedEntityClass);
 
-		static std::vector<ManagedClass*> GetScriptClasses();
+		static FrameVector<ManagedClass*> GetScriptClasses();
 
-		static std::vector<ManagedClass*> GetEntityInheritClasses();
+		static const std::vector<ManagedClass*>& GetEntityInheritClasses();
 		static ManagedClass* GetEntityInheritClass(const std::string& fullClassName);
+		static ManagedClass* GetEntityInheritClass(CacheID classID);
 		static bool EntityInheritClassExists(const std::string& fullClassName);
 
-		static std::unordered_map<PaperID, EntityInstance*> GetEntityInstances();
+		static FrameVector<std::pair<PaperID, EntityInstance*>> GetEntityInstances();
+
+		//scripts cache component pointers and fetch them again when this version changes
+		static void InvalidateComponentViews();
+		static uint32_t* GetComponentViewVersion();
+
+		static const ScriptGCStats& GetGCStats();
 	private:
 		static void InitMono();
 		static void ShutdownMono(bool appClose);
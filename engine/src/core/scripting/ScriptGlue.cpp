@@ -3,14 +3,20 @@
 
 #include "ScriptEngine.h"
 #include "ScriptAssembly.h"
+#include "ScriptProfiler.h"
+#include "ScriptJobs.h"
 
 #include "Components.h"
 
 #include "scene//Scene.h"
+#include "generic/Application.h"
+#include "generic/Hash.h"
 #include "renderer/Font.h"
+#include "assets/AssetManager.h"
 #include "event/Input.h"
 
 #include <mono/jit/jit.h>
+#include <mono/metadata/exception.h>
 
 #include <glm/gtx/string_cast.hpp>
 
@@ -22,6 +28,28 @@ namespace Paper
 
 #define MONO_STRING(Value) mono_string_new(mono_domain_get(), Value)
 
+    //calls that change state other scripts can see go through here. While a [ThreadSafe] batch runs they are
+    //recorded and applied after it, so they must not capture managed objects or component references.
+    template<typename Fn>
+    static void RunOrDefer(Fn&& fn)
+    {
+        if (ScriptJobs::InBatch())
+            ScriptJobs::Defer(std::forward<Fn>(fn));
+        else
+            fn();
+    }
+
+    //calls that return shared state can't be deferred, they throw from a [ThreadSafe] batch instead.
+    //the exception is left pending and thrown once the call is back in managed code, so callers return right after.
+    static bool RequireMainThread(const char* callName)
+    {
+        if (!ScriptJobs::InBatch()) return true;
+
+        const std::string message = fmt::format("{} can't be used from a [ThreadSafe] OnUpdate", callName);
+        mono_runtime_set_pending_exception(mono_get_exception_invalid_operation(message.c_str()), false);
+        return false;
+    }
+
 	//Input
     static bool IsKeyPressed(int code)
     {
@@ -63,6 +91,52 @@ namespace Paper
         return Input::IsMouseButtonReleased((MouseButton)button);
     }
 
+    //Time
+    static float Time_GetDeltaTime()
+    {
+        return Application::GetFixedDT();
+    }
+
+    static float Time_GetFrameDeltaTime()
+    {
+        return Application::GetDT();
+    }
+
+    static double Time_GetTime()
+    {
+        return Application::GetTime();
+    }
+
+    static double Time_GetTickTime()
+    {
+        return Application::GetFixedTimestep().GetTickTime();
+    }
+
+    static uint64_t Time_GetTick()
+    {
+        return Application::GetFixedTimestep().GetTick();
+    }
+
+    static uint64_t Time_GetFrameCount()
+    {
+        return Application::GetFrameCount();
+    }
+
+    static uint32_t Time_GetTickRate()
+    {
+        return Application::GetFixedTimestep().GetTickRate();
+    }
+
+    static void Time_SetTickRate(uint32_t tickRate)
+    {
+        RunOrDefer([tickRate]() { Application::GetFixedTimestep().SetTickRate(tickRate); });
+    }
+
+    static float Time_GetInterpolationAlpha()
+    {
+        return Application::GetFixedTimestep().GetAlpha();
+    }
+
     //Render
     struct TextureData
     {
@@ -73,11 +147,8 @@ namespace Paper
     };
     static void GetTexture(MonoString* filePath, TextureData* data)
     {
-        char* filePath_c = mono_string_to_utf8(filePath);
-        std::string filePath_std(filePath_c);
-        mono_free(filePath_c);
-
-        Shr<Texture> texture = DataPool::GetAssetTexture(filePath_std, true);
+        if (!RequireMainThread("Texture loading")) return;
+        Texture* texture = AssetManager::Get(AssetManager::LoadProjectTexture(ScriptUtils::MonoStringToFrameString(filePath)));
         TextureData localData;
         if (texture)
         {
@@ -110,13 +181,15 @@ namespace Paper
 
     static void EntityCamera_SetPerspectiveFOV(PaperID entityID, float fov)
     {
-        Scene* scene = ScriptEngine::GetSceneContext();
-        CORE_ASSERT(scene, "");
-        Entity entity = scene->GetEntity(entityID);
-        CORE_ASSERT(entity, "");
+        RunOrDefer([entityID, fov]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
 
-        auto& cc = entity.GetComponent<CameraComponent>();
-        cc.camera.SetPerspectiveFOV(fov);
+            auto& cc = entity.GetComponent<CameraComponent>();
+            cc.camera.SetPerspectiveFOV(fov);
+        });
     }
 
     static float EntityCamera_GetPerspectiveNearClip(PaperID entityID)
@@ -132,13 +205,15 @@ namespace Paper
 
     static void EntityCamera_SetPerspectiveNearClip(PaperID entityID, float nearClip)
     {
-        Scene* scene = ScriptEngine::GetSceneContext();
-        CORE_ASSERT(scene, "");
-        Entity entity = scene->GetEntity(entityID);
-        CORE_ASSERT(entity, "");
+        RunOrDefer([entityID, nearClip]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
 
-        auto& cc = entity.GetComponent<CameraComponent>();
-        cc.camera.SetPerspectiveNearClip(nearClip);
+            auto& cc = entity.GetComponent<CameraComponent>();
+            cc.camera.SetPerspectiveNearClip(nearClip);
+        });
     }
 
     static float EntityCamera_GetPerspectiveFarClip(PaperID entityID)
@@ -154,13 +229,15 @@ namespace Paper
 
     static void EntityCamera_SetPerspectiveFarClip(PaperID entityID, float farClip)
     {
-        Scene* scene = ScriptEngine::GetSceneContext();
-        CORE_ASSERT(scene, "");
-        Entity entity = scene->GetEntity(entityID);
-        CORE_ASSERT(entity, "");
+        RunOrDefer([entityID, farClip]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
 
-        auto& cc = entity.GetComponent<CameraComponent>();
-        cc.camera.SetPerspectiveFarClip(farClip);
+            auto& cc = entity.GetComponent<CameraComponent>();
+            cc.camera.SetPerspectiveFarClip(farClip);
+        });
     }
 
     static float EntityCamera_GetOrthographicSize(PaperID entityID)
@@ -176,13 +253,15 @@ namespace Paper
 
     static void EntityCamera_SetOrthographicSize(PaperID entityID, float size)
     {
-        Scene* scene = ScriptEngine::GetSceneContext();
-        CORE_ASSERT(scene, "");
-        Entity entity = scene->GetEntity(entityID);
-        CORE_ASSERT(entity, "");
+        RunOrDefer([entityID, size]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
 
-        auto& cc = entity.GetComponent<CameraComponent>();
-        cc.camera.SetOrthographicSize(size);
+            auto& cc = entity.GetComponent<CameraComponent>();
+            cc.camera.SetOrthographicSize(size);
+        });
     }
 
     static float EntityCamera_GetOrthographicNearClip(PaperID entityID)
@@ -198,13 +277,15 @@ namespace Paper
 
     static void EntityCamera_SetOrthographicNearClip(PaperID entityID, float nearClip)
     {
-        Scene* scene = ScriptEngine::GetSceneContext();
-        CORE_ASSERT(scene, "");
-        Entity entity = scene->GetEntity(entityID);
-        CORE_ASSERT(entity, "");
+        RunOrDefer([entityID, nearClip]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
 
-        auto& cc = entity.GetComponent<CameraComponent>();
-        cc.camera.SetOrthographicNearClip(nearClip);
+            auto& cc = entity.GetComponent<CameraComponent>();
+            cc.camera.SetOrthographicNearClip(nearClip);
+        });
     }
 
     static float EntityCamera_GetOrthographicFarClip(PaperID entityID)
@@ -220,24 +301,28 @@ namespace Paper
 
     static void EntityCamera_SetOrthographicFarClip(PaperID entityID, float farClip)
     {
-        Scene* scene = ScriptEngine::GetSceneContext();
-        CORE_ASSERT(scene, "");
-        Entity entity = scene->GetEntity(entityID);
-        CORE_ASSERT(entity, "");
+        RunOrDefer([entityID, farClip]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
 
-        auto& cc = entity.GetComponent<CameraComponent>();
-        cc.camera.SetOrthographicFarClip(farClip);
+            auto& cc = entity.GetComponent<CameraComponent>();
+            cc.camera.SetOrthographicFarClip(farClip);
+        });
     }
 
     static void EntityCamera_SetViewportSize(PaperID entityID, glm::vec2* size)
     {
-        Scene* scene = ScriptEngine::GetSceneContext();
-        CORE_ASSERT(scene, "");
-        Entity entity = scene->GetEntity(entityID);
-        CORE_ASSERT(entity, "");
+        RunOrDefer([entityID, viewportSize = *size]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
 
-        auto& cc = entity.GetComponent<CameraComponent>();
-        cc.camera.SetViewportSize(size->x, size->y);
+            auto& cc = entity.GetComponent<CameraComponent>();
+            cc.camera.SetViewportSize(viewportSize.x, viewportSize.y);
+        });
     }
 
     static bool Entity_HasComponent(PaperID entityID, MonoReflectionType* componentType)
@@ -257,7 +342,7 @@ namespace Paper
     {
         Scene* scene = ScriptEngine::GetSceneContext();
         CORE_ASSERT(scene, "");
-        std::string entityName = ScriptUtils::MonoStringToStdString(name);
+        const std::string_view entityName = ScriptUtils::MonoStringToFrameString(name);
 
         Entity entity = scene->GetEntityByName(entityName);
         if (entity)
@@ -265,6 +350,78 @@ namespace Paper
         return 0;
     }
 
+    static bool Entity_HasTag(PaperID entityID, MonoString* tag)
+    {
+        Scene* scene = ScriptEngine::GetSceneContext();
+        CORE_ASSERT(scene, "");
+        Entity entity = scene->GetEntity(entityID);
+        CORE_ASSERT(entity, "");
+
+        return entity.HasTag(ScriptUtils::MonoStringToFrameString(tag));
+    }
+
+    static MonoArray* Entity_GetEntitiesWithTag(MonoString* tag)
+    {
+        Scene* scene = ScriptEngine::GetSceneContext();
+        CORE_ASSERT(scene, "");
+
+        std::vector<Entity> entities = scene->GetEntitiesWithTag(ScriptUtils::MonoStringToFrameString(tag));
+        MonoArray* entityIDs = mono_array_new(mono_domain_get(), mono_get_uint64_class(), entities.size());
+        for (size_t i = 0; i < entities.size(); i++)
+            mono_array_set(entityIDs, uint64_t, i, entities[i].GetPaperID().toUInt64());
+        return entityIDs;
+    }
+
+    static uint32_t Tag_GetID(MonoString* tag)
+    {
+        return Scene::GetTagID(ScriptUtils::MonoStringToFrameString(tag));
+    }
+
+    static bool Entity_HasTagID(PaperID entityID, uint32_t tagID)
+    {
+        Scene* scene = ScriptEngine::GetSceneContext();
+        CORE_ASSERT(scene, "");
+        Entity entity = scene->GetEntity(entityID);
+        CORE_ASSERT(entity, "");
+
+        return scene->EntityHasTag(entity, tagID);
+    }
+
+    //fills the caller's buffer and returns the total count, the caller grows the buffer and asks again when it was too small
+    static int32_t Entity_GetEntitiesWithTagID(uint32_t tagID, MonoArray* buffer)
+    {
+        Scene* scene = ScriptEngine::GetSceneContext();
+        CORE_ASSERT(scene, "");
+
+        const std::vector<Entity> entities = scene->GetEntitiesWithTag(tagID);
+        const size_t capacity = mono_array_length(buffer);
+        for (size_t i = 0; i < entities.size() && i < capacity; i++)
+            mono_array_set(buffer, uint64_t, i, entities[i].GetPaperID().toUInt64());
+        return (int32_t)entities.size();
+    }
+
+    static bool ScriptProfiler_IsEnabled()
+    {
+        return ScriptProfiler::IsEnabled();
+    }
+
+    //same id ScriptCache gives the class
+    static uint32_t ScriptProfiler_GetClassID(MonoReflectionType* classType)
+    {
+        MonoClass* monoClass = mono_class_from_mono_type(mono_reflection_type_get_type(classType));
+        const std::string nameSpace = mono_class_get_namespace(monoClass);
+        const std::string name = mono_class_get_name(monoClass);
+        return Hash::GenerateFNVHash(nameSpace.empty() ? name : fmt::format("{}.{}", nameSpace, name));
+    }
+
+    //one report per class and frame from Paper.ScriptRuntime
+    static void ScriptProfiler_ReportUpdate(uint32_t classID, float time, int32_t calls, int64_t allocated, int32_t exceptions, MonoArray* entityIDs, MonoArray* entityTimes, int32_t entityCount)
+    {
+        ScriptProfiler::RecordClass(classID, ScriptCallback::OnUpdate, time, calls, allocated, exceptions);
+        for (int32_t i = 0; i < entityCount; i++)
+            ScriptProfiler::RecordEntity(mono_array_get(entityIDs, uint64_t, i), classID, ScriptCallback::OnUpdate, mono_array_get(entityTimes, float, i));
+    }
+
     static MonoObject* Entity_GetScriptInstance(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
@@ -282,41 +439,196 @@ namespace Paper
         return nullptr;
     }
 
-    //Components
-    static void TransformComponent_GetPosition(PaperID entityID, glm::vec3* outPosition)
+    //the id is picked right away, from a [ThreadSafe] script the entity itself exists after the batch
+    static uint64_t Scene_CreateEntity(MonoString* name)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        *outPosition = scene->GetEntity(entityID).GetComponent<TransformComponent>().position;
+        CORE_ASSERT(scene, "");
+
+        const PaperID entityID;
+        RunOrDefer([scene, entityID, entityName = ScriptUtils::MonoStringToStdString(name)]()
+        {
+            scene->CreateEntity(entityID, entityName);
+        });
+        return entityID.toUInt64();
     }
 
-    static void TransformComponent_SetPosition(PaperID entityID, glm::vec3* inPosition)
+    static void Entity_Destroy(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        scene->GetEntity(entityID).GetComponent<TransformComponent>().position = *inPosition;
+        CORE_ASSERT(scene, "");
+
+        RunOrDefer([scene, entityID]()
+        {
+            if (Entity entity = scene->GetEntity(entityID))
+                scene->DestroyEntity(entity);
+        });
     }
 
-    static void TransformComponent_GetRotation(PaperID entityID, glm::vec3* outRotation)
+    static void ScriptRuntime_RunBatches(int32_t batchCount)
+    {
+        ScriptEngine::RunUpdateBatches((uint32_t)std::max(batchCount, 0));
+    }
+
+    //Spatial queries, per thread since [ThreadSafe] scripts query from the workers
+    static thread_local std::vector<entt::entity> queryResults;
+    static thread_local std::vector<uint32_t> queryCounts;
+
+    static MonoArray* EntitiesToMonoArray(Scene* scene, const std::vector<entt::entity>& entities)
+    {
+        MonoArray* entityIDs = mono_array_new(mono_domain_get(), mono_get_uint64_class(), entities.size());
+        for (size_t i = 0; i < entities.size(); i++)
+            mono_array_set(entityIDs, uint64_t, i, Entity(entities[i], scene).GetPaperID().toUInt64());
+        return entityIDs;
+    }
+
+    static MonoArray* Scene_QueryRegion(glm::vec2* min, glm::vec2* max)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        *outRotation = scene->GetEntity(entityID).GetComponent<TransformComponent>().rotation;
+        CORE_ASSERT(scene, "");
+
+        queryResults.clear();
+        scene->GetSpatialIndex().QueryRegion(AABB2D(*min, *max), queryResults);
+        return EntitiesToMonoArray(scene, queryResults);
     }
 
-    static void TransformComponent_SetRotation(PaperID entityID, glm::vec3* inRotation)
+    static MonoArray* Scene_QueryRadius(glm::vec2* center, float radius)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        scene->GetEntity(entityID).GetComponent<TransformComponent>().rotation = *inRotation;
+        CORE_ASSERT(scene, "");
+
+        queryResults.clear();
+        scene->GetSpatialIndex().QueryRadius(*center, radius, queryResults);
+        return EntitiesToMonoArray(scene, queryResults);
     }
 
-    static void TransformComponent_GetScale(PaperID entityID, glm::vec3* outScale)
+    static MonoArray* Scene_QueryNearest(glm::vec2* point, int count)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        *outScale = scene->GetEntity(entityID).GetComponent<TransformComponent>().scale;
+        CORE_ASSERT(scene, "");
+
+        queryResults.clear();
+        scene->GetSpatialIndex().QueryNearest(*point, (uint32_t)std::max(count, 0), queryResults);
+        return EntitiesToMonoArray(scene, queryResults);
     }
 
-    static void TransformComponent_SetScale(PaperID entityID, glm::vec3* inScale)
+    static bool Scene_Raycast(glm::vec2* origin, glm::vec2* direction, float maxDistance, uint64_t* outEntityID, float* outDistance)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        scene->GetEntity(entityID).GetComponent<TransformComponent>().scale = *inScale;
+        CORE_ASSERT(scene, "");
+
+        RaycastHit2D hit;
+        if (!scene->GetSpatialIndex().Raycast(*origin, *direction, maxDistance, hit))
+            return false;
+
+        *outEntityID = Entity(hit.entity, scene).GetPaperID().toUInt64();
+        *outDistance = hit.distance;
+        return true;
+    }
+
+    static MonoArray* Scene_RaycastAll(glm::vec2* origin, glm::vec2* direction, float maxDistance, MonoArray** outDistances)
+    {
+        Scene* scene = ScriptEngine::GetSceneContext();
+        CORE_ASSERT(scene, "");
+
+        std::vector<RaycastHit2D> hits;
+        scene->GetSpatialIndex().RaycastAll(*origin, *direction, maxDistance, hits);
+
+        MonoArray* entityIDs = mono_array_new(mono_domain_get(), mono_get_uint64_class(), hits.size());
+        *outDistances = mono_array_new(mono_domain_get(), mono_get_single_class(), hits.size());
+        for (size_t i = 0; i < hits.size(); i++)
+        {
+            mono_array_set(entityIDs, uint64_t, i, Entity(hits[i].entity, scene).GetPaperID().toUInt64());
+            mono_array_set(*outDistances, float, i, hits[i].distance);
+        }
+        return entityIDs;
+    }
+
+    //batch queries read both arrays by the same index. When they don't line up the exception is left pending
+    //for the calling script like in RequireMainThread, and the caller returns right away.
+    static bool ValidateQueryArrays(MonoArray* first, const char* firstName, MonoArray* second, const char* secondName)
+    {
+        if (!first || !second)
+        {
+            mono_runtime_set_pending_exception(mono_get_exception_argument_null(first ? secondName : firstName), false);
+            return false;
+        }
+        if (mono_array_length(first) != mono_array_length(second))
+        {
+            const std::string message = fmt::format("Expected {} elements to match {}", mono_array_length(first), firstName);
+            mono_runtime_set_pending_exception(mono_get_exception_argument(secondName, message.c_str()), false);
+            return false;
+        }
+        return true;
+    }
+
+    //all results flattened into one array, outCounts holds how many belong to each query
+    static MonoArray* Scene_QueryRegionBatch(MonoArray* mins, MonoArray* maxs, MonoArray** outCounts)
+    {
+        Scene* scene = ScriptEngine::GetSceneContext();
+        CORE_ASSERT(scene, "");
+
+        if (!ValidateQueryArrays(mins, "_Mins", maxs, "_Maxs")) return nullptr;
+        const size_t queryCount = mono_array_length(mins);
+
+        std::vector<AABB2D> regions(queryCount);
+        for (size_t i = 0; i < queryCount; i++)
+            regions[i] = AABB2D(mono_array_get(mins, glm::vec2, i), mono_array_get(maxs, glm::vec2, i));
+
+        queryResults.clear();
+        queryCounts.clear();
+        scene->GetSpatialIndex().QueryRegions(regions, queryResults, queryCounts);
+
+        *outCounts = mono_array_new(mono_domain_get(), mono_get_int32_class(), queryCount);
+        for (size_t i = 0; i < queryCount; i++)
+            mono_array_set(*outCounts, int32_t, i, (int32_t)queryCounts[i]);
+        return EntitiesToMonoArray(scene, queryResults);
+    }
+
+    static MonoArray* Scene_QueryRadiusBatch(MonoArray* centers, MonoArray* radii, MonoArray** outCounts)
+    {
+        Scene* scene = ScriptEngine::GetSceneContext();
+        CORE_ASSERT(scene, "");
+
+        if (!ValidateQueryArrays(centers, "_Centers", radii, "_Radii")) return nullptr;
+        const size_t queryCount = mono_array_length(centers);
+
+        //managed Vec2[] and float[] are laid out like their native counterparts
+        const std::span<const glm::vec2> centerSpan(queryCount ? mono_array_addr(centers, glm::vec2, 0) : nullptr, queryCount);
+        const std::span<const float> radiusSpan(queryCount ? mono_array_addr(radii, float, 0) : nullptr, queryCount);
+
+        queryResults.clear();
+        queryCounts.clear();
+        scene->GetSpatialIndex().QueryRadii(centerSpan, radiusSpan, queryResults, queryCounts);
+
+        *outCounts = mono_array_new(mono_domain_get(), mono_get_int32_class(), queryCount);
+        for (size_t i = 0; i < queryCount; i++)
+            mono_array_set(*outCounts, int32_t, i, (int32_t)queryCounts[i]);
+        return EntitiesToMonoArray(scene, queryResults);
+    }
+
+    //Components
+    //managed TransformData and SpriteData mirror these members, scripts read and write them in place
+    static_assert(offsetof(TransformComponent, scale) == offsetof(TransformComponent, position) + sizeof(glm::vec3));
+    static_assert(offsetof(TransformComponent, rotation) == offsetof(TransformComponent, scale) + sizeof(glm::vec3));
+    static_assert(offsetof(SpriteComponent, tiling_factor) == offsetof(SpriteComponent, color) + sizeof(glm::vec4));
+    static_assert(offsetof(SpriteComponent, tex_coords) == offsetof(SpriteComponent, tiling_factor) + sizeof(float));
+    static_assert(offsetof(SpriteComponent, geometry) == offsetof(SpriteComponent, tex_coords) + sizeof(SpriteComponent::tex_coords));
+    static_assert(offsetof(SpriteComponent, thickness) == offsetof(SpriteComponent, geometry) + sizeof(int32_t));
+    static_assert(offsetof(SpriteComponent, fade) == offsetof(SpriteComponent, thickness) + sizeof(float));
+
+    static uint32_t* ComponentViews_GetVersion()
+    {
+        return ScriptEngine::GetComponentViewVersion();
+    }
+
+    //pointers stay valid until ComponentViews_GetVersion changes
+    static void* TransformComponent_GetData(PaperID entityID)
+    {
+        Scene* scene = ScriptEngine::GetSceneContext();
+        Entity entity = scene->GetEntity(entityID);
+        if (!entity || !entity.HasComponent<TransformComponent>()) return nullptr;
+        return &entity.GetComponent<TransformComponent>().position;
     }
 
     static MonoString* DataComponent_GetName(PaperID entityID)
@@ -328,19 +640,20 @@ namespace Paper
 
     static void DataComponent_SetName(PaperID entityID, MonoString* name)
     {
-        Scene* scene = ScriptEngine::GetSceneContext();
-        auto& dc = scene->GetEntity(entityID).GetComponent<DataComponent>();
-        char* name_c = mono_string_to_utf8(name);
-        dc.name = name_c;
-        mono_free(name_c);
+        RunOrDefer([entityID, entityName = ScriptUtils::MonoStringToStdString(name)]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            if (Entity entity = scene->GetEntity(entityID))
+                entity.SetName(entityName);
+        });
     }
 
     static MonoString* DataComponent_GetTags(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
         auto& dc = scene->GetEntity(entityID).GetComponent<DataComponent>();
-        std::string tagList;
-    	for (const std::string tag : dc.tags)
+        FrameString tagList;
+    	for (const std::string& tag : dc.tags)
         {
             tagList += tag;
             tagList += ',';
@@ -353,29 +666,28 @@ namespace Paper
     static void DataComponent_SetTags(PaperID entityID, MonoString* name)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& dc = scene->GetEntity(entityID).GetComponent<DataComponent>();
-        char* name_c = mono_string_to_utf8(name);
-        std::stringstream tagList(name_c);
-        mono_free(name_c);
-        dc.tags.clear();
-        std::string temp;
-        while (getline(tagList, temp, ',')) {
-            dc.tags.push_back(temp);
+        std::string_view tagList = ScriptUtils::MonoStringToFrameString(name);
+        std::vector<std::string> tags;
+        while (!tagList.empty())
+        {
+            const size_t comma = tagList.find(',');
+            tags.emplace_back(tagList.substr(0, comma));
+            tagList.remove_prefix(comma == std::string_view::npos ? tagList.size() : comma + 1);
         }
-    }
 
-    static void SpriteComponent_GetColor(PaperID entityID, glm::vec4* outColor)
-    {
-        Scene* scene = ScriptEngine::GetSceneContext();
-        auto& sc = scene->GetEntity(entityID).GetComponent<SpriteComponent>();
-        *outColor = sc.color;
+        RunOrDefer([scene, entityID, tags = std::move(tags)]()
+        {
+            if (Entity entity = scene->GetEntity(entityID))
+                entity.SetTags(tags);
+        });
     }
 
-    static void SpriteComponent_SetColor(PaperID entityID, glm::vec4* inColor)
+    static void* SpriteComponent_GetData(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& sc = scene->GetEntity(entityID).GetComponent<SpriteComponent>();
-        sc.color = *inColor;
+        Entity entity = scene->GetEntity(entityID);
+        if (!entity || !entity.HasComponent<SpriteComponent>()) return nullptr;
+        return &entity.GetComponent<SpriteComponent>().color;
     }
 
     static void SpriteComponent_GetTexture(PaperID entityID, TextureData* outTextureData)
@@ -402,221 +714,515 @@ namespace Paper
 
     static void SpriteComponent_SetTexture(PaperID entityID, MonoString* inTextureFilePath)
     {
-        Scene* scene = ScriptEngine::GetSceneContext();
-        auto& sc = scene->GetEntity(entityID).GetComponent<SpriteComponent>();
-        sc.texture = DataPool::GetAssetTexture(ScriptUtils::MonoStringToStdString(inTextureFilePath), true);
+        RunOrDefer([entityID, filePath = ScriptUtils::MonoStringToStdString(inTextureFilePath)]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& sc = entity.GetComponent<SpriteComponent>();
+            sc.texture = AssetManager::LoadProjectTexture(filePath);
+        });
     }
 
-    static float SpriteComponent_GetTilingFactor(PaperID entityID)
+    static void LineComponent_GetColor(PaperID entityID, glm::vec4* outColor)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& sc = scene->GetEntity(entityID).GetComponent<SpriteComponent>();
-        return sc.tiling_factor;
+        auto& lc = scene->GetEntity(entityID).GetComponent<LineComponent>();
+        *outColor = lc.color;
     }
 
-    static void SpriteComponent_SetTilingFactor(PaperID entityID, float tilingFactor)
+    static void LineComponent_SetColor(PaperID entityID, glm::vec4* inColor)
     {
-        Scene* scene = ScriptEngine::GetSceneContext();
-        auto& sc = scene->GetEntity(entityID).GetComponent<SpriteComponent>();
-        sc.tiling_factor = tilingFactor;
+        RunOrDefer([entityID, color = *inColor]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& lc = entity.GetComponent<LineComponent>();
+            lc.color = color;
+        });
     }
 
-    static void SpriteComponent_GetUV0(PaperID entityID, glm::vec2* outUV0)
+    static float LineComponent_GetThickness(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& sc = scene->GetEntity(entityID).GetComponent<SpriteComponent>();
+        auto& lc = scene->GetEntity(entityID).GetComponent<LineComponent>();
 
-        *outUV0 = sc.tex_coords[0];
+        return lc.thickness;
     }
 
-    static void SpriteComponent_SetUV0(PaperID entityID, glm::vec2* inUV0)
+    static void LineComponent_SetThickness(PaperID entityID, float thickness)
     {
-        Scene* scene = ScriptEngine::GetSceneContext();
-        auto& sc = scene->GetEntity(entityID).GetComponent<SpriteComponent>();
+        RunOrDefer([entityID, thickness]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
 
-        sc.tex_coords[0] = *inUV0;
-        sc.tex_coords[1].y = (*inUV0).y;
-        sc.tex_coords[3].x = (*inUV0).x;
+            auto& lc = entity.GetComponent<LineComponent>();
+            lc.thickness = thickness;
+        });
     }
 
-    static void SpriteComponent_GetUV1(PaperID entityID, glm::vec2* outUV1)
+    static void TextComponent_GetColor(PaperID entityID, glm::vec4* outColor)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& sc = scene->GetEntity(entityID).GetComponent<SpriteComponent>();
+        auto& tc = scene->GetEntity(entityID).GetComponent<TextComponent>();
+        *outColor = tc.color;
+    }
 
-        *outUV1 = sc.tex_coords[2];
+    static void TextComponent_SetColor(PaperID entityID, glm::vec4* inColor)
+    {
+        RunOrDefer([entityID, color = *inColor]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& tc = entity.GetComponent<TextComponent>();
+            tc.color = color;
+        });
     }
 
-    static void SpriteComponent_SetUV1(PaperID entityID, glm::vec2* inUV1)
+    static MonoString* TextComponent_GetText(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& sc = scene->GetEntity(entityID).GetComponent<SpriteComponent>();
+        auto& tc = scene->GetEntity(entityID).GetComponent<TextComponent>();
+        return MONO_STRING(tc.text.c_str());
+    }
+
+    static void TextComponent_SetText(PaperID entityID, MonoString* text)
+    {
+        RunOrDefer([entityID, entityText = ScriptUtils::MonoStringToStdString(text)]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
 
-        sc.tex_coords[1].x = (*inUV1).x;
-        sc.tex_coords[2] = *inUV1;
-        sc.tex_coords[3].y = (*inUV1).y;
+            auto& tc = entity.GetComponent<TextComponent>();
+            tc.text = entityText;
+        });
     }
 
-    static int SpriteComponent_GetGeometry(PaperID entityID)
+    static MonoString* TextComponent_GetFontPath(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& sc = scene->GetEntity(entityID).GetComponent<SpriteComponent>();
+        auto& tc = scene->GetEntity(entityID).GetComponent<TextComponent>();
+        if (!tc.font)
+            return MONO_STRING("");
+        return MONO_STRING(tc.font->GetFilePath().c_str());
+    }
 
-        return (int)sc.geometry;
+    static void TextComponent_SetFontPath(PaperID entityID, MonoString* fontPath)
+    {
+        RunOrDefer([entityID, filePath = ScriptUtils::MonoStringToStdString(fontPath)]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& tc = entity.GetComponent<TextComponent>();
+            tc.font = AssetManager::LoadFont(filePath);
+        });
     }
 
-    static void SpriteComponent_SetGeometry(PaperID entityID, int geometry)
+    static float CameraComponent_GetFixedAspectRatio(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& sc = scene->GetEntity(entityID).GetComponent<SpriteComponent>();
+        auto& cc = scene->GetEntity(entityID).GetComponent<CameraComponent>();
+        return cc.fixedAspectRatio;
+    }
+
+    static void CameraComponent_SetFixedAspectRatio(PaperID entityID, bool fixedAspectRatio)
+    {
+        RunOrDefer([entityID, fixedAspectRatio]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
 
-        sc.geometry = (Geometry)geometry;
+            auto& cc = entity.GetComponent<CameraComponent>();
+            cc.fixedAspectRatio = fixedAspectRatio;
+        });
     }
 
-    static float SpriteComponent_GetThickness(PaperID entityID)
+    static float CameraComponent_GetPrimary(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& sc = scene->GetEntity(entityID).GetComponent<SpriteComponent>();
+        auto& cc = scene->GetEntity(entityID).GetComponent<CameraComponent>();
+        return cc.primary;
+    }
 
-        return sc.thickness;
+    static void CameraComponent_SetPrimary(PaperID entityID, bool primary)
+    {
+        RunOrDefer([entityID, primary]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& cc = entity.GetComponent<CameraComponent>();
+            cc.primary = primary;
+        });
     }
 
-    static void SpriteComponent_SetThickness(PaperID entityID, float thickness)
+    static MonoString* ScriptComponent_GetScriptClassName(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& sc = scene->GetEntity(entityID).GetComponent<SpriteComponent>();
+        auto& scrc = scene->GetEntity(entityID).GetComponent<ScriptComponent>();
+        return ScriptUtils::StdStringToMonoString(scrc.scriptClassName);
+    }
 
-        sc.thickness = thickness;
+    static void ScriptComponent_SetScriptClassName(PaperID entityID, MonoString* scriptClassName)
+    {
+        RunOrDefer([entityID, className = ScriptUtils::MonoStringToStdString(scriptClassName)]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            if (Entity entity = scene->GetEntity(entityID))
+                entity.GetComponent<ScriptComponent>().SetScriptClass(className);
+        });
     }
 
-    static float SpriteComponent_GetFade(PaperID entityID)
+    static int Rigidbody2DComponent_GetBodyType(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& sc = scene->GetEntity(entityID).GetComponent<SpriteComponent>();
+        auto& rb = scene->GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
 
-        return sc.fade;
+        return (int)rb.type;
     }
 
-    static void SpriteComponent_SetFade(PaperID entityID, float fade)
+    static void Rigidbody2DComponent_SetBodyType(PaperID entityID, int bodyType)
     {
-        Scene* scene = ScriptEngine::GetSceneContext();
-        auto& sc = scene->GetEntity(entityID).GetComponent<SpriteComponent>();
+        RunOrDefer([entityID, bodyType]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
 
-        sc.fade = fade;
+            auto& rb = entity.GetComponent<Rigidbody2DComponent>();
+            rb.type = (BodyType2D)bodyType;
+            rb.WakeUp();
+        });
     }
 
-    static void LineComponent_GetColor(PaperID entityID, glm::vec4* outColor)
+    static void Rigidbody2DComponent_GetVelocity(PaperID entityID, glm::vec2* outVelocity)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& lc = scene->GetEntity(entityID).GetComponent<LineComponent>();
-        *outColor = lc.color;
+        auto& rb = scene->GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+
+        *outVelocity = rb.velocity;
     }
 
-    static void LineComponent_SetColor(PaperID entityID, glm::vec4* inColor)
+    static void Rigidbody2DComponent_SetVelocity(PaperID entityID, glm::vec2* inVelocity)
     {
-        Scene* scene = ScriptEngine::GetSceneContext();
-        auto& lc = scene->GetEntity(entityID).GetComponent<LineComponent>();
-        lc.color = *inColor;
+        RunOrDefer([entityID, velocity = *inVelocity]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& rb = entity.GetComponent<Rigidbody2DComponent>();
+            rb.velocity = velocity;
+            rb.WakeUp();
+        });
     }
 
-    static float LineComponent_GetThickness(PaperID entityID)
+    static float Rigidbody2DComponent_GetMass(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& lc = scene->GetEntity(entityID).GetComponent<LineComponent>();
+        auto& rb = scene->GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
 
-        return lc.thickness;
+        return rb.mass;
     }
 
-    static void LineComponent_SetThickness(PaperID entityID, float thickness)
+    static void Rigidbody2DComponent_SetMass(PaperID entityID, float mass)
+    {
+        RunOrDefer([entityID, mass]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& rb = entity.GetComponent<Rigidbody2DComponent>();
+            rb.mass = mass;
+            rb.WakeUp();
+        });
+    }
+
+    static float Rigidbody2DComponent_GetGravityScale(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& lc = scene->GetEntity(entityID).GetComponent<LineComponent>();
+        auto& rb = scene->GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
 
-        lc.thickness = thickness;
+        return rb.gravityScale;
     }
 
-    static void TextComponent_GetColor(PaperID entityID, glm::vec4* outColor)
+    static void Rigidbody2DComponent_SetGravityScale(PaperID entityID, float gravityScale)
+    {
+        RunOrDefer([entityID, gravityScale]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& rb = entity.GetComponent<Rigidbody2DComponent>();
+            rb.gravityScale = gravityScale;
+            rb.WakeUp();
+        });
+    }
+
+    static float Rigidbody2DComponent_GetLinearDamping(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& tc = scene->GetEntity(entityID).GetComponent<TextComponent>();
-        *outColor = tc.color;
+        auto& rb = scene->GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+
+        return rb.linearDamping;
     }
 
-    static void TextComponent_SetColor(PaperID entityID, glm::vec4* inColor)
+    static void Rigidbody2DComponent_SetLinearDamping(PaperID entityID, float linearDamping)
+    {
+        RunOrDefer([entityID, linearDamping]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& rb = entity.GetComponent<Rigidbody2DComponent>();
+            rb.linearDamping = linearDamping;
+        });
+    }
+
+    static void Rigidbody2DComponent_ApplyForce(PaperID entityID, glm::vec2* force)
+    {
+        RunOrDefer([entityID, appliedForce = *force]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& rb = entity.GetComponent<Rigidbody2DComponent>();
+            rb.ApplyForce(appliedForce);
+        });
+    }
+
+    static void Rigidbody2DComponent_ApplyImpulse(PaperID entityID, glm::vec2* impulse)
+    {
+        RunOrDefer([entityID, appliedImpulse = *impulse]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& rb = entity.GetComponent<Rigidbody2DComponent>();
+            rb.ApplyImpulse(appliedImpulse);
+        });
+    }
+
+    static bool Rigidbody2DComponent_IsAwake(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& tc = scene->GetEntity(entityID).GetComponent<TextComponent>();
-        tc.color = *inColor;
+        auto& rb = scene->GetEntity(entityID).GetComponent<Rigidbody2DComponent>();
+
+        return rb.awake;
     }
 
-    static MonoString* TextComponent_GetText(PaperID entityID)
+    static void Rigidbody2DComponent_WakeUp(PaperID entityID)
+    {
+        RunOrDefer([entityID]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& rb = entity.GetComponent<Rigidbody2DComponent>();
+            rb.WakeUp();
+        });
+    }
+
+    static void BoxCollider2DComponent_GetOffset(PaperID entityID, glm::vec2* outOffset)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& tc = scene->GetEntity(entityID).GetComponent<TextComponent>();
-        return MONO_STRING(tc.text.c_str());
+        auto& bc = scene->GetEntity(entityID).GetComponent<BoxCollider2DComponent>();
+
+        *outOffset = bc.offset;
     }
 
-    static void TextComponent_SetText(PaperID entityID, MonoString* text)
+    static void BoxCollider2DComponent_SetOffset(PaperID entityID, glm::vec2* inOffset)
+    {
+        RunOrDefer([entityID, offset = *inOffset]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& bc = entity.GetComponent<BoxCollider2DComponent>();
+            bc.offset = offset;
+        });
+    }
+
+    static void BoxCollider2DComponent_GetSize(PaperID entityID, glm::vec2* outSize)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& tc = scene->GetEntity(entityID).GetComponent<TextComponent>();
-        tc.text = ScriptUtils::MonoStringToStdString(text);
+        auto& bc = scene->GetEntity(entityID).GetComponent<BoxCollider2DComponent>();
+
+        *outSize = bc.size;
     }
 
-    static MonoString* TextComponent_GetFontPath(PaperID entityID)
+    static void BoxCollider2DComponent_SetSize(PaperID entityID, glm::vec2* inSize)
+    {
+        RunOrDefer([entityID, size = *inSize]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& bc = entity.GetComponent<BoxCollider2DComponent>();
+            bc.size = size;
+        });
+    }
+
+    static float BoxCollider2DComponent_GetFriction(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& tc = scene->GetEntity(entityID).GetComponent<TextComponent>();
-        return MONO_STRING(tc.font->GetFilePath().c_str());
+        auto& bc = scene->GetEntity(entityID).GetComponent<BoxCollider2DComponent>();
+
+        return bc.friction;
     }
 
-    static void TextComponent_SetFontPath(PaperID entityID, MonoString* fontPath)
+    static void BoxCollider2DComponent_SetFriction(PaperID entityID, float friction)
+    {
+        RunOrDefer([entityID, friction]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& bc = entity.GetComponent<BoxCollider2DComponent>();
+            bc.friction = friction;
+        });
+    }
+
+    static float BoxCollider2DComponent_GetRestitution(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& tc = scene->GetEntity(entityID).GetComponent<TextComponent>();
-        tc.font = DataPool::GetFont(ScriptUtils::MonoStringToStdString(fontPath), true);
+        auto& bc = scene->GetEntity(entityID).GetComponent<BoxCollider2DComponent>();
+
+        return bc.restitution;
     }
 
-    static float CameraComponent_GetFixedAspectRatio(PaperID entityID)
+    static void BoxCollider2DComponent_SetRestitution(PaperID entityID, float restitution)
+    {
+        RunOrDefer([entityID, restitution]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& bc = entity.GetComponent<BoxCollider2DComponent>();
+            bc.restitution = restitution;
+        });
+    }
+
+    static void CircleCollider2DComponent_GetOffset(PaperID entityID, glm::vec2* outOffset)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& cc = scene->GetEntity(entityID).GetComponent<CameraComponent>();
-        return cc.fixedAspectRatio;
+        auto& cc = scene->GetEntity(entityID).GetComponent<CircleCollider2DComponent>();
+
+        *outOffset = cc.offset;
     }
 
-    static void CameraComponent_SetFixedAspectRatio(PaperID entityID, bool fixedAspectRatio)
+    static void CircleCollider2DComponent_SetOffset(PaperID entityID, glm::vec2* inOffset)
+    {
+        RunOrDefer([entityID, offset = *inOffset]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& cc = entity.GetComponent<CircleCollider2DComponent>();
+            cc.offset = offset;
+        });
+    }
+
+    static float CircleCollider2DComponent_GetRadius(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& cc = scene->GetEntity(entityID).GetComponent<CameraComponent>();
-        cc.fixedAspectRatio = fixedAspectRatio;
+        auto& cc = scene->GetEntity(entityID).GetComponent<CircleCollider2DComponent>();
+
+        return cc.radius;
     }
 
-    static float CameraComponent_GetPrimary(PaperID entityID)
+    static void CircleCollider2DComponent_SetRadius(PaperID entityID, float radius)
+    {
+        RunOrDefer([entityID, radius]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& cc = entity.GetComponent<CircleCollider2DComponent>();
+            cc.radius = radius;
+        });
+    }
+
+    static float CircleCollider2DComponent_GetFriction(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& cc = scene->GetEntity(entityID).GetComponent<CameraComponent>();
-        return cc.primary;
+        auto& cc = scene->GetEntity(entityID).GetComponent<CircleCollider2DComponent>();
+
+        return cc.friction;
     }
 
-    static void CameraComponent_SetPrimary(PaperID entityID, bool primary)
+    static void CircleCollider2DComponent_SetFriction(PaperID entityID, float friction)
+    {
+        RunOrDefer([entityID, friction]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& cc = entity.GetComponent<CircleCollider2DComponent>();
+            cc.friction = friction;
+        });
+    }
+
+    static float CircleCollider2DComponent_GetRestitution(PaperID entityID)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& cc = scene->GetEntity(entityID).GetComponent<CameraComponent>();
-        cc.primary = primary;
+        auto& cc = scene->GetEntity(entityID).GetComponent<CircleCollider2DComponent>();
+
+        return cc.restitution;
     }
 
-    static MonoString* ScriptComponent_GetScriptClassName(PaperID entityID)
+    static void CircleCollider2DComponent_SetRestitution(PaperID entityID, float restitution)
+    {
+        RunOrDefer([entityID, restitution]()
+        {
+            Scene* scene = ScriptEngine::GetSceneContext();
+            Entity entity = scene->GetEntity(entityID);
+            if (!entity) return;
+
+            auto& cc = entity.GetComponent<CircleCollider2DComponent>();
+            cc.restitution = restitution;
+        });
+    }
+
+    static void Physics2D_GetGravity(glm::vec2* outGravity)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& scrc = scene->GetEntity(entityID).GetComponent<ScriptComponent>();
-        return ScriptUtils::StdStringToMonoString(scrc.scriptClassName);
+        CORE_ASSERT(scene, "");
+
+        *outGravity = scene->GetPhysicsWorld().GetSettings().gravity;
     }
 
-    static void ScriptComponent_SetScriptClassName(PaperID entityID, MonoString* scriptClassName)
+    static void Physics2D_SetGravity(glm::vec2* inGravity)
     {
         Scene* scene = ScriptEngine::GetSceneContext();
-        auto& scrc = scene->GetEntity(entityID).GetComponent<ScriptComponent>();
-        scrc.scriptClassName = ScriptUtils::MonoStringToStdString(scriptClassName);
+        CORE_ASSERT(scene, "");
+
+        RunOrDefer([scene, gravity = *inGravity]() { scene->GetPhysicsWorld().GetSettings().gravity = gravity; });
     }
 
 	void ScriptGlue::RegisterFunctions()
@@ -631,6 +1237,17 @@ namespace Paper
         SCR_ADD_INTRERNAL_CALL(IsMouseButtonDown);
         SCR_ADD_INTRERNAL_CALL(IsMouseButtonReleased);
 
+        //Time
+        SCR_ADD_INTRERNAL_CALL(Time_GetDeltaTime);
+        SCR_ADD_INTRERNAL_CALL(Time_GetFrameDeltaTime);
+        SCR_ADD_INTRERNAL_CALL(Time_GetTime);
+        SCR_ADD_INTRERNAL_CALL(Time_GetTickTime);
+        SCR_ADD_INTRERNAL_CALL(Time_GetTick);
+        SCR_ADD_INTRERNAL_CALL(Time_GetFrameCount);
+        SCR_ADD_INTRERNAL_CALL(Time_GetTickRate);
+        SCR_ADD_INTRERNAL_CALL(Time_SetTickRate);
+        SCR_ADD_INTRERNAL_CALL(Time_GetInterpolationAlpha);
+
         //Render
         SCR_ADD_INTRERNAL_CALL(GetTexture);
         SCR_ADD_INTRERNAL_CALL(EntityCamera_GetPerspectiveFOV);
@@ -650,37 +1267,40 @@ namespace Paper
         //Entity
         SCR_ADD_INTRERNAL_CALL(Entity_HasComponent);
         SCR_ADD_INTRERNAL_CALL(Entity_GetEntityByName);
+        SCR_ADD_INTRERNAL_CALL(Entity_HasTag);
+        SCR_ADD_INTRERNAL_CALL(Entity_GetEntitiesWithTag);
         SCR_ADD_INTRERNAL_CALL(Entity_GetScriptInstance);
+        SCR_ADD_INTRERNAL_CALL(Entity_Destroy);
+        SCR_ADD_INTRERNAL_CALL(Scene_CreateEntity);
+        SCR_ADD_INTRERNAL_CALL(ScriptRuntime_RunBatches);
+        SCR_ADD_INTRERNAL_CALL(Tag_GetID);
+        SCR_ADD_INTRERNAL_CALL(Entity_HasTagID);
+        SCR_ADD_INTRERNAL_CALL(Entity_GetEntitiesWithTagID);
+        SCR_ADD_INTRERNAL_CALL(ScriptProfiler_IsEnabled);
+        SCR_ADD_INTRERNAL_CALL(ScriptProfiler_GetClassID);
+        SCR_ADD_INTRERNAL_CALL(ScriptProfiler_ReportUpdate);
+
+        //Spatial queries
+        SCR_ADD_INTRERNAL_CALL(Scene_QueryRegion);
+        SCR_ADD_INTRERNAL_CALL(Scene_QueryRadius);
+        SCR_ADD_INTRERNAL_CALL(Scene_QueryNearest);
+        SCR_ADD_INTRERNAL_CALL(Scene_Raycast);
+        SCR_ADD_INTRERNAL_CALL(Scene_RaycastAll);
+        SCR_ADD_INTRERNAL_CALL(Scene_QueryRegionBatch);
+        SCR_ADD_INTRERNAL_CALL(Scene_QueryRadiusBatch);
 
     	//Components
-        SCR_ADD_INTRERNAL_CALL(TransformComponent_GetPosition);
-        SCR_ADD_INTRERNAL_CALL(TransformComponent_SetPosition);
-        SCR_ADD_INTRERNAL_CALL(TransformComponent_GetRotation);
-        SCR_ADD_INTRERNAL_CALL(TransformComponent_SetRotation);
-        SCR_ADD_INTRERNAL_CALL(TransformComponent_GetScale);
-        SCR_ADD_INTRERNAL_CALL(TransformComponent_SetScale);
+        SCR_ADD_INTRERNAL_CALL(ComponentViews_GetVersion);
+        SCR_ADD_INTRERNAL_CALL(TransformComponent_GetData);
 
         SCR_ADD_INTRERNAL_CALL(DataComponent_GetName);
         SCR_ADD_INTRERNAL_CALL(DataComponent_SetName);
         SCR_ADD_INTRERNAL_CALL(DataComponent_GetTags);
         SCR_ADD_INTRERNAL_CALL(DataComponent_SetTags);
 
-    	SCR_ADD_INTRERNAL_CALL(SpriteComponent_GetColor);
-    	SCR_ADD_INTRERNAL_CALL(SpriteComponent_SetColor);
+    	SCR_ADD_INTRERNAL_CALL(SpriteComponent_GetData);
     	SCR_ADD_INTRERNAL_CALL(SpriteComponent_GetTexture);
     	SCR_ADD_INTRERNAL_CALL(SpriteComponent_SetTexture);
-    	SCR_ADD_INTRERNAL_CALL(SpriteComponent_GetTilingFactor);
-    	SCR_ADD_INTRERNAL_CALL(SpriteComponent_SetTilingFactor);
-    	SCR_ADD_INTRERNAL_CALL(SpriteComponent_GetUV0);
-    	SCR_ADD_INTRERNAL_CALL(SpriteComponent_SetUV0);
-    	SCR_ADD_INTRERNAL_CALL(SpriteComponent_GetUV1);
-    	SCR_ADD_INTRERNAL_CALL(SpriteComponent_SetUV1);
-    	SCR_ADD_INTRERNAL_CALL(SpriteComponent_GetGeometry);
-    	SCR_ADD_INTRERNAL_CALL(SpriteComponent_SetGeometry);
-    	SCR_ADD_INTRERNAL_CALL(SpriteComponent_GetThickness);
-    	SCR_ADD_INTRERNAL_CALL(SpriteComponent_SetThickness);
-    	SCR_ADD_INTRERNAL_CALL(SpriteComponent_GetFade);
-    	SCR_ADD_INTRERNAL_CALL(SpriteComponent_SetFade);
 
     	SCR_ADD_INTRERNAL_CALL(LineComponent_GetColor);
     	SCR_ADD_INTRERNAL_CALL(LineComponent_SetColor);
@@ -701,6 +1321,43 @@ namespace Paper
 
     	SCR_ADD_INTRERNAL_CALL(ScriptComponent_GetScriptClassName);
     	SCR_ADD_INTRERNAL_CALL(ScriptComponent_SetScriptClassName);
+
+    	SCR_ADD_INTRERNAL_CALL(Rigidbody2DComponent_GetBodyType);
+    	SCR_ADD_INTRERNAL_CALL(Rigidbody2DComponent_SetBodyType);
+    	SCR_ADD_INTRERNAL_CALL(Rigidbody2DComponent_GetVelocity);
+    	SCR_ADD_INTRERNAL_CALL(Rigidbody2DComponent_SetVelocity);
+    	SCR_ADD_INTRERNAL_CALL(Rigidbody2DComponent_GetMass);
+    	SCR_ADD_INTRERNAL_CALL(Rigidbody2DComponent_SetMass);
+    	SCR_ADD_INTRERNAL_CALL(Rigidbody2DComponent_GetGravityScale);
+    	SCR_ADD_INTRERNAL_CALL(Rigidbody2DComponent_SetGravityScale);
+    	SCR_ADD_INTRERNAL_CALL(Rigidbody2DComponent_GetLinearDamping);
+    	SCR_ADD_INTRERNAL_CALL(Rigidbody2DComponent_SetLinearDamping);
+    	SCR_ADD_INTRERNAL_CALL(Rigidbody2DComponent_ApplyForce);
+    	SCR_ADD_INTRERNAL_CALL(Rigidbody2DComponent_ApplyImpulse);
+    	SCR_ADD_INTRERNAL_CALL(Rigidbody2DComponent_IsAwake);
+    	SCR_ADD_INTRERNAL_CALL(Rigidbody2DComponent_WakeUp);
+
+    	SCR_ADD_INTRERNAL_CALL(BoxCollider2DComponent_GetOffset);
+    	SCR_ADD_INTRERNAL_CALL(BoxCollider2DComponent_SetOffset);
+    	SCR_ADD_INTRERNAL_CALL(BoxCollider2DComponent_GetSize);
+    	SCR_ADD_INTRERNAL_CALL(BoxCollider2DComponent_SetSize);
+    	SCR_ADD_INTRERNAL_CALL(BoxCollider2DComponent_GetFriction);
+    	SCR_ADD_INTRERNAL_CALL(BoxCollider2DComponent_SetFriction);
+    	SCR_ADD_INTRERNAL_CALL(BoxCollider2DComponent_GetRestitution);
+    	SCR_ADD_INTRERNAL_CALL(BoxCollider2DComponent_SetRestitution);
+
+    	SCR_ADD_INTRERNAL_CALL(CircleCollider2DComponent_GetOffset);
+    	SCR_ADD_INTRERNAL_CALL(CircleCollider2DComponent_SetOffset);
+    	SCR_ADD_INTRERNAL_CALL(CircleCollider2DComponent_GetRadius);
+    	SCR_ADD_INTRERNAL_CALL(CircleCollider2DComponent_SetRadius);
+    	SCR_ADD_INTRERNAL_CALL(CircleCollider2DComponent_GetFriction);
+    	SCR_ADD_INTRERNAL_CALL(CircleCollider2DComponent_SetFriction);
+    	SCR_ADD_INTRERNAL_CALL(CircleCollider2DComponent_GetRestitution);
+    	SCR_ADD_INTRERNAL_CALL(CircleCollider2DComponent_SetRestitution);
+
+        //Physics
+        SCR_ADD_INTRERNAL_CALL(Physics2D_GetGravity);
+        SCR_ADD_INTRERNAL_CALL(Physics2D_SetGravity);
 	}
 
     template<typename... Component>
@@ -0,0 +1,164 @@
+﻿#include "Engine.h"
+#include "ScriptJobs.h"
+
+#include <mono/metadata/object.h>
+#include <mono/metadata/threads.h>
+
+#include <condition_variable>
+
+namespace Paper
+{
+	struct ScriptJobsData
+	{
+		std::vector<std::thread> workers;
+		MonoDomain* domain = nullptr;
+
+		std::mutex mutex;
+		std::condition_variable wakeCondition;
+		std::condition_variable doneCondition;
+		bool running = false;
+		uint64_t generation = 0;
+		uint32_t pendingWorkers = 0;
+
+		//the run in flight, written before the workers are woken
+		ScriptJobs::RunBatchFn runBatch = nullptr;
+		uint32_t batchCount = 0;
+		std::atomic<uint32_t> nextBatch = 0;
+
+		//per batch, only touched by the thread running that batch until the merge
+		std::vector<std::vector<std::function<void()>>> commands;
+	};
+
+	static ScriptJobsData data;
+	static thread_local int32_t currentBatch = -1;
+
+	static void RunBatches()
+	{
+		for (uint32_t batch = data.nextBatch.fetch_add(1); batch < data.batchCount; batch = data.nextBatch.fetch_add(1))
+		{
+			currentBatch = (int32_t)batch;
+
+			//printed right away, a native copy of the exception would not be seen by the GC
+			MonoException* exception = nullptr;
+			data.runBatch((int32_t)batch, &exception);
+			if (exception)
+				mono_print_unhandled_exception((MonoObject*)exception);
+
+			currentBatch = -1;
+		}
+	}
+
+	static void WorkerLoop(uint32_t index, uint64_t generation)
+	{
+		mono_thread_attach(data.domain);
+		PAPER_PROFILE_THREAD(std::format("Script Worker {}", index));
+
+		std::unique_lock<std::mutex> lock(data.mutex);
+		while (true)
+		{
+			data.wakeCondition.wait(lock, [generation] { return !data.running || data.generation != generation; });
+			if (!data.running)
+				break;
+			generation = data.generation;
+
+			lock.unlock();
+			{
+				PAPER_PROFILE_SCOPE("ScriptJobs::RunBatches");
+				RunBatches();
+			}
+			lock.lock();
+
+			if (--data.pendingWorkers == 0)
+				data.doneCondition.notify_one();
+		}
+		lock.unlock();
+
+		mono_thread_detach(mono_thread_current());
+	}
+
+	static void StartWorkers(MonoDomain* domain)
+	{
+		data.domain = domain;
+		data.running = true;
+
+		//the main thread takes batches too
+		const uint32_t workerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+		for (uint32_t i = 0; i < workerCount; i++)
+			data.workers.emplace_back(WorkerLoop, i, data.generation);
+
+		LOG_CORE_TRACE("Started {} script workers", workerCount);
+	}
+
+	void ScriptJobs::Run(MonoDomain* domain, RunBatchFn runBatch, uint32_t batchCount)
+	{
+		if (!batchCount || !runBatch) return;
+
+		PAPER_PROFILE_FUNCTION();
+		CORE_ASSERT(!InBatch(), "script batches can't be nested");
+
+		if (data.running && data.domain != domain)
+			Shutdown();
+		if (!data.running)
+			StartWorkers(domain);
+
+		data.runBatch = runBatch;
+		data.batchCount = batchCount;
+		data.nextBatch.store(0);
+		if (data.commands.size() < batchCount)
+			data.commands.resize(batchCount);
+
+		{
+			std::scoped_lock<std::mutex> lock(data.mutex);
+			data.generation++;
+			data.pendingWorkers = (uint32_t)data.workers.size();
+		}
+		data.wakeCondition.notify_all();
+
+		RunBatches();
+
+		{
+			std::unique_lock<std::mutex> lock(data.mutex);
+			data.doneCondition.wait(lock, [] { return data.pendingWorkers == 0; });
+		}
+
+		PAPER_PROFILE_SCOPE("ScriptJobs::Merge");
+		for (uint32_t batch = 0; batch < batchCount; batch++)
+		{
+			for (const std::function<void()>& command : data.commands[batch])
+				command();
+			data.commands[batch].clear();
+		}
+	}
+
+	void ScriptJobs::Shutdown()
+	{
+		if (!data.running) return;
+
+		{
+			std::scoped_lock<std::mutex> lock(data.mutex);
+			data.running = false;
+		}
+		data.wakeCondition.notify_all();
+
+		for (std::thread& worker : data.workers)
+			worker.join();
+		data.workers.clear();
+		data.domain = nullptr;
+	}
+
+	bool ScriptJobs::InBatch()
+	{
+		return currentBatch >= 0;
+	}
+
+	void ScriptJobs::Defer(std::function<void()> command)
+	{
+		CORE_ASSERT(InBatch(), "only commands of a running batch are deferred");
+		data.commands[currentBatch].push_back(std::move(command));
+	}
+
+	uint32_t ScriptJobs::GetWorkerCount()
+	{
+		return (uint32_t)data.workers.size();
+	}
+}
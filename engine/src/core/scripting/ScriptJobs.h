@@ -0,0 +1,29 @@
+﻿#pragma once
+#include "Engine.h"
+#include "ManagedTypes.h"
+
+namespace Paper
+{
+	// Runs the OnUpdate batches of [ThreadSafe] scripts on worker threads attached to the script domain.
+	// Internal calls that change shared state are deferred while a batch runs and applied after the join,
+	// in batch order, so the outcome doesn't depend on which thread ran which batch.
+	class ScriptJobs
+	{
+	public:
+		using RunBatchFn = void(MONO_THUNK_CALL*)(int32_t batchIndex, MonoException** exception);
+
+		//runs every batch across the workers and the calling thread, returns once all of them and the
+		//deferred commands are done. Main thread only, the workers are (re)started for the domain on demand.
+		static void Run(MonoDomain* domain, RunBatchFn runBatch, uint32_t batchCount);
+
+		//detaches and joins the workers, has to happen before their domain is unloaded
+		static void Shutdown();
+
+		//true while the calling thread runs a batch
+		static bool InBatch();
+		//records a command of the running batch
+		static void Defer(std::function<void()> command);
+
+		static uint32_t GetWorkerCount();
+	};
+}
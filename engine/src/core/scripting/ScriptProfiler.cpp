@@ -0,0 +1,216 @@
+﻿#include "Engine.h"
+#include "ScriptProfiler.h"
+
+#include "ScriptCache.h"
+
+#include <iomanip>
+
+namespace Paper
+{
+	struct ClassFrame
+	{
+		std::array<ScriptCallbackStats, ScriptClassProfile::CALLBACK_COUNT> callbacks = {};
+		int64_t allocated = 0;
+		uint32_t exceptions = 0;
+	};
+
+	struct ScriptProfilerData
+	{
+		bool enabled = false;
+		uint32_t frames = 0;
+
+		std::unordered_map<CacheID, ScriptClassProfile> classProfiles;
+		//frame being recorded
+		std::unordered_map<CacheID, ClassFrame> classFrames;
+
+		FlatHashMap<PaperID, ScriptEntityProfile> entityProfiles;
+		FlatHashMap<PaperID, ScriptEntityProfile> entityFrames;
+	};
+
+	static ScriptProfilerData data;
+
+	const char* ScriptCallbackToString(ScriptCallback callback)
+	{
+		switch (callback)
+		{
+			case ScriptCallback::OnCreate: return "OnCreate";
+			case ScriptCallback::OnUpdate: return "OnUpdate";
+			case ScriptCallback::OnDestroy: return "OnDestroy";
+			default: return "Unknown";
+		}
+	}
+
+	float ScriptClassProfile::GetTime() const
+	{
+		float time = 0.0f;
+		for (const ScriptCallbackStats& stats : callbacks)
+			time += stats.time;
+		return time;
+	}
+
+	float ScriptClassProfile::GetAverageTime() const
+	{
+		if (!frames) return 0.0f;
+
+		float time = 0.0f;
+		for (const ScriptCallbackStats& stats : totalCallbacks)
+			time += stats.time;
+		return time / (float)frames;
+	}
+
+	void ScriptProfiler::SetEnabled(bool enabled)
+	{
+		data.enabled = enabled;
+	}
+
+	bool ScriptProfiler::IsEnabled()
+	{
+		return data.enabled;
+	}
+
+	void ScriptProfiler::NewFrame()
+	{
+		data.frames++;
+
+		for (auto& [classID, profile] : data.classProfiles)
+		{
+			const auto it = data.classFrames.find(classID);
+			const ClassFrame frame = it != data.classFrames.end() ? it->second : ClassFrame();
+
+			profile.callbacks = frame.callbacks;
+			profile.allocated = frame.allocated;
+			profile.exceptions = frame.exceptions;
+
+			for (uint32_t i = 0; i < ScriptClassProfile::CALLBACK_COUNT; i++)
+			{
+				profile.totalCallbacks[i].time += frame.callbacks[i].time;
+				profile.totalCallbacks[i].calls += frame.callbacks[i].calls;
+			}
+			profile.totalAllocated += frame.allocated;
+			profile.totalExceptions += frame.exceptions;
+			profile.frames++;
+
+			const float time = profile.GetTime();
+			profile.peakTime = std::max(profile.peakTime, time);
+			profile.history[profile.historyOffset] = time;
+			profile.historyOffset = (profile.historyOffset + 1) % ScriptClassProfile::HISTORY_SIZE;
+		}
+		data.classFrames.clear();
+
+		std::swap(data.entityProfiles, data.entityFrames);
+		data.entityFrames.clear();
+	}
+
+	void ScriptProfiler::Reset()
+	{
+		data.frames = 0;
+		data.classProfiles.clear();
+		data.classFrames.clear();
+		data.entityProfiles.clear();
+		data.entityFrames.clear();
+	}
+
+	void ScriptProfiler::RecordClass(CacheID classID, ScriptCallback callback, float time, uint32_t calls, int64_t allocated, uint32_t exceptions)
+	{
+		if (!data.enabled) return;
+
+		if (!data.classProfiles.contains(classID))
+		{
+			ScriptClassProfile& profile = data.classProfiles[classID];
+			profile.classID = classID;
+			const ManagedClass* managedClass = ScriptCache::GetManagedClass(classID);
+			profile.className = managedClass ? managedClass->fullClassName : fmt::format("<class {}>", classID);
+		}
+
+		ClassFrame& frame = data.classFrames[classID];
+		frame.callbacks[(uint32_t)callback].time += time;
+		frame.callbacks[(uint32_t)callback].calls += calls;
+		frame.allocated += allocated;
+		frame.exceptions += exceptions;
+	}
+
+	void ScriptProfiler::RecordEntity(PaperID entityID, CacheID classID, ScriptCallback callback, float time)
+	{
+		if (!data.enabled) return;
+
+		ScriptEntityProfile& profile = data.entityFrames[entityID];
+		profile.classID = classID;
+		profile.time[(uint32_t)callback] += time;
+	}
+
+	const std::unordered_map<CacheID, ScriptClassProfile>& ScriptProfiler::GetClassProfiles()
+	{
+		return data.classProfiles;
+	}
+
+	const FlatHashMap<PaperID, ScriptEntityProfile>& ScriptProfiler::GetEntityProfiles()
+	{
+		return data.entityProfiles;
+	}
+
+	uint32_t ScriptProfiler::GetFrameCount()
+	{
+		return data.frames;
+	}
+
+	static void WriteJsonString(std::ofstream& out, const std::string& string)
+	{
+		out << '"';
+		for (const char c : string)
+		{
+			if (c == '"' || c == '\\') out << '\\';
+			if ((unsigned char)c >= 0x20) out << c;
+		}
+		out << '"';
+	}
+
+	bool ScriptProfiler::ExportJson(const std::filesystem::path& filePath)
+	{
+		std::ofstream out(filePath);
+		if (!out)
+		{
+			LOG_CORE_ERROR("Could not write script profile to '{}'", filePath.string());
+			return false;
+		}
+
+		//times are in ms, totals cover every frame since the last reset
+		out << std::fixed << std::setprecision(4);
+		out << "{\n\"frames\":" << data.frames << ",\n\"classes\":[";
+
+		bool first = true;
+		for (const ScriptClassProfile& profile : data.classProfiles | std::views::values)
+		{
+			out << (first ? "\n" : ",\n");
+			first = false;
+
+			out << "{\"name\":";
+			WriteJsonString(out, profile.className);
+			out << ",\"averageMs\":" << profile.GetAverageTime() << ",\"peakMs\":" << profile.peakTime;
+			for (uint32_t i = 0; i < ScriptClassProfile::CALLBACK_COUNT; i++)
+			{
+				out << ",\"" << ScriptCallbackToString((ScriptCallback)i) << "\":{\"totalMs\":" << profile.totalCallbacks[i].time
+					<< ",\"calls\":" << profile.totalCallbacks[i].calls << "}";
+			}
+			out << ",\"allocatedBytes\":" << profile.totalAllocated << ",\"exceptions\":" << profile.totalExceptions << "}";
+		}
+
+		out << "\n],\n\"entities\":[";
+		first = true;
+		for (const auto& [entityID, profile] : data.entityProfiles)
+		{
+			out << (first ? "\n" : ",\n");
+			first = false;
+
+			out << "{\"id\":\"" << entityID.toString() << "\",\"class\":";
+			const auto it = data.classProfiles.find(profile.classID);
+			WriteJsonString(out, it != data.classProfiles.end() ? it->second.className : "");
+			for (uint32_t i = 0; i < ScriptClassProfile::CALLBACK_COUNT; i++)
+				out << ",\"" << ScriptCallbackToString((ScriptCallback)i) << "Ms\":" << profile.time[i];
+			out << "}";
+		}
+		out << "\n]\n}\n";
+
+		LOG_CORE_TRACE("Exported script profile of {} frames to '{}'", data.frames, filePath.string());
+		return true;
+	}
+}
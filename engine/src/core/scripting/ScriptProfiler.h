@@ -0,0 +1,85 @@
+﻿#pragma once
+#include "Engine.h"
+#include "ManagedTypes.h"
+
+#include "utils/FlatHashMap.h"
+#include "utils/PaperID.h"
+
+#include <array>
+
+namespace Paper
+{
+	enum class ScriptCallback : uint8_t
+	{
+		OnCreate,
+		OnUpdate,
+		OnDestroy,
+
+		Count
+	};
+
+	const char* ScriptCallbackToString(ScriptCallback callback);
+
+	struct ScriptCallbackStats
+	{
+		float time = 0.0f; //ms
+		uint32_t calls = 0;
+	};
+
+	struct ScriptClassProfile
+	{
+		static constexpr uint32_t HISTORY_SIZE = 240;
+		static constexpr uint32_t CALLBACK_COUNT = (uint32_t)ScriptCallback::Count;
+
+		CacheID classID = 0;
+		std::string className;
+
+		//last finished frame
+		std::array<ScriptCallbackStats, CALLBACK_COUNT> callbacks = {};
+		int64_t allocated = 0; //bytes the callbacks added to the managed heap
+		uint32_t exceptions = 0;
+
+		//since the last reset
+		std::array<ScriptCallbackStats, CALLBACK_COUNT> totalCallbacks = {};
+		int64_t totalAllocated = 0;
+		uint32_t totalExceptions = 0;
+		float peakTime = 0.0f;
+		uint32_t frames = 0;
+
+		//ms of all callbacks per frame
+		std::array<float, HISTORY_SIZE> history = {};
+		uint32_t historyOffset = 0;
+
+		float GetTime() const;
+		float GetAverageTime() const;
+	};
+
+	struct ScriptEntityProfile
+	{
+		CacheID classID = 0;
+		std::array<float, ScriptClassProfile::CALLBACK_COUNT> time = {}; //ms, last finished frame
+	};
+
+	// Times the script callbacks per class and per entity. OnCreate and OnDestroy are measured around the thunk calls,
+	// OnUpdate is measured by Paper.ScriptRuntime and reported once per class and frame.
+	class ScriptProfiler
+	{
+	public:
+		static void SetEnabled(bool enabled);
+		static bool IsEnabled();
+
+		//closes the frame that was being recorded, the getters return it until the next call
+		static void NewFrame();
+		static void Reset();
+
+		static void RecordClass(CacheID classID, ScriptCallback callback, float time, uint32_t calls, int64_t allocated, uint32_t exceptions);
+		static void RecordEntity(PaperID entityID, CacheID classID, ScriptCallback callback, float time);
+
+		static const std::unordered_map<CacheID, ScriptClassProfile>& GetClassProfiles();
+		static const FlatHashMap<PaperID, ScriptEntityProfile>& GetEntityProfiles();
+		static uint32_t GetFrameCount();
+
+		//per class totals and the last frame of every entity, for benchmark runs
+		static bool ExportJson(const std::filesystem::path& filePath);
+	};
+}
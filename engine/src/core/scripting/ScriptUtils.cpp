@@ -14,6 +14,12 @@
 #include <mono/metadata/object.h>
 #include <mono/metadata/mono-debug.h>
 
+#ifndef CORE_PLATFORM_WINDOWS
+    #include <signal.h>
+    #include <sys/wait.h>
+    #include <unistd.h>
+#endif
+
 namespace Paper
 {
     std::unordered_map<std::string, ScriptFieldType> scriptFieldTypeMap {
@@ -47,13 +53,25 @@ namespace Paper
 
 
     MonoAssembly* ScriptUtils::LoadMonoAssembly(const std::filesystem::path& assemblyPath, bool loadPDB)
+    {
+        return LoadMonoAssembly(OpenMonoImage(assemblyPath, loadPDB), assemblyPath);
+    }
+
+    MonoImage* ScriptUtils::OpenMonoImage(const std::filesystem::path& assemblyPath, bool loadPDB)
     {
         uint32_t fileSize = 0;
         char* fileData = Utils::ReadBytes(assemblyPath, &fileSize);
+        if (!fileData)
+        {
+            LOG_CORE_ERROR("[SCRIPTCORE]: Could not read assembly file '{}'", assemblyPath);
+            return nullptr;
+        }
 
         // NOTE: We can't use this image for anything other than loading the assembly because this image doesn't have a reference to the assembly
+        //the image copies the data (need_copy = 1), it is named after the file so mono finds the AOT image next to it
         MonoImageOpenStatus status;
-        MonoImage* image = mono_image_open_from_data_full(fileData, fileSize, 1, &status, 0);
+        MonoImage* image = mono_image_open_from_data_with_name(fileData, fileSize, 1, &status, 0, assemblyPath.string().c_str());
+        delete[] fileData;
 
         if (status != MONO_IMAGE_OK)
         {
@@ -63,7 +81,7 @@ namespace Paper
         }
         LOG_CORE_TRACE("Loaded assembly file: {}", assemblyPath);
 
-        if (loadPDB)
+        if (loadPDB && ScriptEngine::GetRuntimeMode() == ScriptRuntimeMode::Debug)
         {
             std::filesystem::path pdbPath = assemblyPath;
             pdbPath.replace_extension(".pdb");
@@ -80,14 +98,174 @@ namespace Paper
                 LOG_CORE_WARN("Could not find PDB file for assembly: '{}'", assemblyPath);
         }
 
+        return image;
+    }
+
+    MonoAssembly* ScriptUtils::LoadMonoAssembly(MonoImage* image, const std::filesystem::path& assemblyPath)
+    {
+        if (!image) return nullptr;
+
+        MonoImageOpenStatus status;
         MonoAssembly* assembly = mono_assembly_load_from_full(image, assemblyPath.string().c_str(), &status, 0);
         mono_image_close(image);
 
-        delete[] fileData;
-
         return assembly;
     }
 
+    std::filesystem::path ScriptUtils::GetAotImagePath(const std::filesystem::path& assemblyPath)
+    {
+#ifdef CORE_PLATFORM_WINDOWS
+        return assemblyPath.string() + ".dll";
+#else
+        return assemblyPath.string() + ".so";
+#endif
+    }
+
+    //holds the write time of the assembly an image was compiled from. The image's own write time can't tell,
+    //an assembly rebuilt while the compiler still reads the old one ends up older than the image.
+    static std::filesystem::path GetAotSourceStampPath(const std::filesystem::path& assemblyPath)
+    {
+        return ScriptUtils::GetAotImagePath(assemblyPath).string() + ".source";
+    }
+
+    static bool ReadAssemblyStamp(const std::filesystem::path& assemblyPath, int64_t& stamp)
+    {
+        std::error_code error;
+        const auto writeTime = std::filesystem::last_write_time(assemblyPath, error);
+        if (error) return false;
+
+        stamp = (int64_t)writeTime.time_since_epoch().count();
+        return true;
+    }
+
+    bool ScriptUtils::IsAotImageCurrent(const std::filesystem::path& assemblyPath)
+    {
+        if (!std::filesystem::exists(GetAotImagePath(assemblyPath))) return false;
+
+        int64_t assemblyStamp = 0;
+        if (!ReadAssemblyStamp(assemblyPath, assemblyStamp)) return false;
+
+        int64_t imageStamp = 0;
+        std::ifstream stampFile(GetAotSourceStampPath(assemblyPath));
+        return (stampFile >> imageStamp) && imageStamp == assemblyStamp;
+    }
+
+    //runs the compiler as a child process and kills it once cancelled is set, true when it exited with 0
+    static bool RunAotCompiler(const std::filesystem::path& compilerPath, const std::vector<std::string>& args, const std::atomic<bool>& cancelled)
+    {
+#ifdef CORE_PLATFORM_WINDOWS
+        std::string commandLine = "\"" + compilerPath.string() + "\"";
+        for (const std::string& arg : args)
+            commandLine += " \"" + arg + "\"";
+
+        STARTUPINFOA startupInfo = {};
+        startupInfo.cb = sizeof(startupInfo);
+        PROCESS_INFORMATION processInfo = {};
+        if (!CreateProcessA(nullptr, commandLine.data(), nullptr, nullptr, FALSE, 0, nullptr, nullptr, &startupInfo, &processInfo))
+            return false;
+
+        while (WaitForSingleObject(processInfo.hProcess, 100) == WAIT_TIMEOUT)
+        {
+            if (cancelled.load(std::memory_order_relaxed))
+            {
+                TerminateProcess(processInfo.hProcess, 1);
+                WaitForSingleObject(processInfo.hProcess, INFINITE);
+                break;
+            }
+        }
+
+        DWORD exitCode = 1;
+        GetExitCodeProcess(processInfo.hProcess, &exitCode);
+        CloseHandle(processInfo.hThread);
+        CloseHandle(processInfo.hProcess);
+        return exitCode == 0 && !cancelled.load(std::memory_order_relaxed);
+#else
+        //built before the fork, the child only calls execv
+        std::string compiler = compilerPath.string();
+        std::vector<char*> argv = { compiler.data() };
+        for (const std::string& arg : args)
+            argv.push_back(const_cast<char*>(arg.c_str()));
+        argv.push_back(nullptr);
+
+        const pid_t pid = fork();
+        if (pid < 0) return false;
+        if (pid == 0)
+        {
+            execv(compiler.c_str(), argv.data());
+            _exit(127);
+        }
+
+        int status = 0;
+        while (waitpid(pid, &status, WNOHANG) == 0)
+        {
+            if (cancelled.load(std::memory_order_relaxed))
+            {
+                kill(pid, SIGKILL);
+                waitpid(pid, &status, 0);
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+        return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+#endif
+    }
+
+    bool ScriptUtils::CompileAotImage(const std::filesystem::path& assemblyPath, const std::atomic<bool>& cancelled, bool useLLVM)
+    {
+#ifdef CORE_PLATFORM_WINDOWS
+        const std::filesystem::path compilerPath = "mono/bin/mono.exe";
+#else
+        const std::filesystem::path compilerPath = "mono/bin/mono";
+#endif
+        if (!std::filesystem::exists(compilerPath))
+        {
+            LOG_CORE_WARN("Could not find the mono AOT compiler '{}', '{}' will be JIT compiled", compilerPath, assemblyPath);
+            return false;
+        }
+
+        int64_t sourceStamp = 0;
+        if (!ReadAssemblyStamp(assemblyPath, sourceStamp)) return false;
+
+        //written next to the image and moved over it once complete, a compile cut short never leaves a broken image.
+        //the name is unique so a second editor compiling the same assembly doesn't write into the same file.
+        const std::filesystem::path aotImagePath = GetAotImagePath(assemblyPath);
+        const std::filesystem::path partialPath = fmt::format("{}.{:016x}.partial", aotImagePath.string(), PaperID().toUInt64());
+
+        const auto compile = [&](bool llvm)
+        {
+            const std::string aotOption = fmt::format("--aot=outfile={}{}", partialPath.string(), llvm ? ",llvm" : "");
+            return RunAotCompiler(compilerPath, { aotOption, assemblyPath.string() }, cancelled);
+        };
+
+        std::error_code error;
+
+        //llvm needs an llvm enabled mono build, the regular backend always works
+        if ((useLLVM && compile(true)) || (!cancelled.load(std::memory_order_relaxed) && compile(false)))
+        {
+            int64_t currentStamp = 0;
+            if (!ReadAssemblyStamp(assemblyPath, currentStamp) || currentStamp != sourceStamp)
+            {
+                std::filesystem::remove(partialPath, error);
+                LOG_CORE_TRACE("Assembly '{}' changed while its AOT image was compiled, it is compiled again on the next reload", assemblyPath);
+                return false;
+            }
+
+            std::filesystem::rename(partialPath, aotImagePath, error);
+            if (!error)
+            {
+                std::ofstream(GetAotSourceStampPath(assemblyPath), std::ios::trunc) << sourceStamp;
+                LOG_CORE_TRACE("Compiled AOT image for assembly '{}'", assemblyPath);
+                return true;
+            }
+        }
+
+        std::filesystem::remove(partialPath, error);
+        if (cancelled.load(std::memory_order_relaxed)) return false;
+
+        LOG_CORE_ERROR("Could not compile AOT image for assembly '{}'", assemblyPath);
+        return false;
+    }
+
     void ScriptUtils::PrintAssemblyTypes(MonoAssembly* assembly)
     {
         MonoImage* image = mono_assembly_get_image(assembly);
@@ -113,6 +291,47 @@ namespace Paper
         return MonoCharPtrToStdString(text);
     }
 
+    std::string_view ScriptUtils::MonoStringToFrameString(MonoString* monoString)
+    {
+        if (!monoString) return {};
+
+        const mono_unichar2* chars = mono_string_chars(monoString);
+        const int length = mono_string_length(monoString);
+
+        //a utf16 unit never takes more than 3 utf8 bytes (surrogate pairs take 4 for 2 units)
+        char* text = FrameArena::Allocate<char>(length * 3 + 1);
+        size_t size = 0;
+        for (int i = 0; i < length; i++)
+        {
+            uint32_t c = chars[i];
+            if (c >= 0xD800 && c <= 0xDBFF && i + 1 < length && chars[i + 1] >= 0xDC00 && chars[i + 1] <= 0xDFFF)
+                c = 0x10000 + ((c - 0xD800) << 10) + (chars[++i] - 0xDC00);
+
+            if (c < 0x80)
+                text[size++] = (char)c;
+            else if (c < 0x800)
+            {
+                text[size++] = (char)(0xC0 | (c >> 6));
+                text[size++] = (char)(0x80 | (c & 0x3F));
+            }
+            else if (c < 0x10000)
+            {
+                text[size++] = (char)(0xE0 | (c >> 12));
+                text[size++] = (char)(0x80 | ((c >> 6) & 0x3F));
+                text[size++] = (char)(0x80 | (c & 0x3F));
+            }
+            else
+            {
+                text[size++] = (char)(0xF0 | (c >> 18));
+                text[size++] = (char)(0x80 | ((c >> 12) & 0x3F));
+                text[size++] = (char)(0x80 | ((c >> 6) & 0x3F));
+                text[size++] = (char)(0x80 | (c & 0x3F));
+            }
+        }
+        text[size] = '\0';
+        return std::string_view(text, size);
+    }
+
     std::string ScriptUtils::MonoCharPtrToStdString(char* monoCharPtr)
     {
         if (!monoCharPtr) return "";
@@ -145,6 +364,17 @@ namespace Paper
         }
     }
 
+    bool ScriptUtils::IsBlittable(ScriptFieldType type)
+    {
+        switch (type) {
+            case ScriptFieldType::Vec2:
+            case ScriptFieldType::Vec3:
+            case ScriptFieldType::Vec4:
+                return true;
+            default: return IsPrimitive(type);
+        }
+    }
+
     uint32_t ScriptUtils::ScriptFieldTypeSize(ScriptFieldType type)
     {
         switch (type)
@@ -476,4 +706,61 @@ namespace Paper
             mono_field_set_value(object, classField, fieldData);
         }
     }
+
+    Buffer ScriptUtils::GetFieldValue(MonoObject* object, const ManagedField& managedField)
+    {
+        CORE_ASSERT(object, "");
+        if (!object) return {};
+
+        if (managedField.isProperty)
+        {
+            if (!managedField.monoProperty) return {};
+
+            MonoObject* exc = nullptr;
+            MonoObject* valueObject = mono_property_get_value(managedField.monoProperty, object, nullptr, &exc);
+            if (exc)
+            {
+                mono_print_unhandled_exception(exc);
+                return {};
+            }
+            return MonoObjectToValue(managedField.fieldType, valueObject);
+        }
+
+        if (!managedField.monoField) return {};
+
+        //value types are copied straight out of the object, no boxing
+        if (IsBlittable(managedField.fieldType) && !managedField.isStatic)
+        {
+            Buffer outBuffer;
+            outBuffer.Allocate(std::max(ScriptFieldTypeSize(managedField.fieldType), managedField.monoFieldSize));
+            outBuffer.Nullify();
+            mono_field_get_value(object, managedField.monoField, outBuffer.data);
+            return outBuffer;
+        }
+
+        return MonoObjectToValue(managedField.fieldType, mono_field_get_value_object(mono_domain_get(), managedField.monoField, object));
+    }
+
+    void ScriptUtils::SetFieldValue(MonoObject* object, const ManagedField& managedField, const void* data)
+    {
+        if (object == nullptr || data == nullptr)
+            return;
+
+        //value types are passed by address, everything else as an object
+        void* value = IsBlittable(managedField.fieldType) ? (void*)data : DataToMonoObject(managedField.fieldType, data);
+
+        if (managedField.isProperty)
+        {
+            if (!managedField.monoProperty) return;
+
+            MonoObject* exc = nullptr;
+            mono_property_set_value(managedField.monoProperty, object, &value, &exc);
+            if (exc)
+                mono_print_unhandled_exception(exc);
+        }
+        else if (managedField.monoField)
+        {
+            mono_field_set_value(object, managedField.monoField, value);
+        }
+    }
 }
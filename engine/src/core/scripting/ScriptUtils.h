@@ -9,13 +9,28 @@ namespace Paper
     {
     public:
         static MonoAssembly* LoadMonoAssembly(const std::filesystem::path& assemblyPath, bool loadPDB = false);
+        //reads the file and its pdb into an image that is not bound to a domain yet, safe on an attached worker thread
+        static MonoImage* OpenMonoImage(const std::filesystem::path& assemblyPath, bool loadPDB = false);
+        //loads an image from OpenMonoImage into the current domain and closes it
+        static MonoAssembly* LoadMonoAssembly(MonoImage* image, const std::filesystem::path& assemblyPath);
+
+        //native image mono looks for next to the assembly when AOT is enabled
+        static std::filesystem::path GetAotImagePath(const std::filesystem::path& assemblyPath);
+        //compares the assembly with the write time recorded when its image was compiled
+        static bool IsAotImageCurrent(const std::filesystem::path& assemblyPath);
+        //runs the mono aot compiler and blocks until it is done, setting cancelled kills the compiler
+        static bool CompileAotImage(const std::filesystem::path& assemblyPath, const std::atomic<bool>& cancelled, bool useLLVM = true);
         static void PrintAssemblyTypes(MonoAssembly* assembly);
 
         static std::string MonoStringToStdString(MonoString* monoString);
+        //utf8 copy in the frame arena, skips the mono allocation for strings that are only looked at
+        static std::string_view MonoStringToFrameString(MonoString* monoString);
         static std::string MonoCharPtrToStdString(char* monoCharPtr);
         static MonoString* StdStringToMonoString(const std::string& stdString);
 
         static bool IsPrimitive(ScriptFieldType type);
+        //stored inline in managed objects with the same layout as natively
+        static bool IsBlittable(ScriptFieldType type);
         static uint32_t ScriptFieldTypeSize(ScriptFieldType type);
         static std::string ScriptFieldTypeToString(ScriptFieldType type);
         static ScriptFieldType MonoTypeToScriptFieldType(MonoType* monoType);
@@ -29,5 +44,9 @@ namespace Paper
 
         static Buffer GetFieldValue(MonoObject* object, std::string_view fieldName, ScriptFieldType type, bool isProperty);
         static void SetFieldValue(MonoObject* object, const std::string& fieldName, ScriptFieldType type, bool isProperty, const void* data, ManagedClass* baseClass = nullptr);
+
+        //use the handles cached in the ManagedField instead of looking the member up by name
+        static Buffer GetFieldValue(MonoObject* object, const ManagedField& managedField);
+        static void SetFieldValue(MonoObject* object, const ManagedField& managedField, const void* data);
     };
 }
\ No newline at end of file
@@ -0,0 +1,438 @@
+#pragma once
+#include "Engine.h"
+
+#include <bit>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define PAPER_FLAT_HASH_MAP_SSE2
+	#include <emmintrin.h>
+#endif
+
+namespace Paper
+{
+	// splitmix64 finalizer on top of std::hash, PaperID and entt::entity hash to themselves
+	struct FlatHash
+	{
+		template <typename T>
+		size_t operator()(const T& key) const
+		{
+			uint64_t x = (uint64_t)std::hash<T>()(key);
+			x ^= x >> 30;
+			x *= 0xbf58476d1ce4e5b9ull;
+			x ^= x >> 27;
+			x *= 0x94d049bb133111ebull;
+			x ^= x >> 31;
+			return (size_t)x;
+		}
+	};
+
+	// Open addressing map with one control byte per slot, probed 16 slots at a time.
+	// Rehashing moves elements: pointers and references into the map do not survive an insert.
+	template <typename Key, typename Value, typename Hasher = FlatHash, typename KeyEqual = std::equal_to<Key>>
+	class FlatHashMap
+	{
+	public:
+		using value_type = std::pair<Key, Value>;
+
+	private:
+		static constexpr size_t GROUP_WIDTH = 16;
+
+		static constexpr int8_t CTRL_EMPTY = -128;
+		static constexpr int8_t CTRL_DELETED = -2;
+
+		struct Group
+		{
+#ifdef PAPER_FLAT_HASH_MAP_SSE2
+			explicit Group(const int8_t* pos) : ctrl(_mm_loadu_si128((const __m128i*)pos)) {}
+
+			uint32_t Match(int8_t h2) const { return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl)); }
+			uint32_t MatchEmpty() const { return Match(CTRL_EMPTY); }
+			//empty and deleted are the only control bytes with the sign bit set
+			uint32_t MatchFree() const { return (uint32_t)_mm_movemask_epi8(ctrl); }
+
+			__m128i ctrl;
+#else
+			explicit Group(const int8_t* pos) : ctrl(pos) {}
+
+			uint32_t Match(int8_t h2) const
+			{
+				uint32_t mask = 0;
+				for (uint32_t i = 0; i < GROUP_WIDTH; ++i)
+					mask |= (uint32_t)(ctrl[i] == h2) << i;
+				return mask;
+			}
+			uint32_t MatchEmpty() const { return Match(CTRL_EMPTY); }
+			uint32_t MatchFree() const
+			{
+				uint32_t mask = 0;
+				for (uint32_t i = 0; i < GROUP_WIDTH; ++i)
+					mask |= (uint32_t)(ctrl[i] < 0) << i;
+				return mask;
+			}
+
+			const int8_t* ctrl;
+#endif
+		};
+
+		template <bool IsConst>
+		class Iterator
+		{
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = FlatHashMap::value_type;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+			using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+			using MapPtr = std::conditional_t<IsConst, const FlatHashMap*, FlatHashMap*>;
+
+			Iterator() = default;
+			Iterator(MapPtr map, size_t index) : map(map), index(index) { SkipFree(); }
+			operator Iterator<true>() const { return Iterator<true>(map, index); }
+
+			reference operator*() const { return map->slots[index]; }
+			pointer operator->() const { return &map->slots[index]; }
+
+			Iterator& operator++() { ++index; SkipFree(); return *this; }
+			Iterator operator++(int) { Iterator tmp = *this; ++*this; return tmp; }
+
+			bool operator==(const Iterator& other) const { return index == other.index; }
+			bool operator!=(const Iterator& other) const { return index != other.index; }
+
+		private:
+			void SkipFree()
+			{
+				while (index < map->capacity && map->ctrl[index] < 0)
+					++index;
+			}
+
+			MapPtr map = nullptr;
+			size_t index = 0;
+
+			friend class FlatHashMap;
+		};
+
+	public:
+		using iterator = Iterator<false>;
+		using const_iterator = Iterator<true>;
+
+		FlatHashMap() = default;
+
+		FlatHashMap(const FlatHashMap& other)
+		{
+			CopyFrom(other);
+		}
+
+		FlatHashMap(FlatHashMap&& other) noexcept
+		{
+			Swap(other);
+		}
+
+		FlatHashMap& operator=(const FlatHashMap& other)
+		{
+			if (this != &other)
+			{
+				Release();
+				CopyFrom(other);
+			}
+			return *this;
+		}
+
+		FlatHashMap& operator=(FlatHashMap&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Release();
+				Swap(other);
+			}
+			return *this;
+		}
+
+		~FlatHashMap()
+		{
+			Release();
+		}
+
+		iterator begin() { return iterator(this, 0); }
+		iterator end() { return iterator(this, capacity); }
+		const_iterator begin() const { return const_iterator(this, 0); }
+		const_iterator end() const { return const_iterator(this, capacity); }
+
+		size_t size() const { return count; }
+		bool empty() const { return count == 0; }
+
+		void clear()
+		{
+			for (size_t i = 0; i < capacity; ++i)
+			{
+				if (ctrl[i] >= 0)
+					std::destroy_at(&slots[i]);
+			}
+			std::fill_n(ctrl, capacity, CTRL_EMPTY);
+			count = 0;
+			deleted = 0;
+		}
+
+		void reserve(size_t elementCount)
+		{
+			const size_t newCapacity = CapacityFor(elementCount);
+			if (newCapacity > capacity)
+				Rehash(newCapacity);
+		}
+
+		iterator find(const Key& key)
+		{
+			return iterator(this, FindIndex(key));
+		}
+
+		const_iterator find(const Key& key) const
+		{
+			return const_iterator(this, FindIndex(key));
+		}
+
+		bool contains(const Key& key) const
+		{
+			return FindIndex(key) != capacity;
+		}
+
+		Value& at(const Key& key)
+		{
+			const size_t index = FindIndex(key);
+			if (index == capacity)
+				throw std::out_of_range("FlatHashMap::at");
+			return slots[index].second;
+		}
+
+		const Value& at(const Key& key) const
+		{
+			const size_t index = FindIndex(key);
+			if (index == capacity)
+				throw std::out_of_range("FlatHashMap::at");
+			return slots[index].second;
+		}
+
+		Value& operator[](const Key& key)
+		{
+			return try_emplace(key).first->second;
+		}
+
+		template <typename... Args>
+		std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args)
+		{
+			const size_t hash = Hasher()(key);
+			size_t index = FindIndex(key, hash);
+			if (index != capacity)
+				return { iterator(this, index), false };
+
+			index = PrepareInsert(hash);
+			std::construct_at(&slots[index], std::piecewise_construct, std::forward_as_tuple(key), std::forward_as_tuple(std::forward<Args>(args)...));
+			return { iterator(this, index), true };
+		}
+
+		template <typename V>
+		std::pair<iterator, bool> insert_or_assign(const Key& key, V&& value)
+		{
+			auto result = try_emplace(key, std::forward<V>(value));
+			if (!result.second)
+				result.first->second = std::forward<V>(value);
+			return result;
+		}
+
+		std::pair<iterator, bool> insert(const value_type& value)
+		{
+			return try_emplace(value.first, value.second);
+		}
+
+		size_t erase(const Key& key)
+		{
+			const size_t index = FindIndex(key);
+			if (index == capacity)
+				return 0;
+			EraseIndex(index);
+			return 1;
+		}
+
+		iterator erase(const_iterator it)
+		{
+			EraseIndex(it.index);
+			return iterator(this, it.index + 1);
+		}
+
+	private:
+		static constexpr size_t MaxLoad(size_t cap) { return cap - cap / 8; }
+
+		static size_t CapacityFor(size_t elementCount)
+		{
+			size_t cap = GROUP_WIDTH;
+			while (MaxLoad(cap) < elementCount)
+				cap *= 2;
+			return cap;
+		}
+
+		static int8_t H2(size_t hash) { return (int8_t)(hash & 0x7F); }
+		static size_t H1(size_t hash) { return hash >> 7; }
+
+		size_t FindIndex(const Key& key) const
+		{
+			return FindIndex(key, Hasher()(key));
+		}
+
+		size_t FindIndex(const Key& key, size_t hash) const
+		{
+			if (capacity == 0)
+				return capacity;
+
+			const size_t groupMask = capacity / GROUP_WIDTH - 1;
+			const int8_t h2 = H2(hash);
+			size_t group = H1(hash) & groupMask;
+
+			//triangular probing visits every group once for power of two group counts
+			for (size_t probe = 1; probe <= groupMask + 1; ++probe)
+			{
+				const size_t base = group * GROUP_WIDTH;
+				const Group g(ctrl + base);
+
+				for (uint32_t match = g.Match(h2); match; match &= match - 1)
+				{
+					const size_t index = base + std::countr_zero(match);
+					if (KeyEqual()(slots[index].first, key))
+						return index;
+				}
+				if (g.MatchEmpty())
+					break;
+
+				group = (group + probe) & groupMask;
+			}
+			return capacity;
+		}
+
+		size_t FindFreeIndex(size_t hash) const
+		{
+			const size_t groupMask = capacity / GROUP_WIDTH - 1;
+			size_t group = H1(hash) & groupMask;
+
+			for (size_t probe = 1;; ++probe)
+			{
+				const size_t base = group * GROUP_WIDTH;
+				if (const uint32_t freeMask = Group(ctrl + base).MatchFree())
+					return base + std::countr_zero(freeMask);
+
+				group = (group + probe) & groupMask;
+			}
+		}
+
+		size_t PrepareInsert(size_t hash)
+		{
+			if (count + deleted + 1 > MaxLoad(capacity))
+			{
+				//plenty of tombstones: rehash in place instead of growing
+				if (count + 1 <= MaxLoad(capacity) / 2)
+					Rehash(capacity);
+				else
+					Rehash(std::max(capacity * 2, GROUP_WIDTH));
+			}
+
+			const size_t index = FindFreeIndex(hash);
+			if (ctrl[index] == CTRL_DELETED)
+				--deleted;
+			ctrl[index] = H2(hash);
+			++count;
+			return index;
+		}
+
+		void EraseIndex(size_t index)
+		{
+			std::destroy_at(&slots[index]);
+			--count;
+
+			//a probe never continues past a group that still has an empty slot, so no tombstone is needed
+			const size_t base = index & ~(GROUP_WIDTH - 1);
+			if (Group(ctrl + base).MatchEmpty())
+			{
+				ctrl[index] = CTRL_EMPTY;
+			}
+			else
+			{
+				ctrl[index] = CTRL_DELETED;
+				++deleted;
+			}
+		}
+
+		void Rehash(size_t newCapacity)
+		{
+			int8_t* oldCtrl = ctrl;
+			value_type* oldSlots = slots;
+			const size_t oldCapacity = capacity;
+
+			Allocate(newCapacity);
+
+			for (size_t i = 0; i < oldCapacity; ++i)
+			{
+				if (oldCtrl[i] < 0) continue;
+
+				const size_t hash = Hasher()(oldSlots[i].first);
+				const size_t index = FindFreeIndex(hash);
+				ctrl[index] = H2(hash);
+				std::construct_at(&slots[index], std::move(oldSlots[i]));
+				std::destroy_at(&oldSlots[i]);
+			}
+			deleted = 0;
+
+			Deallocate(oldCtrl, oldSlots, oldCapacity);
+		}
+
+		void Allocate(size_t newCapacity)
+		{
+			ctrl = new int8_t[newCapacity];
+			std::fill_n(ctrl, newCapacity, CTRL_EMPTY);
+			slots = std::allocator<value_type>().allocate(newCapacity);
+			capacity = newCapacity;
+		}
+
+		static void Deallocate(int8_t* oldCtrl, value_type* oldSlots, size_t oldCapacity)
+		{
+			if (oldCapacity == 0) return;
+			delete[] oldCtrl;
+			std::allocator<value_type>().deallocate(oldSlots, oldCapacity);
+		}
+
+		void Release()
+		{
+			clear();
+			Deallocate(ctrl, slots, capacity);
+			ctrl = nullptr;
+			slots = nullptr;
+			capacity = 0;
+		}
+
+		void CopyFrom(const FlatHashMap& other)
+		{
+			if (other.capacity == 0) return;
+
+			//same capacity and hasher, so every element keeps its slot
+			Allocate(other.capacity);
+			for (size_t i = 0; i < capacity; ++i)
+			{
+				if (other.ctrl[i] >= 0)
+					std::construct_at(&slots[i], other.slots[i]);
+			}
+			std::copy_n(other.ctrl, capacity, ctrl);
+			count = other.count;
+			deleted = other.deleted;
+		}
+
+		void Swap(FlatHashMap& other) noexcept
+		{
+			std::swap(ctrl, other.ctrl);
+			std::swap(slots, other.slots);
+			std::swap(capacity, other.capacity);
+			std::swap(count, other.count);
+			std::swap(deleted, other.deleted);
+		}
+
+		int8_t* ctrl = nullptr;
+		value_type* slots = nullptr;
+		size_t capacity = 0;
+		size_t count = 0;
+		size_t deleted = 0;
+	};
+}
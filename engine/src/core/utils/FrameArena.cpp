@@ -0,0 +1,159 @@
+#include "Engine.h"
+#include "FrameArena.h"
+
+namespace Paper
+{
+	static size_t AlignUp(size_t value, size_t alignment)
+	{
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+
+	LinearArena::LinearArena(size_t chunkSize)
+		: chunkSize(chunkSize)
+	{
+	}
+
+	LinearArena::~LinearArena()
+	{
+		for (Chunk& chunk : chunks)
+		{
+			MemoryTracker::Untrack(MemoryTag::FrameArena, chunk.capacity);
+			::operator delete[](chunk.memory, std::align_val_t(alignof(std::max_align_t)));
+		}
+	}
+
+	void LinearArena::AddChunk(size_t capacity)
+	{
+		Chunk chunk;
+		chunk.capacity = capacity;
+		chunk.memory = (uint8_t*)::operator new[](capacity, std::align_val_t(alignof(std::max_align_t)));
+		chunks.push_back(chunk);
+		MemoryTracker::Track(MemoryTag::FrameArena, capacity);
+	}
+
+	void* LinearArena::Allocate(size_t size, size_t alignment)
+	{
+		CORE_ASSERT(alignment <= alignof(std::max_align_t), "over aligned arena allocations are not supported");
+
+		while (currentChunk < chunks.size())
+		{
+			Chunk& chunk = chunks[currentChunk];
+			const size_t offset = AlignUp(chunk.used, alignment);
+			if (offset + size <= chunk.capacity)
+			{
+				chunk.used = offset + size;
+				return chunk.memory + offset;
+			}
+			currentChunk++;
+		}
+
+		AddChunk(std::max(chunkSize, size));
+		Chunk& chunk = chunks.back();
+		chunk.used = size;
+		return chunk.memory;
+	}
+
+	void LinearArena::Reset()
+	{
+		if (chunks.size() > 1)
+		{
+			const size_t reserved = GetReservedBytes();
+			for (Chunk& chunk : chunks)
+			{
+				MemoryTracker::Untrack(MemoryTag::FrameArena, chunk.capacity);
+				::operator delete[](chunk.memory, std::align_val_t(alignof(std::max_align_t)));
+			}
+			chunks.clear();
+			AddChunk(reserved);
+		}
+
+		for (Chunk& chunk : chunks)
+			chunk.used = 0;
+		currentChunk = 0;
+	}
+
+	size_t LinearArena::GetUsedBytes() const
+	{
+		size_t used = 0;
+		for (const Chunk& chunk : chunks)
+			used += chunk.used;
+		return used;
+	}
+
+	size_t LinearArena::GetReservedBytes() const
+	{
+		size_t reserved = 0;
+		for (const Chunk& chunk : chunks)
+			reserved += chunk.capacity;
+		return reserved;
+	}
+
+	FrameArena::ThreadArena& FrameArena::GetThreadArena()
+	{
+		//short lived threads hand their arena back when they exit
+		struct Registration
+		{
+			Shr<ThreadArena> arena;
+
+			~Registration()
+			{
+				if (!arena) return;
+				std::scoped_lock<std::mutex> lock(threadsMutex);
+				std::erase(threads, arena);
+			}
+		};
+
+		thread_local Registration registration;
+		if (!registration.arena)
+		{
+			registration.arena = MakeShr<ThreadArena>();
+			std::scoped_lock<std::mutex> lock(threadsMutex);
+			threads.push_back(registration.arena);
+		}
+		return *registration.arena;
+	}
+
+	void* FrameArena::Allocate(size_t size, size_t alignment)
+	{
+		ThreadArena& threadArena = GetThreadArena();
+
+		const uint64_t currentEpoch = epoch.load(std::memory_order_relaxed);
+		if (threadArena.epoch != currentEpoch)
+		{
+			threadArena.arena.Reset();
+			threadArena.epoch = currentEpoch;
+		}
+
+		frameAllocations.fetch_add(1, std::memory_order_relaxed);
+		frameBytes.fetch_add(size, std::memory_order_relaxed);
+
+		return threadArena.arena.Allocate(size, alignment);
+	}
+
+	std::string_view FrameArena::CopyString(std::string_view string)
+	{
+		char* memory = Allocate<char>(string.size() + 1);
+		memcpy(memory, string.data(), string.size());
+		memory[string.size()] = '\0';
+		return std::string_view(memory, string.size());
+	}
+
+	void FrameArena::NewFrame()
+	{
+		stats.allocations = frameAllocations.exchange(0, std::memory_order_relaxed);
+		stats.bytes = frameBytes.exchange(0, std::memory_order_relaxed);
+		stats.peakAllocations = std::max(stats.peakAllocations, stats.allocations);
+		stats.peakBytes = std::max(stats.peakBytes, stats.bytes);
+
+		{
+			//only a rough number, other threads may be bumping while we read
+			std::scoped_lock<std::mutex> lock(threadsMutex);
+			stats.threads = (uint32_t)threads.size();
+			stats.reservedBytes = 0;
+			for (const Shr<ThreadArena>& thread : threads)
+				stats.reservedBytes += thread->arena.GetReservedBytes();
+		}
+
+		epoch.fetch_add(1, std::memory_order_relaxed);
+	}
+}
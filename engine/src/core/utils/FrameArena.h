@@ -0,0 +1,116 @@
+#pragma once
+#include "Engine.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace Paper
+{
+	// Bump allocator over a list of chunks. Reset keeps the memory, merged into one chunk
+	// if the last round needed more than one, so a steady workload settles on a single block.
+	class LinearArena
+	{
+	public:
+		LinearArena(size_t chunkSize = 256 * 1024);
+		~LinearArena();
+
+		LinearArena(const LinearArena&) = delete;
+		LinearArena& operator=(const LinearArena&) = delete;
+
+		void* Allocate(size_t size, size_t alignment);
+		void Reset();
+
+		size_t GetUsedBytes() const;
+		size_t GetReservedBytes() const;
+
+	private:
+		struct Chunk
+		{
+			uint8_t* memory = nullptr;
+			size_t capacity = 0;
+			size_t used = 0;
+		};
+
+		void AddChunk(size_t capacity);
+
+		std::vector<Chunk> chunks;
+		size_t currentChunk = 0;
+		size_t chunkSize;
+	};
+
+	struct FrameArenaStats
+	{
+		uint32_t allocations = 0; //during the last frame, all threads
+		size_t bytes = 0;
+		size_t reservedBytes = 0;
+		uint32_t peakAllocations = 0;
+		size_t peakBytes = 0;
+		uint32_t threads = 0;
+	};
+
+	// Scratch memory that lives until the end of the frame. Every thread bumps into its own arena,
+	// which is rewound the first time the thread allocates after FrameArena::NewFrame.
+	// Memory from here must not outlive the frame, so it can't be captured by render thread commands.
+	class FrameArena
+	{
+	public:
+		static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+		template<typename T>
+		static T* Allocate(size_t count = 1)
+		{
+			return (T*)Allocate(sizeof(T) * count, alignof(T));
+		}
+
+		//copies a string into the frame, the view stays valid until the frame ends
+		static std::string_view CopyString(std::string_view string);
+
+		static void NewFrame();
+		static const FrameArenaStats& GetStats() { return stats; }
+
+	private:
+		struct ThreadArena
+		{
+			LinearArena arena;
+			uint64_t epoch = 0;
+		};
+
+		static ThreadArena& GetThreadArena();
+
+		static inline std::atomic<uint64_t> epoch = 1;
+		static inline std::atomic<uint32_t> frameAllocations = 0;
+		static inline std::atomic<size_t> frameBytes = 0;
+
+		static inline std::mutex threadsMutex;
+		static inline std::vector<Shr<ThreadArena>> threads;
+
+		static inline FrameArenaStats stats;
+	};
+
+	template<typename T>
+	class FrameAllocator
+	{
+	public:
+		using value_type = T;
+
+		FrameAllocator() = default;
+		template<typename U>
+		FrameAllocator(const FrameAllocator<U>&) {}
+
+		T* allocate(size_t count) { return FrameArena::Allocate<T>(count); }
+		void deallocate(T*, size_t) {} //rewound with the arena
+
+		template<typename U>
+		bool operator==(const FrameAllocator<U>&) const { return true; }
+		template<typename U>
+		bool operator!=(const FrameAllocator<U>&) const { return false; }
+	};
+
+	template<typename T>
+	using FrameVector = std::vector<T, FrameAllocator<T>>;
+
+	using FrameString = std::basic_string<char, std::char_traits<char>, FrameAllocator<char>>;
+
+	template<typename K, typename V, typename THash = std::hash<K>, typename TEqual = std::equal_to<K>>
+	using FrameUnorderedMap = std::unordered_map<K, V, THash, TEqual, FrameAllocator<std::pair<const K, V>>>;
+}
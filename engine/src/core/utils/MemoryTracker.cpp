@@ -0,0 +1,177 @@
+#include "Engine.h"
+#include "MemoryTracker.h"
+
+#include <atomic>
+
+namespace Paper
+{
+	struct MemoryTagData
+	{
+		std::atomic<int64_t> current = 0;
+		std::atomic<int64_t> peak = 0;
+		std::atomic<uint64_t> allocations = 0;
+		std::atomic<uint64_t> frees = 0;
+
+		//main thread only
+		int64_t budget = 0;
+		bool overBudget = false;
+		std::function<int64_t()> sampler;
+	};
+
+	struct MemoryTrackerData
+	{
+		std::array<MemoryTagData, MemoryTracker::TAG_COUNT> tags;
+		std::atomic<int64_t> total = 0;
+		std::atomic<int64_t> peakTotal = 0;
+
+		std::array<float, MemoryTracker::HISTORY_SIZE> totalHistory = {};
+		uint32_t totalHistoryOffset = 0;
+	};
+
+	static MemoryTrackerData data;
+
+	const char* MemoryTagToString(MemoryTag tag)
+	{
+		switch (tag)
+		{
+			case MemoryTag::Renderer: return "Renderer";
+			case MemoryTag::FrameArena: return "Frame Arena";
+			case MemoryTag::Scene: return "Scene";
+			case MemoryTag::ScriptFields: return "Script Fields";
+			case MemoryTag::Mono: return "Mono";
+			case MemoryTag::GPUTextures: return "GPU Textures";
+			case MemoryTag::GPUBuffers: return "GPU Buffers";
+			case MemoryTag::GPUFramebuffers: return "GPU Framebuffers";
+			default: break;
+		}
+		return "Unknown";
+	}
+
+	static void AtomicMax(std::atomic<int64_t>& target, int64_t value)
+	{
+		int64_t previous = target.load(std::memory_order_relaxed);
+		while (previous < value && !target.compare_exchange_weak(previous, value, std::memory_order_relaxed)) {}
+	}
+
+	void MemoryTracker::Add(MemoryTag tag, int64_t bytes)
+	{
+		MemoryTagData& tagData = data.tags[(uint32_t)tag];
+		AtomicMax(tagData.peak, tagData.current.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+		AtomicMax(data.peakTotal, data.total.fetch_add(bytes, std::memory_order_relaxed) + bytes);
+	}
+
+	void MemoryTracker::Track(MemoryTag tag, int64_t bytes)
+	{
+		data.tags[(uint32_t)tag].allocations.fetch_add(1, std::memory_order_relaxed);
+		Add(tag, bytes);
+	}
+
+	void MemoryTracker::Untrack(MemoryTag tag, int64_t bytes)
+	{
+		data.tags[(uint32_t)tag].frees.fetch_add(1, std::memory_order_relaxed);
+		Add(tag, -bytes);
+	}
+
+	void MemoryTracker::Sample(MemoryTag tag, int64_t bytes)
+	{
+		MemoryTagData& tagData = data.tags[(uint32_t)tag];
+		Add(tag, bytes - tagData.current.load(std::memory_order_relaxed));
+	}
+
+	void MemoryTracker::SetSampler(MemoryTag tag, std::function<int64_t()> sampler)
+	{
+		MemoryTagData& tagData = data.tags[(uint32_t)tag];
+		tagData.sampler = std::move(sampler);
+		if (!tagData.sampler)
+			Sample(tag, 0);
+	}
+
+	void MemoryTracker::SetBudget(MemoryTag tag, int64_t bytes)
+	{
+		MemoryTagData& tagData = data.tags[(uint32_t)tag];
+		tagData.budget = bytes;
+		tagData.overBudget = false;
+	}
+
+	void MemoryTracker::NewFrame()
+	{
+		PAPER_PROFILE_FUNCTION();
+
+		for (uint32_t i = 0; i < TAG_COUNT; i++)
+		{
+			MemoryTagData& tagData = data.tags[i];
+			if (tagData.sampler)
+				Sample((MemoryTag)i, tagData.sampler());
+
+			if (tagData.budget <= 0)
+				continue;
+
+			const int64_t current = tagData.current.load(std::memory_order_relaxed);
+			if (current > tagData.budget && !tagData.overBudget)
+			{
+				LOG_CORE_WARN("{} memory is over budget: {:.2f} MB of {:.2f} MB", MemoryTagToString((MemoryTag)i),
+					current / (1024.0 * 1024.0), tagData.budget / (1024.0 * 1024.0));
+			}
+			tagData.overBudget = current > tagData.budget;
+		}
+
+		data.totalHistory[data.totalHistoryOffset] = (float)GetTotal();
+		data.totalHistoryOffset = (data.totalHistoryOffset + 1) % HISTORY_SIZE;
+	}
+
+	int64_t MemoryTracker::GetTotal()
+	{
+		return data.total.load(std::memory_order_relaxed);
+	}
+
+	int64_t MemoryTracker::GetPeakTotal()
+	{
+		return data.peakTotal.load(std::memory_order_relaxed);
+	}
+
+	const std::array<float, MemoryTracker::HISTORY_SIZE>& MemoryTracker::GetTotalHistory()
+	{
+		return data.totalHistory;
+	}
+
+	uint32_t MemoryTracker::GetTotalHistoryOffset()
+	{
+		return data.totalHistoryOffset;
+	}
+
+	MemoryTagStats MemoryTracker::GetStats(MemoryTag tag)
+	{
+		const MemoryTagData& tagData = data.tags[(uint32_t)tag];
+
+		MemoryTagStats stats;
+		stats.current = tagData.current.load(std::memory_order_relaxed);
+		stats.peak = tagData.peak.load(std::memory_order_relaxed);
+		stats.allocations = tagData.allocations.load(std::memory_order_relaxed);
+		stats.frees = tagData.frees.load(std::memory_order_relaxed);
+		stats.budget = tagData.budget;
+		stats.sampled = (bool)tagData.sampler;
+		return stats;
+	}
+
+	bool MemoryTracker::ExportCapture(const std::filesystem::path& filePath)
+	{
+		std::ofstream out(filePath);
+		if (!out)
+		{
+			LOG_CORE_ERROR("Could not write memory capture to '{}'", filePath.string());
+			return false;
+		}
+
+		out << "tag,currentBytes,peakBytes,allocations,frees,budgetBytes,sampled\n";
+		for (uint32_t i = 0; i < TAG_COUNT; i++)
+		{
+			const MemoryTagStats stats = GetStats((MemoryTag)i);
+			out << MemoryTagToString((MemoryTag)i) << ',' << stats.current << ',' << stats.peak << ','
+				<< stats.allocations << ',' << stats.frees << ',' << stats.budget << ',' << stats.sampled << '\n';
+		}
+		out << "Total," << GetTotal() << ',' << GetPeakTotal() << ",,,,\n";
+
+		LOG_CORE_TRACE("Exported memory capture to '{}'", filePath.string());
+		return true;
+	}
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "Engine.h"
+
+#include <array>
+#include <functional>
+
+namespace Paper
+{
+	enum class MemoryTag : uint8_t
+	{
+		Renderer,        //cpu side batch staging and command queues
+		FrameArena,
+		Scene,           //entt pools, sampled
+		ScriptFields,    //field storage buffers, sampled
+		Mono,            //managed heap, sampled
+		GPUTextures,
+		GPUBuffers,
+		GPUFramebuffers,
+
+		Count
+	};
+
+	const char* MemoryTagToString(MemoryTag tag);
+
+	struct MemoryTagStats
+	{
+		int64_t current = 0; //bytes
+		int64_t peak = 0;
+		uint64_t allocations = 0;
+		uint64_t frees = 0;
+		int64_t budget = 0; //0 for none
+		bool sampled = false;
+	};
+
+	// Live byte counts per subsystem. Owned allocations are reported with Track/Untrack from any thread,
+	// memory we don't own (mono heap, entt pools) is sampled once per frame.
+	class MemoryTracker
+	{
+	public:
+		static constexpr uint32_t TAG_COUNT = (uint32_t)MemoryTag::Count;
+		static constexpr uint32_t HISTORY_SIZE = 240;
+
+		static void Track(MemoryTag tag, int64_t bytes);
+		static void Untrack(MemoryTag tag, int64_t bytes);
+
+		template<typename T>
+		static T* NewArray(size_t count, MemoryTag tag)
+		{
+			Track(tag, count * sizeof(T));
+			return new T[count];
+		}
+
+		template<typename T>
+		static void DeleteArray(T* array, size_t count, MemoryTag tag)
+		{
+			if (!array) return;
+			Untrack(tag, count * sizeof(T));
+			delete[] array;
+		}
+
+		//replaces the tag's total, for memory owned by someone else
+		static void Sample(MemoryTag tag, int64_t bytes);
+		//called every frame to sample the tag, nullptr removes it
+		static void SetSampler(MemoryTag tag, std::function<int64_t()> sampler);
+
+		//warns once every time the tag goes over, 0 removes the budget
+		static void SetBudget(MemoryTag tag, int64_t bytes);
+
+		//runs the samplers and checks the budgets, main thread
+		static void NewFrame();
+
+		static MemoryTagStats GetStats(MemoryTag tag);
+		static int64_t GetTotal();
+		static int64_t GetPeakTotal();
+
+		//ring of the total over the last frames, the offset is the oldest entry
+		static const std::array<float, HISTORY_SIZE>& GetTotalHistory();
+		static uint32_t GetTotalHistoryOffset();
+
+		//csv snapshot of every tag
+		static bool ExportCapture(const std::filesystem::path& filePath);
+
+	private:
+		static void Add(MemoryTag tag, int64_t bytes);
+	};
+}
@@ -5,9 +5,9 @@
 
 namespace Paper
 {
-	static std::random_device randomDevice;
-	static std::mt19937_64 engine(randomDevice());
-	static std::uniform_int_distribution<uint64_t> distribution;
+	//per thread, scripts create ids from the script workers too
+	static thread_local std::mt19937_64 engine(std::random_device{}());
+	static thread_local std::uniform_int_distribution<uint64_t> distribution;
 
 	PaperID::PaperID()
 		: uuid(distribution(engine))
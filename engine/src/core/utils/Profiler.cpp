@@ -0,0 +1,223 @@
+#include "Engine.h"
+#include "Profiler.h"
+
+#include <iomanip>
+
+namespace Paper
+{
+	static constexpr size_t MAX_CAPTURE_EVENTS = 4 * 1024 * 1024;
+
+	ProfileThreadBuffer::ProfileThreadBuffer(uint32_t index)
+		: name("Thread " + std::to_string(index)), index(index), events(std::make_unique<ProfileEvent[]>(CAPACITY))
+	{
+	}
+
+	uint64_t ProfileThreadBuffer::Drain(std::vector<ProfileEvent>& out)
+	{
+		const uint64_t end = written.load(std::memory_order_acquire);
+
+		uint64_t lost = 0;
+		if (end - read > CAPACITY)
+		{
+			lost = end - read - CAPACITY;
+			read = end - CAPACITY;
+		}
+
+		const size_t first = out.size();
+		for (uint64_t i = read; i < end; i++)
+			out.push_back(events[i & (CAPACITY - 1)]);
+
+		//the writer may have lapped us while copying, those slots hold newer events now
+		//(+1 for the slot that may be mid write)
+		const uint64_t after = written.load(std::memory_order_acquire) + 1;
+		if (after - read > CAPACITY)
+		{
+			const uint64_t overwritten = std::min(after - read - CAPACITY, end - read);
+			out.erase(out.begin() + first, out.begin() + first + overwritten);
+			lost += overwritten;
+		}
+
+		read = end;
+		return lost;
+	}
+
+	//hands the thread's buffer back when the thread exits, so short lived workers don't pile up buffers
+	struct ProfileThreadOwner
+	{
+		ProfileThreadBuffer* buffer = nullptr;
+
+		~ProfileThreadOwner()
+		{
+			if (buffer)
+				Profiler::ReleaseThreadBuffer(*buffer);
+		}
+	};
+
+	static thread_local ProfileThreadOwner threadOwner;
+
+	ProfileThreadBuffer& Profiler::AcquireThreadBuffer(const std::string& name)
+	{
+		std::scoped_lock<std::mutex> lock(threadsMutex);
+
+		ProfileThreadBuffer* buffer = nullptr;
+		for (const Shr<ProfileThreadBuffer>& thread : threads)
+		{
+			if (thread->inUse) continue;
+			if (!name.empty() && thread->name == name)
+			{
+				buffer = thread.get();
+				break;
+			}
+			if (!buffer)
+				buffer = thread.get();
+		}
+
+		if (!buffer)
+		{
+			threads.push_back(MakeShr<ProfileThreadBuffer>((uint32_t)threads.size()));
+			buffer = threads.back().get();
+		}
+
+		buffer->inUse = true;
+		buffer->depth = 0;
+		buffer->name = name.empty() ? "Thread " + std::to_string(buffer->index) : name;
+		return *buffer;
+	}
+
+	void Profiler::ReleaseThreadBuffer(ProfileThreadBuffer& buffer)
+	{
+		std::scoped_lock<std::mutex> lock(threadsMutex);
+		buffer.inUse = false;
+	}
+
+	ProfileThreadBuffer& Profiler::GetThreadBuffer()
+	{
+		if (!threadOwner.buffer)
+			threadOwner.buffer = &AcquireThreadBuffer("");
+		return *threadOwner.buffer;
+	}
+
+	void Profiler::SetThreadName(const std::string& name)
+	{
+		ProfileThreadBuffer* buffer = threadOwner.buffer;
+
+		//open scopes still push into the current buffer, keep it and only rename
+		if (buffer && buffer->depth > 0)
+		{
+			std::scoped_lock<std::mutex> lock(threadsMutex);
+			buffer->name = name;
+			return;
+		}
+
+		if (buffer)
+			ReleaseThreadBuffer(*buffer);
+		threadOwner.buffer = &AcquireThreadBuffer(name);
+	}
+
+	std::vector<std::string> Profiler::GetThreadNames()
+	{
+		std::scoped_lock<std::mutex> lock(threadsMutex);
+		std::vector<std::string> names;
+		for (const Shr<ProfileThreadBuffer>& thread : threads)
+			names.push_back(thread->name);
+		return names;
+	}
+
+	void Profiler::NewFrame()
+	{
+		const uint64_t now = Now();
+
+		lastFrame.start = lastFrame.end;
+		lastFrame.end = now;
+		lastFrame.events.clear();
+
+		{
+			std::scoped_lock<std::mutex> lock(threadsMutex);
+			for (const Shr<ProfileThreadBuffer>& thread : threads)
+				droppedEvents += thread->Drain(lastFrame.events);
+		}
+
+		if (!capturing)
+			return;
+
+		capture.insert(capture.end(), lastFrame.events.begin(), lastFrame.events.end());
+		if (capture.size() >= MAX_CAPTURE_EVENTS)
+		{
+			LOG_CORE_WARN("Profiler capture reached {} events and was stopped", capture.size());
+			EndCapture();
+		}
+	}
+
+	void Profiler::BeginCapture()
+	{
+		capture.clear();
+		capturing = true;
+	}
+
+	void Profiler::EndCapture()
+	{
+		capturing = false;
+	}
+
+	static void WriteJsonString(std::ofstream& out, const std::string& string)
+	{
+		out << '"';
+		for (const char c : string)
+		{
+			switch (c)
+			{
+				case '"': out << "\\\""; break;
+				case '\\': out << "\\\\"; break;
+				case '\n': out << "\\n"; break;
+				case '\t': out << "\\t"; break;
+				default:
+					if ((unsigned char)c >= 0x20)
+						out << c;
+			}
+		}
+		out << '"';
+	}
+
+	bool Profiler::ExportChromeTrace(const std::filesystem::path& filePath)
+	{
+		std::ofstream out(filePath);
+		if (!out)
+		{
+			LOG_CORE_ERROR("Could not write profiler capture to '{}'", filePath.string());
+			return false;
+		}
+
+		out << std::fixed << std::setprecision(3);
+		out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+		bool first = true;
+		const std::vector<std::string> threadNames = GetThreadNames();
+		for (uint32_t i = 0; i < threadNames.size(); i++)
+		{
+			out << (first ? "\n" : ",\n");
+			first = false;
+
+			out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << i << ",\"args\":{\"name\":";
+			WriteJsonString(out, threadNames[i]);
+			out << "}}";
+		}
+
+		//timestamps are in microseconds
+		for (const ProfileEvent& event : capture)
+		{
+			out << (first ? "\n" : ",\n");
+			first = false;
+
+			out << "{\"name\":";
+			WriteJsonString(out, event.name);
+			out << ",\"cat\":\"cpu\",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.threadIndex
+				<< ",\"ts\":" << (double)event.start / 1000.0
+				<< ",\"dur\":" << (double)(event.end - event.start) / 1000.0 << "}";
+		}
+
+		out << "\n]}\n";
+
+		LOG_CORE_TRACE("Exported {} profiler events to '{}'", capture.size(), filePath.string());
+		return true;
+	}
+}
@@ -0,0 +1,154 @@
+#pragma once
+#include "Engine.h"
+
+#include <atomic>
+#include <mutex>
+
+namespace Paper
+{
+	struct ProfileEvent
+	{
+		const char* name = nullptr; //must outlive the profiler, string literals and __FUNCTION__ do
+		uint64_t start = 0; //ns since the profiler started
+		uint64_t end = 0;
+		uint32_t depth = 0;
+		uint32_t threadIndex = 0;
+	};
+
+	struct ProfileFrame
+	{
+		uint64_t start = 0;
+		uint64_t end = 0;
+		std::vector<ProfileEvent> events;
+	};
+
+	// Single producer ring buffer, only the owning thread writes and only Profiler::NewFrame reads.
+	// Buffers are never freed, when a thread exits its buffer goes back to the profiler for the next thread.
+	class ProfileThreadBuffer
+	{
+	public:
+		static constexpr uint32_t CAPACITY = 1 << 16;
+
+		ProfileThreadBuffer(uint32_t index);
+
+		void Push(const ProfileEvent& event)
+		{
+			const uint64_t index = written.load(std::memory_order_relaxed);
+			events[index & (CAPACITY - 1)] = event;
+			written.store(index + 1, std::memory_order_release);
+		}
+
+		//appends everything written since the last drain, returns how many events were lost to overruns
+		uint64_t Drain(std::vector<ProfileEvent>& out);
+
+		std::string name;
+		uint32_t index = 0;
+		uint32_t depth = 0;
+		bool inUse = false; //guarded by the profiler's threads mutex
+
+	private:
+		std::unique_ptr<ProfileEvent[]> events;
+		std::atomic<uint64_t> written = 0;
+		uint64_t read = 0;
+	};
+
+	class Profiler
+	{
+	public:
+		static uint64_t Now()
+		{
+			return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startPoint).count();
+		}
+
+		static void SetEnabled(bool enabled) { Profiler::enabled.store(enabled, std::memory_order_relaxed); }
+		static bool IsEnabled() { return enabled.load(std::memory_order_relaxed); }
+
+		static ProfileThreadBuffer& GetThreadBuffer();
+		static void SetThreadName(const std::string& name);
+		static std::vector<std::string> GetThreadNames();
+
+		//closes the previous frame and collects what every thread recorded during it
+		static void NewFrame();
+		static const ProfileFrame& GetLastFrame() { return lastFrame; }
+		static uint64_t GetDroppedEvents() { return droppedEvents; }
+
+		static void BeginCapture();
+		static void EndCapture();
+		static bool IsCapturing() { return capturing; }
+		static size_t GetCaptureEventCount() { return capture.size(); }
+
+		//writes the last capture in the chrome trace event format (chrome://tracing, perfetto)
+		static bool ExportChromeTrace(const std::filesystem::path& filePath);
+
+	private:
+		friend struct ProfileThreadOwner;
+
+		//prefers a free buffer that had the same name, so recurring workers keep their row
+		static ProfileThreadBuffer& AcquireThreadBuffer(const std::string& name);
+		static void ReleaseThreadBuffer(ProfileThreadBuffer& buffer);
+
+		static inline const std::chrono::steady_clock::time_point startPoint = std::chrono::steady_clock::now();
+		static inline std::atomic<bool> enabled = true;
+
+		static inline std::mutex threadsMutex;
+		static inline std::vector<Shr<ProfileThreadBuffer>> threads;
+
+		static inline ProfileFrame lastFrame;
+		static inline uint64_t droppedEvents = 0;
+
+		static inline bool capturing = false;
+		static inline std::vector<ProfileEvent> capture;
+	};
+
+	class ProfileScope
+	{
+	public:
+		ProfileScope(const char* name)
+		{
+			if (!Profiler::IsEnabled())
+				return;
+
+			buffer = &Profiler::GetThreadBuffer();
+			event.name = name;
+			event.depth = buffer->depth++;
+			event.threadIndex = buffer->index;
+			event.start = Profiler::Now();
+		}
+
+		~ProfileScope()
+		{
+			if (!buffer)
+				return;
+
+			event.end = Profiler::Now();
+			buffer->depth--;
+			buffer->Push(event);
+		}
+
+		ProfileScope(const ProfileScope&) = delete;
+		ProfileScope& operator=(const ProfileScope&) = delete;
+
+	private:
+		ProfileThreadBuffer* buffer = nullptr;
+		ProfileEvent event;
+	};
+}
+
+#ifdef PAPER_ENABLE_PROFILING
+
+#define PAPER_PROFILE_CONCAT_IMPL(a, b) a##b
+#define PAPER_PROFILE_CONCAT(a, b) PAPER_PROFILE_CONCAT_IMPL(a, b)
+
+#define PAPER_PROFILE_SCOPE(name) ::Paper::ProfileScope PAPER_PROFILE_CONCAT(profileScope, __LINE__)(name)
+#define PAPER_PROFILE_FUNCTION()  PAPER_PROFILE_SCOPE(__FUNCTION__)
+#define PAPER_PROFILE_THREAD(name) ::Paper::Profiler::SetThreadName(name)
+#define PAPER_PROFILE_NEW_FRAME()  ::Paper::Profiler::NewFrame()
+
+#else
+
+#define PAPER_PROFILE_SCOPE(name)
+#define PAPER_PROFILE_FUNCTION()
+#define PAPER_PROFILE_THREAD(name)
+#define PAPER_PROFILE_NEW_FRAME()
+
+#endif
@@ -10,12 +10,12 @@ namespace Paper
 
 	float Timer::GetElapsedMillis()
 	{
-		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - startPoint).count() * 0.001;
+		return std::chrono::duration<float, std::milli>(std::chrono::high_resolution_clock::now() - startPoint).count();
 	}
 
 	float Timer::GetElapsedMicros()
 	{
-		return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - startPoint).count() * 0.000001;
+		return std::chrono::duration<float, std::micro>(std::chrono::high_resolution_clock::now() - startPoint).count();
 	}
 }
 
@@ -10,6 +10,7 @@
 
 #include "stb_image.h"
 #include "event/Input.h"
+#include "renderer/RenderThread.h"
 
 
 namespace Paper
@@ -37,7 +38,12 @@ namespace Paper
 
     void GLFWWindow::SwapBuffers()
     {
-        context->SwapBuffer();
+        RenderThread::Submit([context = context]() { context->SwapBuffer(); });
+    }
+
+    void GLFWWindow::MakeContextCurrent(bool current)
+    {
+        context->MakeCurrent(current);
     }
 
     void GLFWWindow::Init(const WindowProps& window_props)
@@ -204,9 +210,9 @@ namespace Paper
         return { xpos, ypos };
     }
 
-    float GLFWWindow::GetTime() const
+    double GLFWWindow::GetTime() const
     {
-        return (float)glfwGetTime();
+        return glfwGetTime();
     }
 
     void GLFWWindow::SetTitle(const std::string& title)
@@ -216,7 +222,8 @@ namespace Paper
 
     void GLFWWindow::SetVSync(const bool enabled)
     {
-        glfwSwapInterval(enabled);
+        //the swap interval belongs to the context's thread
+        RenderThread::Submit([enabled]() { glfwSwapInterval(enabled); });
         windowData.vsync = enabled;
     }
 
@@ -18,13 +18,14 @@ namespace Paper
 
         void PollEvents() override;
         void SwapBuffers() override;
+        void MakeContextCurrent(bool current) override;
 
         unsigned int GetWidth() const override { return windowData.width; }
         unsigned int GetHeight() const override { return windowData.height; }
 
         glm::ivec2 GetPosition() const override;
 
-        float GetTime() const override;
+        double GetTime() const override;
 
         void SetEventCallback(const EventCallbackFunction& callback_function) override { windowData.callback = callback_function; }
         void SetTitle(const std::string& title) override;
@@ -10,17 +10,19 @@ namespace Paper
 	//
 
 	OpenGLVertexBuffer::OpenGLVertexBuffer(BufferLayout& layout, uint32_t size)
-		: layout(layout)
+		: size(size), layout(layout)
 	{
 		glCreateBuffers(1, &vboID);
 		glBindBuffer(GL_ARRAY_BUFFER, vboID);
 		glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
 
+		MemoryTracker::Track(MemoryTag::GPUBuffers, size);
 	}
 
 	OpenGLVertexBuffer::~OpenGLVertexBuffer()
 	{
 		glDeleteBuffers(1, &vboID);
+		MemoryTracker::Untrack(MemoryTag::GPUBuffers, size);
 	}
 
 	void OpenGLVertexBuffer::AddData(const void* data, uint32_t size)
@@ -54,11 +56,14 @@ namespace Paper
 		glCreateBuffers(1, &eboID);
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, eboID);
 		glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(uint32_t), data, GL_DYNAMIC_DRAW);
+
+		MemoryTracker::Track(MemoryTag::GPUBuffers, count * sizeof(uint32_t));
 	}
 
 	OpenGLElementBuffer::~OpenGLElementBuffer()
 	{
 		glDeleteBuffers(1, &eboID);
+		MemoryTracker::Untrack(MemoryTag::GPUBuffers, count * sizeof(uint32_t));
 	}
 
 	unsigned OpenGLElementBuffer::GetElementCount()
@@ -91,6 +96,7 @@ namespace Paper
 	{
 		if (uboID)
 			glDeleteBuffers(1, &uboID);
+		MemoryTracker::Untrack(MemoryTag::GPUBuffers, size);
 	}
 
 	void OpenGLUniformBuffer::Invalidate(uint32_t size)
@@ -103,6 +109,8 @@ namespace Paper
 		glBufferData(GL_UNIFORM_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
 		glBindBufferBase(GL_UNIFORM_BUFFER, binding, uboID);
 
+		MemoryTracker::Untrack(MemoryTag::GPUBuffers, this->size);
+		MemoryTracker::Track(MemoryTag::GPUBuffers, size);
 		this->size = size;
 	}
 
@@ -140,6 +148,7 @@ namespace Paper
 	{
 		if (ssboID)
 			glDeleteBuffers(1, &ssboID);
+		MemoryTracker::Untrack(MemoryTag::GPUBuffers, size);
 	}
 
 	void OpenGLStorageBuffer::Invalidate(uint32_t size)
@@ -152,6 +161,8 @@ namespace Paper
 		glBufferData(GL_SHADER_STORAGE_BUFFER, size, nullptr, GL_DYNAMIC_DRAW);
 		glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, ssboID);
 
+		MemoryTracker::Untrack(MemoryTag::GPUBuffers, this->size);
+		MemoryTracker::Track(MemoryTag::GPUBuffers, size);
 		this->size = size;
 	}
 
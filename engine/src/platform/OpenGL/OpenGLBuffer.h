@@ -20,6 +20,7 @@ namespace Paper
 		~OpenGLVertexBuffer() override;
 	private:
 		uint32_t vboID;
+		uint32_t size;
 		BufferLayout layout;
 	};
 
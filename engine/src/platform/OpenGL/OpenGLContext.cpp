@@ -49,4 +49,18 @@ namespace Paper
 		}
 		
 	}
+
+	void OpenGLContext::MakeCurrent(bool current)
+	{
+		switch (Window::GetFramework())
+		{
+			case GLFW:
+				glfwMakeContextCurrent(current ? (GLFWwindow*)window : nullptr);
+				break;
+
+			default:
+				CORE_ASSERT(false, "NONE is a not valid framework");
+				break;
+		}
+	}
 }
@@ -15,6 +15,7 @@ namespace Paper {
 		void Shutdown() override { };
 
 		void SwapBuffer() override;
+		void MakeCurrent(bool current) override;
 
 	private:
 		void* window;
@@ -1,6 +1,8 @@
 #include "Engine.h"
 #include "OpenGLFramebuffer.h"
 
+#include "renderer/RenderThread.h"
+
 #include <glad/glad.h>
 
 namespace Paper {
@@ -108,67 +110,82 @@ namespace Paper {
 	}
 
 	OpenGLFramebuffer::~OpenGLFramebuffer() {
-		glDeleteFramebuffers(1, &fboID);
-		glDeleteTextures(colorAttachmentsID.size(), colorAttachmentsID.data());
-		glDeleteTextures(1, &depthAttachmentID);
-	}
-
-	void OpenGLFramebuffer::Invalidate() {
-		if (fboID)
+		MemoryTracker::Untrack(MemoryTag::GPUFramebuffers, gpuSize);
+		RenderThread::Submit([fboID = fboID, colorAttachmentsID = colorAttachmentsID, depthAttachmentID = depthAttachmentID]()
 		{
 			glDeleteFramebuffers(1, &fboID);
 			glDeleteTextures(colorAttachmentsID.size(), colorAttachmentsID.data());
 			glDeleteTextures(1, &depthAttachmentID);
-			colorAttachmentsID.clear();
-			depthAttachmentID = 0;
-		}
-		glCreateFramebuffers(1, &fboID);
-		glBindFramebuffer(GL_FRAMEBUFFER, fboID);
-		bool multisample = specification.samples > 1;
-		//color
-		if (colorAttachmentSpec.size())
+		});
+	}
+
+	void OpenGLFramebuffer::Invalidate() {
+		//every format in use is 4 bytes per sample (RGBA8, R32I, DEPTH24_STENCIL8)
+		const int64_t attachmentCount = colorAttachmentSpec.size() + (depthAttachmentSpec.texFormat != FramebufferTexFormat::None ? 1 : 0);
+		const int64_t newSize = (int64_t)specification.width * specification.height * std::max(specification.samples, 1u) * attachmentCount * 4;
+		MemoryTracker::Untrack(MemoryTag::GPUFramebuffers, gpuSize);
+		MemoryTracker::Track(MemoryTag::GPUFramebuffers, newSize);
+		gpuSize = newSize;
+
+		//blocking, the new attachment ids are handed to imgui right after a resize
+		RenderThread::ExecuteSync([this]()
 		{
-			colorAttachmentsID.resize(colorAttachmentSpec.size());
-			CreateTextures(multisample, colorAttachmentsID.data(), colorAttachmentsID.size());
-			for (size_t i = 0; i < colorAttachmentsID.size(); i++)
+			if (fboID)
 			{
-				BindTexture(multisample, colorAttachmentsID[i]);
-				switch (colorAttachmentSpec[i].texFormat)
+				glDeleteFramebuffers(1, &fboID);
+				glDeleteTextures(colorAttachmentsID.size(), colorAttachmentsID.data());
+				glDeleteTextures(1, &depthAttachmentID);
+				colorAttachmentsID.clear();
+				depthAttachmentID = 0;
+			}
+			glCreateFramebuffers(1, &fboID);
+			glBindFramebuffer(GL_FRAMEBUFFER, fboID);
+			bool multisample = specification.samples > 1;
+			//color
+			if (colorAttachmentSpec.size())
+			{
+				colorAttachmentsID.resize(colorAttachmentSpec.size());
+				CreateTextures(multisample, colorAttachmentsID.data(), colorAttachmentsID.size());
+				for (size_t i = 0; i < colorAttachmentsID.size(); i++)
 				{
-				case FramebufferTexFormat::RGBA8:
-					AttachColorTexture(colorAttachmentsID[i], specification.samples, GL_RGBA8, GL_RGBA, specification.width, specification.height, i);
-					break;
-				case FramebufferTexFormat::RED_INTEGER:
-					AttachColorTexture(colorAttachmentsID[i], specification.samples, GL_R32I, GL_RED_INTEGER, specification.width, specification.height, i);
+					BindTexture(multisample, colorAttachmentsID[i]);
+					switch (colorAttachmentSpec[i].texFormat)
+					{
+					case FramebufferTexFormat::RGBA8:
+						AttachColorTexture(colorAttachmentsID[i], specification.samples, GL_RGBA8, GL_RGBA, specification.width, specification.height, i);
+						break;
+					case FramebufferTexFormat::RED_INTEGER:
+						AttachColorTexture(colorAttachmentsID[i], specification.samples, GL_R32I, GL_RED_INTEGER, specification.width, specification.height, i);
+						break;
+					}
+				}
+			}
+			//depth
+			if (depthAttachmentSpec.texFormat != FramebufferTexFormat::None)
+			{
+				CreateTextures(multisample, &depthAttachmentID, 1);
+				BindTexture(multisample, depthAttachmentID);
+				switch (depthAttachmentSpec.texFormat)
+				{
+				case FramebufferTexFormat::DEPTH24STECIL8:
+					AttachDepthTexture(depthAttachmentID, specification.samples, GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL_ATTACHMENT, specification.width, specification.height);
 					break;
 				}
 			}
-		}
-		//depth
-		if (depthAttachmentSpec.texFormat != FramebufferTexFormat::None)
-		{
-			CreateTextures(multisample, &depthAttachmentID, 1);
-			BindTexture(multisample, depthAttachmentID);
-			switch (depthAttachmentSpec.texFormat)
+			if (colorAttachmentsID.size() > 1)
 			{
-			case FramebufferTexFormat::DEPTH24STECIL8:
-				AttachDepthTexture(depthAttachmentID, specification.samples, GL_DEPTH24_STENCIL8, GL_DEPTH_STENCIL_ATTACHMENT, specification.width, specification.height);
-				break;
+				CORE_ASSERT(colorAttachmentsID.size() <= 4, "");
+				GLenum buffer[4] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2, GL_COLOR_ATTACHMENT3 };
+				glDrawBuffers(colorAttachmentsID.size(), buffer);
 			}
-		}
-		if (colorAttachmentsID.size() > 1)
-		{
-			CORE_ASSERT(colorAttachmentsID.size() <= 4, "");
-			GLenum buffer[4] = { GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1, GL_COLOR_ATTACHMENT2, GL_COLOR_ATTACHMENT3 };
-			glDrawBuffers(colorAttachmentsID.size(), buffer);
-		}
-		else if (colorAttachmentsID.empty())
-		{
-			// only depth
-			glDrawBuffer(GL_NONE);
-		}
-		CORE_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is incomplete!");
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+			else if (colorAttachmentsID.empty())
+			{
+				// only depth
+				glDrawBuffer(GL_NONE);
+			}
+			CORE_ASSERT(glCheckFramebufferStatus(GL_FRAMEBUFFER) == GL_FRAMEBUFFER_COMPLETE, "Framebuffer is incomplete!");
+			glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		});
 	}
 
 	void OpenGLFramebuffer::Resize(unsigned int width, unsigned int height)
@@ -181,9 +198,19 @@ namespace Paper {
 	int OpenGLFramebuffer::ReadPixel(uint32_t attachmentIndex, glm::ivec2 pos)
 	{
 		CORE_ASSERT(attachmentIndex < colorAttachmentsID.size(), "");
-		glReadBuffer(GL_COLOR_ATTACHMENT0 + attachmentIndex);
-		int pixelData;
-		glReadPixels(pos.x, pos.y, 1, 1, GL_RED_INTEGER, GL_INT, &pixelData);
+		int pixelData = -1;
+		RenderThread::ExecuteSync([&]()
+		{
+			//with a render thread the recorded Bind may not have run yet, so bind for the read explicitly
+			int previousFramebuffer = 0;
+			glGetIntegerv(GL_READ_FRAMEBUFFER_BINDING, &previousFramebuffer);
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, fboID);
+
+			glReadBuffer(GL_COLOR_ATTACHMENT0 + attachmentIndex);
+			glReadPixels(pos.x, pos.y, 1, 1, GL_RED_INTEGER, GL_INT, &pixelData);
+
+			glBindFramebuffer(GL_READ_FRAMEBUFFER, previousFramebuffer);
+		});
 		return pixelData;
 	}
 
@@ -193,21 +220,30 @@ namespace Paper {
 
 		auto& spec = colorAttachmentSpec[attachmentIndex];
 
-		glClearTexImage(colorAttachmentsID[attachmentIndex], 0, FBTexFormatToGL(spec.texFormat), GL_INT, &value);
+		RenderThread::Submit([id = colorAttachmentsID[attachmentIndex], format = FBTexFormatToGL(spec.texFormat), value]()
+		{
+			glClearTexImage(id, 0, format, GL_INT, &value);
+		});
 	}
 
 	void OpenGLFramebuffer::Bind() {
-		glBindFramebuffer(GL_FRAMEBUFFER, fboID);
-		glViewport(0, 0, specification.width, specification.height);
+		RenderThread::Submit([fboID = fboID, width = specification.width, height = specification.height]()
+		{
+			glBindFramebuffer(GL_FRAMEBUFFER, fboID);
+			glViewport(0, 0, width, height);
+		});
 	}
 
 	void OpenGLFramebuffer::Unbind() {
-		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		RenderThread::Submit([]() { glBindFramebuffer(GL_FRAMEBUFFER, 0); });
 	}
 
 	void OpenGLFramebuffer::BindAttachmentAsTexture(uint32_t attachment, uint32_t slot)
 	{
-		glActiveTexture(GL_TEXTURE0 + slot);
-		glBindTexture(GL_TEXTURE_2D, GetColorID(attachment));
+		RenderThread::Submit([id = GetColorID(attachment), slot]()
+		{
+			glActiveTexture(GL_TEXTURE0 + slot);
+			glBindTexture(GL_TEXTURE_2D, id);
+		});
 	}
 }
@@ -41,5 +41,7 @@ namespace Paper
 
 		std::vector<uint32_t> colorAttachmentsID; // texture id's
 		uint32_t depthAttachmentID;
+
+		int64_t gpuSize = 0; //bytes reported to the memory tracker
 	};
 }
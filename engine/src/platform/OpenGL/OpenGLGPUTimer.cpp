@@ -0,0 +1,113 @@
+#include "Engine.h"
+#include "OpenGLGPUTimer.h"
+
+#include <glad/glad.h>
+
+namespace Paper
+{
+	OpenGLGPUTimer::OpenGLGPUTimer()
+	{
+		GLint bits = 0;
+		glGetQueryiv(GL_TIMESTAMP, GL_QUERY_COUNTER_BITS, &bits);
+		supported = bits > 0;
+
+		if (!supported)
+			LOG_CORE_WARN("The driver has no timestamp queries, gpu pass timings are disabled");
+	}
+
+	OpenGLGPUTimer::~OpenGLGPUTimer()
+	{
+		for (Frame& frame : frames)
+			if (!frame.queries.empty())
+				glDeleteQueries((GLsizei)frame.queries.size(), frame.queries.data());
+	}
+
+	void OpenGLGPUTimer::BeginFrame()
+	{
+		if (!IsSupported())
+			return;
+
+		if (!openPasses.empty())
+		{
+			LOG_CORE_WARN("{} gpu passes were not ended before the next frame", openPasses.size());
+			openPasses.clear();
+		}
+
+		//the slot we move into was recorded FRAME_LATENCY frames ago
+		frameIndex = (frameIndex + 1) % FRAME_LATENCY;
+		ReadBack(frameIndex);
+
+		Frame& frame = frames[frameIndex];
+		frame.usedQueries = 0;
+		frame.passes.clear();
+	}
+
+	void OpenGLGPUTimer::BeginPass(const std::string& name)
+	{
+		if (!IsSupported())
+			return;
+
+		Frame& frame = frames[frameIndex];
+		openPasses.push_back((uint32_t)frame.passes.size());
+
+		Pass& pass = frame.passes.emplace_back();
+		pass.name = name;
+		pass.begin = WriteTimestamp();
+	}
+
+	void OpenGLGPUTimer::EndPass()
+	{
+		if (!IsSupported())
+			return;
+
+		CORE_ASSERT(!openPasses.empty(), "EndPass without a matching BeginPass");
+		if (openPasses.empty())
+			return;
+
+		frames[frameIndex].passes[openPasses.back()].end = WriteTimestamp();
+		openPasses.pop_back();
+	}
+
+	uint32_t OpenGLGPUTimer::WriteTimestamp()
+	{
+		Frame& frame = frames[frameIndex];
+		if (frame.usedQueries == frame.queries.size())
+		{
+			const size_t oldSize = frame.queries.size();
+			frame.queries.resize(std::max<size_t>(oldSize * 2, 16));
+			glGenQueries((GLsizei)(frame.queries.size() - oldSize), frame.queries.data() + oldSize);
+		}
+
+		const uint32_t index = frame.usedQueries++;
+		glQueryCounter(frame.queries[index], GL_TIMESTAMP);
+		return index;
+	}
+
+	void OpenGLGPUTimer::ReadBack(uint32_t frameSlot)
+	{
+		Frame& frame = frames[frameSlot];
+		if (frame.passes.empty())
+			return;
+
+		//timestamps complete in order, if the last one is there all of them are
+		GLint available = 0;
+		glGetQueryObjectiv(frame.queries[frame.usedQueries - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available)
+		{
+			SkipFrame();
+			return;
+		}
+
+		std::vector<GLuint64> timestamps(frame.usedQueries);
+		for (uint32_t i = 0; i < frame.usedQueries; i++)
+			glGetQueryObjectui64v(frame.queries[i], GL_QUERY_RESULT, &timestamps[i]);
+
+		std::vector<std::pair<std::string, uint64_t>> passTimes;
+		passTimes.reserve(frame.passes.size());
+		for (const Pass& pass : frame.passes)
+			if (pass.end > pass.begin) //skips passes that were never ended
+				passTimes.emplace_back(pass.name, timestamps[pass.end] - timestamps[pass.begin]);
+
+		Resolve(passTimes);
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "Engine.h"
+#include "utility.h"
+
+#include "core/renderer/GPUTimer.h"
+
+namespace Paper
+{
+	class OpenGLGPUTimer : public GPUTimer
+	{
+	public:
+		OpenGLGPUTimer();
+		~OpenGLGPUTimer() override;
+
+		void BeginFrame() override;
+		void BeginPass(const std::string& name) override;
+		void EndPass() override;
+
+		bool IsSupported() const override { return supported; }
+
+	private:
+		//GL_TIME_ELAPSED queries can't nest, so passes are timed with a timestamp at each end
+		uint32_t WriteTimestamp();
+		void ReadBack(uint32_t frame);
+
+		struct Pass
+		{
+			std::string name;
+			uint32_t begin = 0;
+			uint32_t end = 0;
+		};
+
+		struct Frame
+		{
+			std::vector<uint32_t> queries; //pooled, only grows
+			uint32_t usedQueries = 0;
+			std::vector<Pass> passes;
+		};
+
+		Frame frames[FRAME_LATENCY];
+		uint32_t frameIndex = 0;
+		std::vector<uint32_t> openPasses;
+
+		bool supported = false;
+	};
+}
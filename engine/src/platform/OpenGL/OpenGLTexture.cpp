@@ -2,6 +2,7 @@
 #include "OpenGLTexture.h"
 
 #include "renderer/Texture.h"
+#include "renderer/RenderThread.h"
 
 #include <glad/glad.h>
 #include <STB_IMAGE/stb_image.h>
@@ -39,10 +40,7 @@ namespace Paper
 		this->name = name;
 
 		if (!Init(this->filePath))
-		{
-			glDeleteTextures(1, &texID);
 			Init("resources/textures/error_texture_256x256.png");
-		}
 	}
 
 	OpenGLTexture::OpenGLTexture(TextureSpecification specification)
@@ -52,34 +50,46 @@ namespace Paper
 		internalFormat = ImageFormatToGLInternalFormat(specification.Format);
 		dataFormat = ImageFormatToGLDataFormat(specification.Format);
 
-		glCreateTextures(GL_TEXTURE_2D, 1, &texID);
-		glTextureStorage2D(texID, 1, internalFormat, width, height);
+		RenderThread::ExecuteSync([this]()
+		{
+			glCreateTextures(GL_TEXTURE_2D, 1, &texID);
+			glTextureStorage2D(texID, 1, internalFormat, width, height);
+
+			glTextureParameteri(texID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTextureParameteri(texID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-		glTextureParameteri(texID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTextureParameteri(texID, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTextureParameteri(texID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+			glTextureParameteri(texID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		});
 
-		glTextureParameteri(texID, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTextureParameteri(texID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		gpuSize = (int64_t)width * height * (specification.Format == ImageFormat::RGBA8 ? 4 : 3);
+		MemoryTracker::Track(MemoryTag::GPUTextures, gpuSize);
 	}
 
 	void OpenGLTexture::SetData(void* data, uint32_t size)
 	{
 		uint32_t bpp = dataFormat == GL_RGBA ? 4 : 3;
 		CORE_ASSERT(size == width * height * bpp, "Data must be entire texture!");
-		glTextureSubImage2D(texID, 0, 0, 0, width, height, dataFormat, GL_UNSIGNED_BYTE, data);
+		RenderThread::ExecuteSync([&]() { glTextureSubImage2D(texID, 0, 0, 0, width, height, dataFormat, GL_UNSIGNED_BYTE, data); });
 	}
 
 	OpenGLTexture::~OpenGLTexture()
 	{
-		glDeleteTextures(1, &texID);
+		MemoryTracker::Untrack(MemoryTag::GPUTextures, gpuSize);
+
+		//queued behind every command that still draws with it
+		RenderThread::Submit([texID = texID]() { glDeleteTextures(1, &texID); });
 	}
 
 	void OpenGLTexture::Bind(unsigned slot)
 	{
 		if (slot < 31)
 		{
-			glActiveTexture(GL_TEXTURE0 + slot);
-			glBindTexture(GL_TEXTURE_2D, texID);
+			RenderThread::Submit([texID = texID, slot]()
+			{
+				glActiveTexture(GL_TEXTURE0 + slot);
+				glBindTexture(GL_TEXTURE_2D, texID);
+			});
 			return;
 		}
 		LOG_CORE_WARN("You should not go over 31 texture slots, as the OpenGL specification does not allow more");
@@ -92,7 +102,7 @@ namespace Paper
 
 	void OpenGLTexture::Unbind()
 	{
-		glBindTexture(GL_TEXTURE_2D, 0);
+		RenderThread::Submit([]() { glBindTexture(GL_TEXTURE_2D, 0); });
 	}
 
 	uint32_t OpenGLTexture::GetID() const
@@ -127,46 +137,56 @@ namespace Paper
 
 	bool OpenGLTexture::Init(std::filesystem::path path)
 	{
-		glGenTextures(1, &texID);
-		// use texture (everything that is called from now will be set to the current texture)
-		glBindTexture(GL_TEXTURE_2D, texID);
-		// set texture parameters
-
-		// repeat image in both directions (activate the repeating of the texture)
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-		// pixelate the texture when made bigger
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		// pixelate the texture when made smaller
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
 		stbi_set_flip_vertically_on_load(true);
 		// load texture and save formats to the variables (4 == RGBA format)
 		localBuffer = stbi_load(path.string().c_str(), &width, &height, &channels, 0);
 
 		// free memory if path is invalid
-		if (localBuffer)
+		if (!localBuffer)
+		{
+			LOG_CORE_ERROR("Could not load image '" + path.string() + "'");
+			return false;
+		}
+
+		if (channels != 3 && channels != 4)
+		{
+			LOG_CORE_ERROR("Unknown number of channel '" + std::to_string(channels) + "' by texture '" + path.string() + "'");
+			stbi_image_free(localBuffer);
+			return false;
+		}
+
+		//decoding stays on the calling thread, only the upload needs the context
+		RenderThread::ExecuteSync([this]()
 		{
+			glGenTextures(1, &texID);
+			// use texture (everything that is called from now will be set to the current texture)
+			glBindTexture(GL_TEXTURE_2D, texID);
+			// set texture parameters
+
+			// repeat image in both directions (activate the repeating of the texture)
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+			// pixelate the texture when made bigger
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			// pixelate the texture when made smaller
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
 			if (channels == 3) {
 				glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB8, width, height, 0, GL_RGB, GL_UNSIGNED_BYTE, localBuffer);
 			}
-			else if (channels == 4) {
-				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, localBuffer);
-			}
 			else {
-				LOG_CORE_ERROR("Unknown number of channel '" + std::to_string(channels) + "' by texture '" + path.string() + "'");
-				return false;
+				glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, localBuffer);
 			}
 			glGenerateMipmap(GL_TEXTURE_2D);
 			glBindTexture(GL_TEXTURE_2D, 0);
-		}
-		else {
-			LOG_CORE_ERROR("Could not load image '" + path.string() + "'");
-			return false;
-		}
+		});
 
 		stbi_image_free(localBuffer);
+
+		//the mip chain adds about a third
+		gpuSize = (int64_t)width * height * channels * 4 / 3;
+		MemoryTracker::Track(MemoryTag::GPUTextures, gpuSize);
 		return true;
 	}
-}
+}
\ No newline at end of file
@@ -47,6 +47,7 @@ namespace Paper
 		int channels;
 
 		uint32_t texID;
+		int64_t gpuSize = 0; //bytes reported to the memory tracker
 
 		bool Init(std::filesystem::path path);
 	};
@@ -80,4 +80,8 @@ group ""
 
 group "editor"
 include "PaperEditor"
+group ""
+
+group "bench"
+include "PaperBench"
 group ""
\ No newline at end of file
@@ -0,0 +1,19 @@
+﻿namespace Paper
+{
+    // Native counter that changes whenever component pointers handed to scripts may have moved
+    // (an entity was destroyed, a component removed, the runtime restarted).
+    internal static unsafe class ComponentViews
+    {
+        private static uint* s_Version;
+
+        internal static uint Version
+        {
+            get
+            {
+                if (s_Version == null)
+                    s_Version = InternalCalls.ComponentViews_GetVersion();
+                return *s_Version;
+            }
+        }
+    }
+}
@@ -1,5 +1,6 @@
 ﻿using System;
 using System.Collections.Generic;
+using System.Runtime.InteropServices;
 using System.Text;
 
 namespace Paper
@@ -19,6 +20,9 @@ namespace Paper
 
         public PaperID PaperID => Entity.PaperID;
 
+        public bool HasTag(Tag _Tag) => Entity.HasTag(_Tag);
+
+        // builds a new list on every get, use HasTag in per frame code
         public List<string> Tags
         {
             get
@@ -44,45 +48,54 @@ namespace Paper
         }
     }
 
+    // Layout of the native TransformComponent data, scripts read and write it in place.
+    [StructLayout(LayoutKind.Sequential)]
+    public struct TransformData
+    {
+        public Vec3 Position;
+        public Vec3 Scale;
+        public Vec3 Rotation;
+    }
+
     public class TransformComponent : Component
     {
-        public Vec3 Position
+        private IntPtr m_Data;
+        private uint m_DataVersion;
+
+        // Reference into native component storage. Only use it within the current update,
+        // destroying entities or removing components can move it.
+        public unsafe ref TransformData Data
         {
             get
             {
-                InternalCalls.TransformComponent_GetPosition(Entity.PaperID, out Vec3 position);
-                return position;
-            }
-            set
-            {
-                InternalCalls.TransformComponent_SetPosition(Entity.PaperID, ref value);
+                uint version = ComponentViews.Version;
+                if (m_DataVersion != version || m_Data == IntPtr.Zero)
+                {
+                    m_Data = InternalCalls.TransformComponent_GetData(Entity.PaperID);
+                    if (m_Data == IntPtr.Zero)
+                        throw new InvalidOperationException("Entity has no TransformComponent");
+                    m_DataVersion = version;
+                }
+                return ref *(TransformData*)m_Data;
             }
         }
 
+        public Vec3 Position
+        {
+            get => Data.Position;
+            set => Data.Position = value;
+        }
+
         public Vec3 Rotation
         {
-            get
-            {
-                InternalCalls.TransformComponent_GetRotation(Entity.PaperID, out Vec3 rotation);
-                return rotation;
-            }
-            set
-            {
-                InternalCalls.TransformComponent_SetRotation(Entity.PaperID, ref value);
-            }
+            get => Data.Rotation;
+            set => Data.Rotation = value;
         }
 
         public Vec3 Scale
         {
-            get
-            {
-                InternalCalls.TransformComponent_GetScale(Entity.PaperID, out Vec3 scale);
-                return scale;
-            }
-            set
-            {
-                InternalCalls.TransformComponent_SetScale(Entity.PaperID, ref value);
-            }
+            get => Data.Scale;
+            set => Data.Scale = value;
         }
     }
 
@@ -94,16 +107,48 @@ namespace Paper
         Circle
     }
 
+    // Layout of the native SpriteComponent data, scripts read and write it in place.
+    [StructLayout(LayoutKind.Sequential)]
+    public struct SpriteData
+    {
+        public Vec4 Color;
+        public float TilingFactor;
+        public Vec2 TexCoord0;
+        public Vec2 TexCoord1;
+        public Vec2 TexCoord2;
+        public Vec2 TexCoord3;
+        public Geometry Geometry;
+        public float Thickness;
+        public float Fade;
+    }
+
     public class SpriteComponent : Component
     {
-        public Vec4 Color
+        private IntPtr m_Data;
+        private uint m_DataVersion;
+
+        // Reference into native component storage. Only use it within the current update,
+        // destroying entities or removing components can move it.
+        public unsafe ref SpriteData Data
         {
             get
             {
-                InternalCalls.SpriteComponent_GetColor(Entity.PaperID, out Vec4 color);
-                return color;
+                uint version = ComponentViews.Version;
+                if (m_DataVersion != version || m_Data == IntPtr.Zero)
+                {
+                    m_Data = InternalCalls.SpriteComponent_GetData(Entity.PaperID);
+                    if (m_Data == IntPtr.Zero)
+                        throw new InvalidOperationException("Entity has no SpriteComponent");
+                    m_DataVersion = version;
+                }
+                return ref *(SpriteData*)m_Data;
             }
-            set => InternalCalls.SpriteComponent_SetColor(Entity.PaperID, ref value);
+        }
+
+        public Vec4 Color
+        {
+            get => Data.Color;
+            set => Data.Color = value;
         }
 
         public Texture Texture
@@ -122,46 +167,50 @@ namespace Paper
 
         public float TilingFactor
         {
-            get => InternalCalls.SpriteComponent_GetTilingFactor(Entity.PaperID);
-            set => InternalCalls.SpriteComponent_SetTilingFactor(Entity.PaperID, value);
+            get => Data.TilingFactor;
+            set => Data.TilingFactor = value;
         }
 
         public Vec2 UV0
         {
-            get
+            get => Data.TexCoord0;
+            set
             {
-                InternalCalls.SpriteComponent_GetUV0(Entity.PaperID, out Vec2 uv0);
-                return uv0;
+                ref SpriteData data = ref Data;
+                data.TexCoord0 = value;
+                data.TexCoord1.Y = value.Y;
+                data.TexCoord3.X = value.X;
             }
-            set => InternalCalls.SpriteComponent_SetUV0(Entity.PaperID, ref value);
         }
 
         public Vec2 UV1
         {
-            get
+            get => Data.TexCoord2;
+            set
             {
-                InternalCalls.SpriteComponent_GetUV1(Entity.PaperID, out Vec2 uv1);
-                return uv1;
+                ref SpriteData data = ref Data;
+                data.TexCoord1.X = value.X;
+                data.TexCoord2 = value;
+                data.TexCoord3.Y = value.Y;
             }
-            set => InternalCalls.SpriteComponent_SetUV1(Entity.PaperID, ref value);
         }
 
         public Geometry Geometry
         {
-            get => (Geometry)InternalCalls.SpriteComponent_GetGeometry(Entity.PaperID);
-            set => InternalCalls.SpriteComponent_SetGeometry(Entity.PaperID, (int)value);
+            get => Data.Geometry;
+            set => Data.Geometry = value;
         }
 
         public float Thickness
         {
-            get => InternalCalls.SpriteComponent_GetThickness(Entity.PaperID);
-            set => InternalCalls.SpriteComponent_SetThickness(Entity.PaperID, value);
+            get => Data.Thickness;
+            set => Data.Thickness = value;
         }
 
         public float Fade
         {
-            get => InternalCalls.SpriteComponent_GetFade(Entity.PaperID);
-            set => InternalCalls.SpriteComponent_SetFade(Entity.PaperID, value);
+            get => Data.Fade;
+            set => Data.Fade = value;
         }
     }
 
@@ -234,4 +283,122 @@ namespace Paper
             set => InternalCalls.ScriptComponent_SetScriptClassName(Entity.PaperID, value);
         }
     }
+
+    public enum BodyType2D
+    {
+        Static,
+        Dynamic,
+        Kinematic
+    }
+
+    public class Rigidbody2DComponent : Component
+    {
+        public BodyType2D BodyType
+        {
+            get => (BodyType2D)InternalCalls.Rigidbody2DComponent_GetBodyType(Entity.PaperID);
+            set => InternalCalls.Rigidbody2DComponent_SetBodyType(Entity.PaperID, (int)value);
+        }
+
+        public Vec2 Velocity
+        {
+            get
+            {
+                InternalCalls.Rigidbody2DComponent_GetVelocity(Entity.PaperID, out Vec2 velocity);
+                return velocity;
+            }
+            set => InternalCalls.Rigidbody2DComponent_SetVelocity(Entity.PaperID, ref value);
+        }
+
+        public float Mass
+        {
+            get => InternalCalls.Rigidbody2DComponent_GetMass(Entity.PaperID);
+            set => InternalCalls.Rigidbody2DComponent_SetMass(Entity.PaperID, value);
+        }
+
+        public float GravityScale
+        {
+            get => InternalCalls.Rigidbody2DComponent_GetGravityScale(Entity.PaperID);
+            set => InternalCalls.Rigidbody2DComponent_SetGravityScale(Entity.PaperID, value);
+        }
+
+        public float LinearDamping
+        {
+            get => InternalCalls.Rigidbody2DComponent_GetLinearDamping(Entity.PaperID);
+            set => InternalCalls.Rigidbody2DComponent_SetLinearDamping(Entity.PaperID, value);
+        }
+
+        public bool IsAwake => InternalCalls.Rigidbody2DComponent_IsAwake(Entity.PaperID);
+
+        public void ApplyForce(Vec2 _Force) => InternalCalls.Rigidbody2DComponent_ApplyForce(Entity.PaperID, ref _Force);
+
+        public void ApplyImpulse(Vec2 _Impulse) => InternalCalls.Rigidbody2DComponent_ApplyImpulse(Entity.PaperID, ref _Impulse);
+
+        public void WakeUp() => InternalCalls.Rigidbody2DComponent_WakeUp(Entity.PaperID);
+    }
+
+    public class BoxCollider2DComponent : Component
+    {
+        public Vec2 Offset
+        {
+            get
+            {
+                InternalCalls.BoxCollider2DComponent_GetOffset(Entity.PaperID, out Vec2 offset);
+                return offset;
+            }
+            set => InternalCalls.BoxCollider2DComponent_SetOffset(Entity.PaperID, ref value);
+        }
+
+        public Vec2 Size
+        {
+            get
+            {
+                InternalCalls.BoxCollider2DComponent_GetSize(Entity.PaperID, out Vec2 size);
+                return size;
+            }
+            set => InternalCalls.BoxCollider2DComponent_SetSize(Entity.PaperID, ref value);
+        }
+
+        public float Friction
+        {
+            get => InternalCalls.BoxCollider2DComponent_GetFriction(Entity.PaperID);
+            set => InternalCalls.BoxCollider2DComponent_SetFriction(Entity.PaperID, value);
+        }
+
+        public float Restitution
+        {
+            get => InternalCalls.BoxCollider2DComponent_GetRestitution(Entity.PaperID);
+            set => InternalCalls.BoxCollider2DComponent_SetRestitution(Entity.PaperID, value);
+        }
+    }
+
+    public class CircleCollider2DComponent : Component
+    {
+        public Vec2 Offset
+        {
+            get
+            {
+                InternalCalls.CircleCollider2DComponent_GetOffset(Entity.PaperID, out Vec2 offset);
+                return offset;
+            }
+            set => InternalCalls.CircleCollider2DComponent_SetOffset(Entity.PaperID, ref value);
+        }
+
+        public float Radius
+        {
+            get => InternalCalls.CircleCollider2DComponent_GetRadius(Entity.PaperID);
+            set => InternalCalls.CircleCollider2DComponent_SetRadius(Entity.PaperID, value);
+        }
+
+        public float Friction
+        {
+            get => InternalCalls.CircleCollider2DComponent_GetFriction(Entity.PaperID);
+            set => InternalCalls.CircleCollider2DComponent_SetFriction(Entity.PaperID, value);
+        }
+
+        public float Restitution
+        {
+            get => InternalCalls.CircleCollider2DComponent_GetRestitution(Entity.PaperID);
+            set => InternalCalls.CircleCollider2DComponent_SetRestitution(Entity.PaperID, value);
+        }
+    }
 }
\ No newline at end of file
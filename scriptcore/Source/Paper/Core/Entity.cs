@@ -1,4 +1,5 @@
 ﻿using System;
+using System.Collections.Generic;
 
 namespace Paper
 {
@@ -6,6 +7,13 @@ namespace Paper
     {
         public readonly PaperID PaperID;
 
+        // component wrappers handed out by GetComponent, created once per type. The array is replaced
+        // instead of grown, so [ThreadSafe] scripts can look up the same entity from several workers.
+        private Component[] m_Components = new Component[0];
+
+        [ThreadStatic]
+        private static ulong[] s_EntityIDBuffer;
+
         public Entity()
         {
             PaperID = 0;
@@ -27,16 +35,74 @@ namespace Paper
             if (!HasComponent<T>())
                 return null;
 
+            Component[] components = m_Components;
+            for (int i = 0; i < components.Length; i++)
+            {
+                if (components[i] is T cached)
+                    return cached;
+            }
+
+            // two threads adding at once may each keep their own wrapper, both point at the same component
             T component = new T { Entity = this };
+            Component[] grown = new Component[components.Length + 1];
+            Array.Copy(components, grown, components.Length);
+            grown[components.Length] = component;
+            m_Components = grown;
             return component;
         }
 
+        // from a [ThreadSafe] OnUpdate the entity exists once the parallel phase is over
+        public static Entity Create(string _Name)
+        {
+            return EntityCache.Get(InternalCalls.Scene_CreateEntity(_Name));
+        }
+
+        public void Destroy()
+        {
+            InternalCalls.Entity_Destroy(PaperID);
+        }
+
         public Entity GetEntityByName(string _Name)
         {
-            ulong entityID = InternalCalls.Entity_GetEntityByName(_Name);
-            if (entityID == 0)
-                return null;
-            return new Entity(entityID);
+            return EntityCache.Get(InternalCalls.Entity_GetEntityByName(_Name));
+        }
+
+        public bool HasTag(string _Tag)
+        {
+            return InternalCalls.Entity_HasTag(PaperID, _Tag);
+        }
+
+        public bool HasTag(Tag _Tag)
+        {
+            return InternalCalls.Entity_HasTagID(PaperID, _Tag.ID);
+        }
+
+        // clears _Results and fills it with the tagged entities, returns how many there are
+        public int GetEntitiesWithTag(Tag _Tag, List<Entity> _Results)
+        {
+            if (s_EntityIDBuffer == null)
+                s_EntityIDBuffer = new ulong[64];
+
+            int count = InternalCalls.Entity_GetEntitiesWithTagID(_Tag.ID, s_EntityIDBuffer);
+            if (count > s_EntityIDBuffer.Length)
+            {
+                s_EntityIDBuffer = new ulong[count * 2];
+                count = InternalCalls.Entity_GetEntitiesWithTagID(_Tag.ID, s_EntityIDBuffer);
+            }
+
+            _Results.Clear();
+            for (int i = 0; i < count; i++)
+                _Results.Add(EntityCache.Get(s_EntityIDBuffer[i]));
+            return count;
+        }
+
+        public Entity[] GetEntitiesWithTag(string _Tag)
+        {
+            ulong[] entityIDs = InternalCalls.Entity_GetEntitiesWithTag(_Tag);
+            Entity[] entities = new Entity[entityIDs.Length];
+            for (int i = 0; i < entityIDs.Length; i++)
+                entities[i] = EntityCache.Get(entityIDs[i]);
+            return entities;
         }
 
         public T As<T>() where T : Entity, new()
@@ -0,0 +1,49 @@
+﻿using System.Collections.Generic;
+
+namespace Paper
+{
+    // One wrapper per entity id, so entity lookups don't allocate a new Entity on every call.
+    // Script instances replace the plain wrapper while they are alive. Locked, [ThreadSafe] scripts look up from the workers.
+    internal static class EntityCache
+    {
+        private static readonly Dictionary<ulong, Entity> s_Entities = new Dictionary<ulong, Entity>();
+        private static readonly object s_Lock = new object();
+
+        internal static Entity Get(ulong _ID)
+        {
+            if (_ID == 0)
+                return null;
+
+            lock (s_Lock)
+            {
+                if (!s_Entities.TryGetValue(_ID, out Entity entity))
+                {
+                    entity = new Entity(_ID);
+                    s_Entities.Add(_ID, entity);
+                }
+                return entity;
+            }
+        }
+
+        internal static void Add(Entity _Entity)
+        {
+            lock (s_Lock)
+                s_Entities[_Entity.PaperID] = _Entity;
+        }
+
+        internal static void Remove(Entity _Entity)
+        {
+            lock (s_Lock)
+            {
+                if (s_Entities.TryGetValue(_Entity.PaperID, out Entity entity) && entity == _Entity)
+                    s_Entities.Remove(_Entity.PaperID);
+            }
+        }
+
+        internal static void Clear()
+        {
+            lock (s_Lock)
+                s_Entities.Clear();
+        }
+    }
+}
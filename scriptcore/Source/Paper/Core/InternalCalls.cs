@@ -33,6 +33,37 @@ namespace Paper
 
         #endregion
 
+        #region Time
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern float Time_GetDeltaTime();
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern float Time_GetFrameDeltaTime();
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern double Time_GetTime();
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern double Time_GetTickTime();
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern ulong Time_GetTick();
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern ulong Time_GetFrameCount();
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern uint Time_GetTickRate();
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void Time_SetTickRate(uint _TickRate);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern float Time_GetInterpolationAlpha();
+
+        #endregion
+
         #region Render
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
@@ -88,100 +119,111 @@ namespace Paper
         public static extern ulong Entity_GetEntityByName(string _Name);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern object Entity_GetScriptInstance(ulong _UUID);
-
-
-        #endregion
-
-        #region Components
-
-        #region TransformCompoonent
+        public static extern bool Entity_HasTag(ulong _UUID, string _Tag);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void TransformComponent_GetPosition(ulong _UUID, out Vec3 _Position);
+        public static extern ulong[] Entity_GetEntitiesWithTag(string _Tag);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void TransformComponent_SetPosition(ulong _UUID, ref Vec3 _Position);
+        public static extern uint Tag_GetID(string _Tag);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void TransformComponent_GetRotation(ulong _UUID, out Vec3 _Rotation);
+        public static extern bool Entity_HasTagID(ulong _UUID, uint _TagID);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void TransformComponent_SetRotation(ulong _UUID, ref Vec3 _Rotation);
+        public static extern int Entity_GetEntitiesWithTagID(uint _TagID, ulong[] _Buffer);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void TransformComponent_GetScale(ulong _UUID, out Vec3 _Scale);
+        public static extern bool ScriptProfiler_IsEnabled();
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void TransformComponent_SetScale(ulong _UUID, ref Vec3 _Scale);
+        public static extern uint ScriptProfiler_GetClassID(Type _ClassType);
 
-        #endregion
-
-        #region DataComponent
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void ScriptProfiler_ReportUpdate(uint _ClassID, float _Time, int _Calls, long _Allocated, int _Exceptions, ulong[] _EntityIDs, float[] _EntityTimes, int _EntityCount);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern string DataComponent_GetName(ulong _UUID);
+        public static extern object Entity_GetScriptInstance(ulong _UUID);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void DataComponent_SetName(ulong _UUID, string _Name);
+        public static extern void Entity_Destroy(ulong _UUID);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern string DataComponent_GetTags(ulong _UUID);
+        public static extern ulong Scene_CreateEntity(string _Name);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void DataComponent_SetTags(ulong _UUID, string _Tags);
+        public static extern void ScriptRuntime_RunBatches(int _BatchCount);
+
 
         #endregion
 
-        #region SpriteComponent
+        #region Spatial
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void SpriteComponent_GetColor(ulong _UUID, out Vec4 _Color);
+        public static extern ulong[] Scene_QueryRegion(ref Vec2 _Min, ref Vec2 _Max);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void SpriteComponent_SetColor(ulong _UUID, ref Vec4 _Color);
+        public static extern ulong[] Scene_QueryRadius(ref Vec2 _Center, float _Radius);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void SpriteComponent_GetTexture(ulong _UUID, out TextureData _TextureData);
+        public static extern ulong[] Scene_QueryNearest(ref Vec2 _Point, int _Count);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void SpriteComponent_SetTexture(ulong _UUID, string _FilePath);
+        public static extern bool Scene_Raycast(ref Vec2 _Origin, ref Vec2 _Direction, float _MaxDistance, out ulong _EntityID, out float _Distance);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern float SpriteComponent_GetTilingFactor(ulong _UUID);
+        public static extern ulong[] Scene_RaycastAll(ref Vec2 _Origin, ref Vec2 _Direction, float _MaxDistance, out float[] _Distances);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void SpriteComponent_SetTilingFactor(ulong _UUID, float _TilingFactor);
+        public static extern ulong[] Scene_QueryRegionBatch(Vec2[] _Mins, Vec2[] _Maxs, out int[] _Counts);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void SpriteComponent_GetUV0(ulong _UUID, out Vec2 _UV0);
+        public static extern ulong[] Scene_QueryRadiusBatch(Vec2[] _Centers, float[] _Radii, out int[] _Counts);
+
+        #endregion
+
+        #region Components
+
+        #region ComponentViews
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void SpriteComponent_SetUV0(ulong _UUID, ref Vec2 _UV0);
+        public static extern unsafe uint* ComponentViews_GetVersion();
+
+        #endregion
+
+        #region TransformCompoonent
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void SpriteComponent_GetUV1(ulong _UUID, out Vec2 _UV1);
+        public static extern IntPtr TransformComponent_GetData(ulong _UUID);
+
+        #endregion
+
+        #region DataComponent
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void SpriteComponent_SetUV1(ulong _UUID, ref Vec2 _UV1);
+        public static extern string DataComponent_GetName(ulong _UUID);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern int SpriteComponent_GetGeometry(ulong _UUID);
+        public static extern void DataComponent_SetName(ulong _UUID, string _Name);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void SpriteComponent_SetGeometry(ulong _UUID, int _Geometry);
+        public static extern string DataComponent_GetTags(ulong _UUID);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern float SpriteComponent_GetThickness(ulong _UUID);
+        public static extern void DataComponent_SetTags(ulong _UUID, string _Tags);
+
+        #endregion
+
+        #region SpriteComponent
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void SpriteComponent_SetThickness(ulong _UUID, float _Thickness);
+        public static extern IntPtr SpriteComponent_GetData(ulong _UUID);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern float SpriteComponent_GetFade(ulong _UUID);
+        public static extern void SpriteComponent_GetTexture(ulong _UUID, out TextureData _TextureData);
 
         [MethodImplAttribute(MethodImplOptions.InternalCall)]
-        public static extern void SpriteComponent_SetFade(ulong _UUID, float _Fade);
+        public static extern void SpriteComponent_SetTexture(ulong _UUID, string _FilePath);
 
         #endregion
 
@@ -249,6 +291,118 @@ namespace Paper
 
         #endregion
 
+        #region Rigidbody2DComponent
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern int Rigidbody2DComponent_GetBodyType(ulong _EntityID);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void Rigidbody2DComponent_SetBodyType(ulong _EntityID, int _BodyType);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void Rigidbody2DComponent_GetVelocity(ulong _EntityID, out Vec2 _Velocity);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void Rigidbody2DComponent_SetVelocity(ulong _EntityID, ref Vec2 _Velocity);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern float Rigidbody2DComponent_GetMass(ulong _EntityID);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void Rigidbody2DComponent_SetMass(ulong _EntityID, float _Mass);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern float Rigidbody2DComponent_GetGravityScale(ulong _EntityID);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void Rigidbody2DComponent_SetGravityScale(ulong _EntityID, float _GravityScale);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern float Rigidbody2DComponent_GetLinearDamping(ulong _EntityID);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void Rigidbody2DComponent_SetLinearDamping(ulong _EntityID, float _LinearDamping);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void Rigidbody2DComponent_ApplyForce(ulong _EntityID, ref Vec2 _Force);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void Rigidbody2DComponent_ApplyImpulse(ulong _EntityID, ref Vec2 _Impulse);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern bool Rigidbody2DComponent_IsAwake(ulong _EntityID);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void Rigidbody2DComponent_WakeUp(ulong _EntityID);
+
+        #endregion
+
+        #region BoxCollider2DComponent
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void BoxCollider2DComponent_GetOffset(ulong _EntityID, out Vec2 _Offset);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void BoxCollider2DComponent_SetOffset(ulong _EntityID, ref Vec2 _Offset);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void BoxCollider2DComponent_GetSize(ulong _EntityID, out Vec2 _Size);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void BoxCollider2DComponent_SetSize(ulong _EntityID, ref Vec2 _Size);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern float BoxCollider2DComponent_GetFriction(ulong _EntityID);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void BoxCollider2DComponent_SetFriction(ulong _EntityID, float _Friction);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern float BoxCollider2DComponent_GetRestitution(ulong _EntityID);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void BoxCollider2DComponent_SetRestitution(ulong _EntityID, float _Restitution);
+
+        #endregion
+
+        #region CircleCollider2DComponent
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void CircleCollider2DComponent_GetOffset(ulong _EntityID, out Vec2 _Offset);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void CircleCollider2DComponent_SetOffset(ulong _EntityID, ref Vec2 _Offset);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern float CircleCollider2DComponent_GetRadius(ulong _EntityID);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void CircleCollider2DComponent_SetRadius(ulong _EntityID, float _Radius);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern float CircleCollider2DComponent_GetFriction(ulong _EntityID);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void CircleCollider2DComponent_SetFriction(ulong _EntityID, float _Friction);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern float CircleCollider2DComponent_GetRestitution(ulong _EntityID);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void CircleCollider2DComponent_SetRestitution(ulong _EntityID, float _Restitution);
+
+        #endregion
+
+        #endregion
+
+        #region Physics2D
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void Physics2D_GetGravity(out Vec2 _Gravity);
+
+        [MethodImplAttribute(MethodImplOptions.InternalCall)]
+        public static extern void Physics2D_SetGravity(ref Vec2 _Gravity);
+
         #endregion
 
 
@@ -0,0 +1,15 @@
+﻿namespace Paper
+{
+    public static class Physics2D
+    {
+        public static Vec2 Gravity
+        {
+            get
+            {
+                InternalCalls.Physics2D_GetGravity(out Vec2 gravity);
+                return gravity;
+            }
+            set => InternalCalls.Physics2D_SetGravity(ref value);
+        }
+    }
+}
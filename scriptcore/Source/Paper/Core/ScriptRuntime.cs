@@ -0,0 +1,350 @@
+﻿using System;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Threading;
+
+namespace Paper
+{
+    // Live script instances grouped by class. Native code registers instances as they are created and
+    // destroyed and calls Update once per tick, so the OnUpdate loop runs without crossing back into native code.
+    // [ThreadSafe] classes are split into batches first and run on the script workers, the rest runs here after them.
+    internal static class ScriptRuntime
+    {
+        // entities per batch, small enough to spread a few heavy scripts over the workers
+        private const int MinBatchSize = 8;
+        private const int BatchesPerThread = 4;
+
+        private static readonly List<ScriptRuntimeGroup> Groups = new List<ScriptRuntimeGroup>();
+        private static readonly Dictionary<Type, ScriptRuntimeGroup> GroupsByType = new Dictionary<Type, ScriptRuntimeGroup>();
+
+        // batches of the current tick, read by the workers through RunBatch
+        private static ScriptRuntimeGroup[] BatchGroups = new ScriptRuntimeGroup[0];
+        private static int[] BatchStarts = new int[0];
+        private static int[] BatchEnds = new int[0];
+        private static int BatchCount;
+        private static float BatchDeltaTime;
+        private static bool BatchProfiled;
+
+        internal static void Register(Entity _Entity)
+        {
+            Type type = _Entity.GetType();
+            if (!GroupsByType.TryGetValue(type, out ScriptRuntimeGroup group))
+            {
+                group = new ScriptRuntimeGroup(type);
+                GroupsByType.Add(type, group);
+                Groups.Add(group);
+            }
+            group.Add(_Entity);
+            EntityCache.Add(_Entity);
+        }
+
+        internal static void Unregister(Entity _Entity)
+        {
+            if (GroupsByType.TryGetValue(_Entity.GetType(), out ScriptRuntimeGroup group))
+                group.Remove(_Entity);
+            EntityCache.Remove(_Entity);
+        }
+
+        internal static void Clear()
+        {
+            Groups.Clear();
+            GroupsByType.Clear();
+            EntityCache.Clear();
+        }
+
+        internal static void Update(float _DeltaTime)
+        {
+            bool profile = InternalCalls.ScriptProfiler_IsEnabled();
+
+            // groups added during the loop start updating next tick
+            int groupCount = Groups.Count;
+
+            if (BuildBatches(groupCount, _DeltaTime, profile))
+            {
+                // returns after every batch ran and the commands they deferred were applied in batch order
+                InternalCalls.ScriptRuntime_RunBatches(BatchCount);
+                Array.Clear(BatchGroups, 0, BatchCount);
+
+                if (profile)
+                {
+                    for (int i = 0; i < groupCount; i++)
+                    {
+                        if (Groups[i].ThreadSafe)
+                            Groups[i].ReportParallel();
+                    }
+                }
+            }
+
+            for (int i = 0; i < groupCount; i++)
+            {
+                ScriptRuntimeGroup group = Groups[i];
+                if (group.ThreadSafe)
+                    continue;
+
+                if (profile)
+                    group.UpdateProfiled(_DeltaTime);
+                else
+                    group.Update(_DeltaTime);
+            }
+        }
+
+        // called by the script workers and the main thread while ScriptRuntime_RunBatches runs
+        internal static void RunBatch(int _BatchIndex)
+        {
+            BatchGroups[_BatchIndex].UpdateRange(BatchStarts[_BatchIndex], BatchEnds[_BatchIndex], BatchDeltaTime, BatchProfiled);
+        }
+
+        private static bool BuildBatches(int _GroupCount, float _DeltaTime, bool _Profile)
+        {
+            int entityCount = 0;
+            for (int i = 0; i < _GroupCount; i++)
+            {
+                if (Groups[i].ThreadSafe)
+                    entityCount += Groups[i].BeginParallel(_Profile);
+            }
+
+            BatchCount = 0;
+            if (entityCount == 0)
+                return false;
+
+            int batchSize = Math.Max(MinBatchSize, entityCount / (Environment.ProcessorCount * BatchesPerThread));
+            for (int i = 0; i < _GroupCount; i++)
+            {
+                ScriptRuntimeGroup group = Groups[i];
+                if (!group.ThreadSafe)
+                    continue;
+
+                for (int start = 0; start < group.ParallelCount; start += batchSize)
+                    AddBatch(group, start, Math.Min(start + batchSize, group.ParallelCount));
+            }
+
+            BatchDeltaTime = _DeltaTime;
+            BatchProfiled = _Profile;
+            return BatchCount > 0;
+        }
+
+        private static void AddBatch(ScriptRuntimeGroup _Group, int _Start, int _End)
+        {
+            if (BatchCount == BatchGroups.Length)
+            {
+                int capacity = Math.Max(16, BatchCount * 2);
+                Array.Resize(ref BatchGroups, capacity);
+                Array.Resize(ref BatchStarts, capacity);
+                Array.Resize(ref BatchEnds, capacity);
+            }
+
+            BatchGroups[BatchCount] = _Group;
+            BatchStarts[BatchCount] = _Start;
+            BatchEnds[BatchCount] = _End;
+            BatchCount++;
+        }
+    }
+
+    internal class ScriptRuntimeGroup
+    {
+        private readonly List<Entity> Entities = new List<Entity>();
+        private readonly Dictionary<Entity, int> Indices = new Dictionary<Entity, int>();
+        private readonly bool HasUpdate;
+        private readonly Type ClassType;
+        private bool Updating;
+        private bool HasHoles;
+
+        internal readonly bool ThreadSafe;
+        // entities the batches of this tick cover, the list only changes on the main thread after they ran
+        internal int ParallelCount;
+        private int ParallelExceptions;
+
+        // profiling, resolved and grown on first use
+        private uint ClassID;
+        private ulong[] ProfiledIDs = new ulong[0];
+        private float[] ProfiledTimes = new float[0];
+
+        internal ScriptRuntimeGroup(Type _Type)
+        {
+            ClassType = _Type;
+            HasUpdate = _Type.GetMethod("OnUpdate", new Type[] { typeof(float) }).DeclaringType != typeof(Entity);
+            ThreadSafe = _Type.IsDefined(typeof(ThreadSafeAttribute), false);
+        }
+
+        internal void Add(Entity _Entity)
+        {
+            if (Indices.ContainsKey(_Entity)) return;
+            Indices.Add(_Entity, Entities.Count);
+            Entities.Add(_Entity);
+        }
+
+        internal void Remove(Entity _Entity)
+        {
+            if (!Indices.TryGetValue(_Entity, out int index)) return;
+            Indices.Remove(_Entity);
+
+            // the loop is walking the list, leave a hole and compact once it is done
+            if (Updating)
+            {
+                Entities[index] = null;
+                HasHoles = true;
+                return;
+            }
+
+            int last = Entities.Count - 1;
+            if (index != last)
+            {
+                Entities[index] = Entities[last];
+                Indices[Entities[index]] = index;
+            }
+            Entities.RemoveAt(last);
+        }
+
+        internal void Update(float _DeltaTime)
+        {
+            if (!HasUpdate) return;
+
+            Updating = true;
+            // entities added during the loop start updating next tick
+            int count = Entities.Count;
+            for (int i = 0; i < count; i++)
+            {
+                Entity entity = Entities[i];
+                if (entity == null) continue;
+
+                try
+                {
+                    entity.OnUpdate(_DeltaTime);
+                }
+                catch (Exception e)
+                {
+                    Console.Error.WriteLine(e);
+                }
+            }
+            Updating = false;
+
+            if (HasHoles)
+                Compact();
+        }
+
+        // same loop as Update, timing every entity and reporting the totals of the class once
+        internal void UpdateProfiled(float _DeltaTime)
+        {
+            if (!HasUpdate) return;
+
+            if (ClassID == 0)
+                ClassID = InternalCalls.ScriptProfiler_GetClassID(ClassType);
+
+            int count = Entities.Count;
+            GrowProfiledArrays(count);
+
+            double ticksToMs = 1000.0 / Stopwatch.Frequency;
+            long allocatedBefore = GC.GetTotalMemory(false);
+            long groupStart = Stopwatch.GetTimestamp();
+            int calls = 0;
+            int exceptions = 0;
+
+            Updating = true;
+            for (int i = 0; i < count; i++)
+            {
+                Entity entity = Entities[i];
+                if (entity == null) continue;
+
+                long start = Stopwatch.GetTimestamp();
+                try
+                {
+                    entity.OnUpdate(_DeltaTime);
+                }
+                catch (Exception e)
+                {
+                    exceptions++;
+                    Console.Error.WriteLine(e);
+                }
+                ProfiledIDs[calls] = entity.PaperID;
+                ProfiledTimes[calls] = (float)((Stopwatch.GetTimestamp() - start) * ticksToMs);
+                calls++;
+            }
+            Updating = false;
+
+            float time = (float)((Stopwatch.GetTimestamp() - groupStart) * ticksToMs);
+            long allocated = Math.Max(GC.GetTotalMemory(false) - allocatedBefore, 0);
+            InternalCalls.ScriptProfiler_ReportUpdate(ClassID, time, calls, allocated, exceptions, ProfiledIDs, ProfiledTimes, calls);
+
+            if (HasHoles)
+                Compact();
+        }
+
+        // returns how many entities the batches of this tick cover
+        internal int BeginParallel(bool _Profile)
+        {
+            ParallelCount = HasUpdate ? Entities.Count : 0;
+            ParallelExceptions = 0;
+
+            if (_Profile && ParallelCount > 0)
+            {
+                if (ClassID == 0)
+                    ClassID = InternalCalls.ScriptProfiler_GetClassID(ClassType);
+                GrowProfiledArrays(ParallelCount);
+            }
+            return ParallelCount;
+        }
+
+        // one batch, may run on any thread. Batches of a group cover disjoint ranges, so the profiled slots don't overlap
+        internal void UpdateRange(int _Start, int _End, float _DeltaTime, bool _Profile)
+        {
+            double ticksToMs = 1000.0 / Stopwatch.Frequency;
+
+            for (int i = _Start; i < _End; i++)
+            {
+                Entity entity = Entities[i];
+                long start = _Profile ? Stopwatch.GetTimestamp() : 0;
+
+                try
+                {
+                    entity.OnUpdate(_DeltaTime);
+                }
+                catch (Exception e)
+                {
+                    Interlocked.Increment(ref ParallelExceptions);
+                    Console.Error.WriteLine(e);
+                }
+
+                if (_Profile)
+                {
+                    ProfiledIDs[i] = entity.PaperID;
+                    ProfiledTimes[i] = (float)((Stopwatch.GetTimestamp() - start) * ticksToMs);
+                }
+            }
+        }
+
+        // the time is summed over the workers, allocations are not attributed since the GC counter is process wide
+        internal void ReportParallel()
+        {
+            if (ParallelCount == 0) return;
+
+            float time = 0.0f;
+            for (int i = 0; i < ParallelCount; i++)
+                time += ProfiledTimes[i];
+
+            InternalCalls.ScriptProfiler_ReportUpdate(ClassID, time, ParallelCount, 0, ParallelExceptions, ProfiledIDs, ProfiledTimes, ParallelCount);
+        }
+
+        private void GrowProfiledArrays(int _Count)
+        {
+            if (ProfiledIDs.Length >= _Count) return;
+
+            ProfiledIDs = new ulong[_Count * 2];
+            ProfiledTimes = new float[_Count * 2];
+        }
+
+        private void Compact()
+        {
+            int write = 0;
+            for (int read = 0; read < Entities.Count; read++)
+            {
+                Entity entity = Entities[read];
+                if (entity == null) continue;
+                Entities[write] = entity;
+                Indices[entity] = write;
+                write++;
+            }
+            Entities.RemoveRange(write, Entities.Count - write);
+            HasHoles = false;
+        }
+    }
+}
@@ -0,0 +1,100 @@
+﻿using System;
+
+namespace Paper
+{
+    public struct RaycastHit2D
+    {
+        public Entity Entity;
+        public float Distance;
+    }
+
+    public static class Spatial
+    {
+        public static Entity[] QueryRegion(Vec2 _Min, Vec2 _Max)
+        {
+            return ToEntities(InternalCalls.Scene_QueryRegion(ref _Min, ref _Max));
+        }
+
+        public static Entity[] QueryRadius(Vec2 _Center, float _Radius)
+        {
+            return ToEntities(InternalCalls.Scene_QueryRadius(ref _Center, _Radius));
+        }
+
+        public static Entity[] QueryNearest(Vec2 _Point, int _Count)
+        {
+            return ToEntities(InternalCalls.Scene_QueryNearest(ref _Point, _Count));
+        }
+
+        public static bool Raycast(Vec2 _Origin, Vec2 _Direction, float _MaxDistance, out RaycastHit2D _Hit)
+        {
+            _Hit = new RaycastHit2D();
+            if (!InternalCalls.Scene_Raycast(ref _Origin, ref _Direction, _MaxDistance, out ulong entityID, out float distance))
+                return false;
+
+            _Hit.Entity = EntityCache.Get(entityID);
+            _Hit.Distance = distance;
+            return true;
+        }
+
+        public static RaycastHit2D[] RaycastAll(Vec2 _Origin, Vec2 _Direction, float _MaxDistance)
+        {
+            ulong[] entityIDs = InternalCalls.Scene_RaycastAll(ref _Origin, ref _Direction, _MaxDistance, out float[] distances);
+            RaycastHit2D[] hits = new RaycastHit2D[entityIDs.Length];
+            for (int i = 0; i < entityIDs.Length; i++)
+            {
+                hits[i].Entity = EntityCache.Get(entityIDs[i]);
+                hits[i].Distance = distances[i];
+            }
+            return hits;
+        }
+
+        // one native call for all regions, result[i] holds the entities of region i
+        public static Entity[][] QueryRegion(Vec2[] _Mins, Vec2[] _Maxs)
+        {
+            ValidateBatch(_Mins, nameof(_Mins), _Maxs, nameof(_Maxs));
+            ulong[] entityIDs = InternalCalls.Scene_QueryRegionBatch(_Mins, _Maxs, out int[] counts);
+            return Split(entityIDs, counts);
+        }
+
+        // one native call for all circles, result[i] holds the entities of circle i
+        public static Entity[][] QueryRadius(Vec2[] _Centers, float[] _Radii)
+        {
+            ValidateBatch(_Centers, nameof(_Centers), _Radii, nameof(_Radii));
+            ulong[] entityIDs = InternalCalls.Scene_QueryRadiusBatch(_Centers, _Radii, out int[] counts);
+            return Split(entityIDs, counts);
+        }
+
+        // both arrays are read by the same index natively
+        private static void ValidateBatch(Array _First, string _FirstName, Array _Second, string _SecondName)
+        {
+            if (_First == null)
+                throw new ArgumentNullException(_FirstName);
+            if (_Second == null)
+                throw new ArgumentNullException(_SecondName);
+            if (_First.Length != _Second.Length)
+                throw new ArgumentException($"Expected {_First.Length} elements to match {_FirstName}", _SecondName);
+        }
+
+        private static Entity[] ToEntities(ulong[] _EntityIDs)
+        {
+            Entity[] entities = new Entity[_EntityIDs.Length];
+            for (int i = 0; i < _EntityIDs.Length; i++)
+                entities[i] = EntityCache.Get(_EntityIDs[i]);
+            return entities;
+        }
+
+        private static Entity[][] Split(ulong[] _EntityIDs, int[] _Counts)
+        {
+            Entity[][] results = new Entity[_Counts.Length][];
+            int offset = 0;
+            for (int i = 0; i < _Counts.Length; i++)
+            {
+                results[i] = new Entity[_Counts[i]];
+                for (int j = 0; j < _Counts[i]; j++)
+                    results[i][j] = EntityCache.Get(_EntityIDs[offset + j]);
+                offset += _Counts[i];
+            }
+            return results;
+        }
+    }
+}
@@ -0,0 +1,14 @@
+﻿namespace Paper
+{
+    // Interned tag id. Create it once, e.g. in a static readonly field, and query with it
+    // instead of a string. Tags are case insensitive, 'Enemy' and 'ENEMY' share one id.
+    public readonly struct Tag
+    {
+        public readonly uint ID;
+
+        public Tag(string _Name)
+        {
+            ID = InternalCalls.Tag_GetID(_Name);
+        }
+    }
+}
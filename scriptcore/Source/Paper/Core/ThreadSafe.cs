@@ -0,0 +1,14 @@
+﻿using System;
+
+namespace Paper
+{
+    // Lets OnUpdate of the script run on the script workers, in parallel with other instances.
+    // The script may read anything and write the components of its own entity. Changes to shared state
+    // (entity creation and destruction, names, tags, rigidbodies, assets, physics settings) are recorded
+    // and applied after the parallel phase in a fixed order, so they are not visible before the next update.
+    // Marked scripts update before the unmarked ones.
+    [AttributeUsage(AttributeTargets.Class, Inherited = false)]
+    public sealed class ThreadSafeAttribute : Attribute
+    {
+    }
+}
@@ -0,0 +1,30 @@
+﻿namespace Paper
+{
+    public static class Time
+    {
+        // Seconds per simulation tick. OnUpdate runs once per tick and receives this value.
+        public static float DeltaTime => InternalCalls.Time_GetDeltaTime();
+
+        // Real time of the last rendered frame.
+        public static float FrameDeltaTime => InternalCalls.Time_GetFrameDeltaTime();
+
+        // Real seconds since the application started.
+        public static double RealTime => InternalCalls.Time_GetTime();
+
+        // Simulated seconds, advances by DeltaTime every tick.
+        public static double TickTime => InternalCalls.Time_GetTickTime();
+
+        public static ulong Tick => InternalCalls.Time_GetTick();
+
+        public static ulong FrameCount => InternalCalls.Time_GetFrameCount();
+
+        public static uint TickRate
+        {
+            get => InternalCalls.Time_GetTickRate();
+            set => InternalCalls.Time_SetTickRate(value);
+        }
+
+        // How far the current frame is between the last two ticks, used to interpolate rendering.
+        public static float InterpolationAlpha => InternalCalls.Time_GetInterpolationAlpha();
+    }
+}
@@ -2,6 +2,7 @@ project "scriptcore"
 	kind "SharedLib"
 	language "C#"
 	dotnetframework "4.7.2"
+	clr "Unsafe"
 	
 	linkAppReferences(false)
 